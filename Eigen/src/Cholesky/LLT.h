@@ -104,6 +104,16 @@ class LLT : public SolverBase<LLT<MatrixType_, UpLo_> > {
     compute(matrix.derived());
   }
 
+  /** \brief Constructs a LLT factorization from a given matrix, using the threads of \a device
+   *
+   * \sa compute(const EigenBase&, CoreThreadPoolDevice&)
+   */
+  template <typename InputType>
+  LLT(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device)
+      : m_matrix(matrix.rows(), matrix.cols()), m_l1_norm(0), m_isInitialized(false), m_info(InvalidInput) {
+    compute(matrix.derived(), device);
+  }
+
   /** \brief Constructs a LLT factorization from a given matrix
    *
    * This overloaded constructor is provided for \link InplaceDecomposition inplace decomposition \endlink when
@@ -150,6 +160,9 @@ class LLT : public SolverBase<LLT<MatrixType_, UpLo_> > {
   template <typename InputType>
   LLT& compute(const EigenBase<InputType>& matrix);
 
+  template <typename InputType>
+  LLT& compute(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device);
+
   /** \returns an estimate of the reciprocal condition number of the matrix of
    *  which \c *this is the Cholesky decomposition.
    */
@@ -283,6 +296,107 @@ static Index llt_rank_update_lower(MatrixType& mat, const VectorType& vec,
   return -1;
 }
 
+/* Tiled right-looking Cholesky factorization of the lower triangular part of a matrix, as a graph of tasks for
+ * CoreThreadPoolDevice::runTaskGraph. The matrix is split into square tiles, and tile (i,j), j <= i, goes through
+ * j update stages followed by a final stage:
+ *  - stage k < j: A(i,j) -= L(i,k) L(j,k)^*, a SYRK for a diagonal tile and a GEMM otherwise,
+ *  - stage j: the factorization L(j,j) of a diagonal tile (POTRF), or L(i,j) = A(i,j) L(j,j)^-* (TRSM).
+ * The stages of one tile run in order, and stage k waits for the final stages of tiles (i,k) and (j,k). Since the
+ * tiles of the next panel are listed first among the successors of a task, the next panel is factored while the
+ * trailing updates of the current one are still running.
+ */
+template <typename MatrixType>
+class llt_tiled_graph {
+  using Scalar = typename MatrixType::Scalar;
+  using RealScalar = typename NumTraits<Scalar>::Real;
+
+ public:
+  llt_tiled_graph(MatrixType& mat, Index tileSize)
+      : m_matrix(mat), m_tileSize(tileSize), m_numTiles(numext::div_ceil(mat.rows(), tileSize)), m_info(-1) {
+    // Stages of the tiles, stored row by row in the lower triangle.
+    m_offsets.reserve(m_numTiles * (m_numTiles + 1) / 2 + 1);
+    m_offsets.push_back(0);
+    for (Index i = 0; i < m_numTiles; ++i) {
+      for (Index j = 0; j <= i; ++j) {
+        m_tileRow.push_back(i);
+        m_tileCol.push_back(j);
+        m_offsets.push_back(m_offsets.back() + j + 1);
+      }
+    }
+  }
+
+  Index size() const { return m_offsets.back(); }
+
+  int dependencies(Index task) const {
+    Index i, j, k;
+    decode(task, i, j, k);
+    if (k < j) return int(k > 0) + 1 + int(i != j);
+    return int(j > 0) + int(i > j);
+  }
+
+  void run(Index task) {
+    Index i, j, k;
+    decode(task, i, j, k);
+    // Once a diagonal tile is found not to be positive definite, the remaining tasks only release their successors.
+    if (m_info.load(std::memory_order_relaxed) >= 0) return;
+    auto Aij = tile(i, j);
+    if (k < j) {
+      if (i == j)
+        Aij.template selfadjointView<Lower>().rankUpdate(tile(i, k), typename NumTraits<RealScalar>::Literal(-1));
+      else
+        Aij.noalias() -= tile(i, k) * tile(j, k).adjoint();
+    } else if (i == j) {
+      const Index ret = llt_inplace<Scalar, Lower>::blocked(Aij);
+      if (ret >= 0) m_info.store(j * m_tileSize + ret, std::memory_order_relaxed);
+    } else {
+      tile(j, j).adjoint().template triangularView<Upper>().template solveInPlace<OnTheRight>(Aij);
+    }
+  }
+
+  template <typename Func>
+  void forEachSuccessor(Index task, Func&& f) const {
+    Index i, j, k;
+    decode(task, i, j, k);
+    if (k < j) {
+      f(id(i, j, k + 1));
+    } else if (i == j) {
+      for (Index r = j + 1; r < m_numTiles; ++r) f(id(r, j, j));
+    } else {
+      // L(i,j) is used by the updates of the tiles (i,c), j < c <= i, and (r,i), r > i.
+      for (Index c = j + 1; c <= i; ++c) f(id(i, c, j));
+      for (Index r = i + 1; r < m_numTiles; ++r) f(id(r, i, j));
+    }
+  }
+
+  // Index of the first column which is not positive definite, or -1.
+  Index info() const { return m_info.load(); }
+
+ private:
+  Index id(Index i, Index j, Index k) const { return m_offsets[i * (i + 1) / 2 + j] + k; }
+
+  void decode(Index task, Index& i, Index& j, Index& k) const {
+    const Index t = Index(std::upper_bound(m_offsets.begin(), m_offsets.end(), task) - m_offsets.begin()) - 1;
+    i = m_tileRow[t];
+    j = m_tileCol[t];
+    k = task - m_offsets[t];
+  }
+
+  Block<MatrixType, Dynamic, Dynamic> tile(Index i, Index j) {
+    const Index size = m_matrix.rows();
+    return Block<MatrixType, Dynamic, Dynamic>(m_matrix, i * m_tileSize, j * m_tileSize,
+                                               numext::mini(m_tileSize, size - i * m_tileSize),
+                                               numext::mini(m_tileSize, size - j * m_tileSize));
+  }
+
+  MatrixType& m_matrix;
+  const Index m_tileSize;
+  const Index m_numTiles;
+  std::vector<Index> m_offsets;
+  std::vector<Index> m_tileRow;
+  std::vector<Index> m_tileCol;
+  std::atomic<Index> m_info;
+};
+
 template <typename Scalar>
 struct llt_inplace<Scalar, Lower> {
   using RealScalar = typename NumTraits<Scalar>::Real;
@@ -340,6 +454,19 @@ struct llt_inplace<Scalar, Lower> {
     return -1;
   }
 
+  template <typename MatrixType, typename Device>
+  static Index tiled(MatrixType& m, Device& device) {
+    eigen_assert(m.rows() == m.cols());
+    const Index tileSize = 256;
+    // Too few tiles to keep several threads busy. The factorization then runs on the calling thread only, like the
+    // tasks of the graph, rather than on the threads of parallelize_gemm.
+    internal::sequential_products_scope sequential;
+    if (m.rows() <= 2 * tileSize) return blocked(m);
+    llt_tiled_graph<MatrixType> graph(m, tileSize);
+    device.runTaskGraph(graph);
+    return graph.info();
+  }
+
   template <typename MatrixType, typename VectorType>
   static Index rankUpdate(MatrixType& mat, const VectorType& vec, const RealScalar& sigma) {
     return Eigen::internal::llt_rank_update_lower(mat, vec, sigma);
@@ -360,6 +487,11 @@ struct llt_inplace<Scalar, Upper> {
     Transpose<MatrixType> matt(mat);
     return llt_inplace<Scalar, Lower>::blocked(matt);
   }
+  template <typename MatrixType, typename Device>
+  static EIGEN_STRONG_INLINE Index tiled(MatrixType& mat, Device& device) {
+    Transpose<MatrixType> matt(mat);
+    return llt_inplace<Scalar, Lower>::tiled(matt, device);
+  }
   template <typename MatrixType, typename VectorType>
   static Index rankUpdate(MatrixType& mat, const VectorType& vec, const RealScalar& sigma) {
     Transpose<MatrixType> matt(mat);
@@ -376,6 +508,10 @@ struct LLT_Traits<MatrixType, Lower> {
   static bool inplace_decomposition(MatrixType& m) {
     return llt_inplace<typename MatrixType::Scalar, Lower>::blocked(m) == -1;
   }
+  template <typename Device>
+  static bool inplace_decomposition(MatrixType& m, Device& device) {
+    return llt_inplace<typename MatrixType::Scalar, Lower>::tiled(m, device) == -1;
+  }
 };
 
 template <typename MatrixType>
@@ -387,6 +523,10 @@ struct LLT_Traits<MatrixType, Upper> {
   static bool inplace_decomposition(MatrixType& m) {
     return llt_inplace<typename MatrixType::Scalar, Upper>::blocked(m) == -1;
   }
+  template <typename Device>
+  static bool inplace_decomposition(MatrixType& m, Device& device) {
+    return llt_inplace<typename MatrixType::Scalar, Upper>::tiled(m, device) == -1;
+  }
 };
 
 }  // end namespace internal
@@ -416,6 +556,37 @@ LLT<MatrixType, UpLo_>& LLT<MatrixType, UpLo_>::compute(const EigenBase<InputTyp
   return *this;
 }
 
+/** Computes / recomputes the Cholesky decomposition A = LL^* = U^*U of \a matrix on the threads of \a device
+ *
+ * The matrix is split into tiles, and the factorizations, triangular solves and updates of the tiles run as a graph
+ * of tasks on the pool of \a device, so that the factorization of the next panel overlaps with the update of the
+ * trailing matrix. Small matrices are factored sequentially. This requires the ThreadPool module:
+ * \code
+ * #include <Eigen/ThreadPool>
+ * Eigen::ThreadPool pool(8);
+ * Eigen::CoreThreadPoolDevice device(pool);
+ * Eigen::LLT<Eigen::MatrixXd> llt(A, device);
+ * \endcode
+ *
+ * \returns a reference to *this
+ */
+template <typename MatrixType, int UpLo_>
+template <typename InputType>
+LLT<MatrixType, UpLo_>& LLT<MatrixType, UpLo_>::compute(const EigenBase<InputType>& a, CoreThreadPoolDevice& device) {
+  eigen_assert(a.rows() == a.cols());
+  const Index size = a.rows();
+  m_matrix.resize(size, size);
+  if (!internal::is_same_dense(m_matrix, a.derived())) m_matrix = a.derived();
+
+  m_l1_norm = m_matrix.template selfadjointView<UpLo_>().l1Norm();
+
+  m_isInitialized = true;
+  bool ok = Traits::inplace_decomposition(m_matrix, device);
+  m_info = ok ? Success : NumericalIssue;
+
+  return *this;
+}
+
 /** Performs a rank one update (or downdate) of the current decomposition.
  * If A = LL^* before the rank one update,
  * then after it we have LL^* = A + sigma * v v^* where \a v must be a vector
@@ -0,0 +1,152 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_LLT_BATCHED_H
+#define EIGEN_LLT_BATCHED_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+// Cholesky factorization of the lanes [b, b + PacketSize) of a SoA batch of Size x Size matrices, in place.
+template <typename Scalar, int Size>
+struct batched_llt_kernel {
+  Scalar* data;
+  Index stride;
+  bool failed;
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void run(Index b) {
+    using Lanes = soa_lanes<Packet>;
+    Packet l[Size * Size];
+    for (int j = 0; j < Size; ++j)
+      for (int i = j; i < Size; ++i) l[i + j * Size] = Lanes::load(data, stride, i + j * Size, b);
+
+    const Packet zero = pzero(l[0]);
+    Packet positive = ptrue(zero);
+    for (int j = 0; j < Size; ++j) {
+      Packet d = l[j + j * Size];
+      for (int k = 0; k < j; ++k) d = pnmadd(l[j + k * Size], l[j + k * Size], d);
+      // Written as 0 < d so that a NaN pivot is caught as well.
+      positive = pand(positive, pcmp_lt(zero, d));
+      const Packet ljj = psqrt(d);
+      l[j + j * Size] = ljj;
+      for (int i = j + 1; i < Size; ++i) {
+        Packet x = l[i + j * Size];
+        for (int k = 0; k < j; ++k) x = pnmadd(l[i + k * Size], l[j + k * Size], x);
+        l[i + j * Size] = pdiv(x, ljj);
+      }
+    }
+    if (predux_any(pandnot(ptrue(zero), positive))) failed = true;
+
+    for (int j = 0; j < Size; ++j)
+      for (int i = j; i < Size; ++i) Lanes::store(data, stride, i + j * Size, b, l[i + j * Size]);
+  }
+};
+
+// Solves L L^T x = b for the lanes [b, b + PacketSize) of a SoA batch of right-hand sides, in place.
+template <typename Scalar, int Size>
+struct batched_llt_solve_kernel {
+  const Scalar* factors;
+  Index factorStride;
+  Scalar* rhs;
+  Index rhsStride;
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void run(Index b) {
+    using Lanes = soa_lanes<Packet>;
+    Packet l[Size * Size];
+    Packet x[Size];
+    for (int j = 0; j < Size; ++j)
+      for (int i = j; i < Size; ++i) l[i + j * Size] = Lanes::load(factors, factorStride, i + j * Size, b);
+    for (int i = 0; i < Size; ++i) x[i] = Lanes::load(rhs, rhsStride, i, b);
+
+    for (int i = 0; i < Size; ++i) {
+      for (int k = 0; k < i; ++k) x[i] = pnmadd(l[i + k * Size], x[k], x[i]);
+      x[i] = pdiv(x[i], l[i + i * Size]);
+    }
+    for (int i = Size - 1; i >= 0; --i) {
+      for (int k = i + 1; k < Size; ++k) x[i] = pnmadd(l[k + i * Size], x[k], x[i]);
+      x[i] = pdiv(x[i], l[i + i * Size]);
+    }
+
+    for (int i = 0; i < Size; ++i) Lanes::store(rhs, rhsStride, i, b, x[i]);
+  }
+};
+
+}  // end namespace internal
+
+/** \ingroup Cholesky_Module
+ *
+ * Computes in place the Cholesky factorizations \f$ A_b = L_b L_b^T \f$ of a batch of
+ * Size x Size real symmetric positive definite matrices.
+ *
+ * The batch is stored as a structure of arrays: \a matrices is a column-major
+ * batchSize x (Size * Size) matrix whose column <tt>i + j * Size</tt> holds the coefficient
+ * (i, j) of every matrix of the batch. Only the lower triangular part is read, and it is
+ * overwritten by the factor \a L; the strictly upper part is left untouched.
+ *
+ * Compared to a loop of LLT<Matrix<Scalar, Size, Size>>, which vectorizes within a single
+ * matrix at best, each SIMD lane processes a different matrix of the batch, so that all the
+ * arithmetic is vectorized whatever the size. This is meant for large batches of tiny
+ * systems such as 3x3 or 6x6 covariance matrices.
+ *
+ * \returns #Success, or #NumericalIssue if at least one matrix is not positive definite, in
+ * which case the factors of those matrices contain non-finite values.
+ *
+ * Example:
+ * \code
+ * Matrix<double, Dynamic, 36> covariances(n, 36);  // n 6x6 matrices
+ * // ... fill covariances.col(i + 6 * j) with the coefficients (i, j) ...
+ * batchedLLT<6>(covariances);
+ * batchedLLTSolve<6>(covariances, rhs);            // rhs is n x 6
+ * \endcode
+ *
+ * \sa batchedLLTSolve(), class LLT
+ */
+template <int Size, typename Derived>
+ComputationInfo batchedLLT(const MatrixBase<Derived>& matrices) {
+  internal::check_soa_batch(matrices, Size * Size);
+  using Scalar = typename Derived::Scalar;
+  Derived& m = matrices.const_cast_derived();
+  internal::batched_llt_kernel<Scalar, Size> kernel{m.data(), m.outerStride(), false};
+  internal::soa_batch_for_each<Scalar, true>(m.rows(), kernel);
+  return kernel.failed ? NumericalIssue : Success;
+}
+
+/** \ingroup Cholesky_Module
+ *
+ * Solves in place the systems \f$ L_b L_b^T x_b = r_b \f$ for a batch of Cholesky factors
+ * computed by batchedLLT().
+ *
+ * \a rhs is a column-major batchSize x Size matrix whose row \a b holds the right-hand
+ * side of the system \a b; it is overwritten by the solution.
+ *
+ * \sa batchedLLT()
+ */
+template <int Size, typename FactorsDerived, typename RhsDerived>
+void batchedLLTSolve(const MatrixBase<FactorsDerived>& factors, const MatrixBase<RhsDerived>& rhs) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename FactorsDerived::Scalar, typename RhsDerived::Scalar>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  internal::check_soa_batch(factors, Size * Size);
+  internal::check_soa_batch(rhs, Size);
+  eigen_assert(factors.rows() == rhs.rows() && "the batches of factors and right-hand sides differ in size");
+  using Scalar = typename FactorsDerived::Scalar;
+  RhsDerived& r = rhs.const_cast_derived();
+  internal::batched_llt_solve_kernel<Scalar, Size> kernel{factors.derived().data(), factors.derived().outerStride(),
+                                                          r.data(), r.outerStride()};
+  internal::soa_batch_for_each<Scalar, true>(r.rows(), kernel);
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_LLT_BATCHED_H
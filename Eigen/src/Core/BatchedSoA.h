@@ -0,0 +1,79 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_BATCHED_SOA_H
+#define EIGEN_BATCHED_SOA_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+/* Support for the batched small decompositions (batchedLLT(), batchedPartialPivLU(),
+ * batchedSelfAdjointEigen3x3(), batchedQuaternionProduct()).
+ *
+ * A batch of small objects is stored as a structure of arrays: a column-major
+ * batchSize x fields matrix whose column f holds the field f of every object of the
+ * batch. For a batch of N x M matrices, field i + j * N is the coefficient (i, j).
+ * The kernels then process PacketSize objects at once, one SIMD lane per object,
+ * with exactly the same instructions for every lane: data dependent branches are
+ * replaced by pselect(). */
+
+/* Packet-wide view of the lanes [b, b + Size) of a structure-of-arrays batch whose
+ * columns are stride scalars apart. Packet may be a plain scalar, in which case a
+ * single object is processed. */
+template <typename Packet_>
+struct soa_lanes {
+  using Packet = Packet_;
+  using Scalar = typename unpacket_traits<Packet>::type;
+  enum { Size = unpacket_traits<Packet>::size };
+
+  static EIGEN_STRONG_INLINE Packet load(const Scalar* data, Index stride, Index field, Index b) {
+    return ploadu<Packet>(data + field * stride + b);
+  }
+  static EIGEN_STRONG_INLINE void store(Scalar* data, Index stride, Index field, Index b, const Packet& x) {
+    pstoreu<Scalar, Packet>(data + field * stride + b, x);
+  }
+};
+
+/* Calls kernel.template run<Packet>(b) on the groups of lanes covering [0, batchSize):
+ * full packets first, then one scalar at a time for the remainder. When Vectorize is
+ * false, for instance because the kernel needs a packet math function that the target
+ * lacks, every object goes through the scalar path. */
+template <typename Scalar, bool Vectorize, typename Kernel>
+void soa_batch_for_each(Index batchSize, Kernel& kernel) {
+  using Packet = typename packet_traits<Scalar>::type;
+  enum { PacketSize = unpacket_traits<Packet>::size };
+  Index b = 0;
+  if (Vectorize && packet_traits<Scalar>::Vectorizable && PacketSize > 1) {
+    for (; b + PacketSize <= batchSize; b += PacketSize) kernel.template run<Packet>(b);
+  }
+  for (; b < batchSize; ++b) kernel.template run<Scalar>(b);
+}
+
+/* Checks shared by the public entry points: the batch must be a column-major
+ * expression with direct access and contiguous columns. */
+template <typename Derived>
+void check_soa_batch(const MatrixBase<Derived>& batch, Index fields) {
+  EIGEN_STATIC_ASSERT((bool(internal::traits<Derived>::Flags & DirectAccessBit)),
+                      THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_WITH_DIRECT_MEMORY_ACCESS_SUCH_AS_MAP_OR_PLAIN_MATRICES)
+  EIGEN_STATIC_ASSERT(!Derived::IsRowMajor && Derived::InnerStrideAtCompileTime == 1,
+                      THE_BATCH_MUST_BE_A_COLUMN_MAJOR_MATRIX_WITH_CONTIGUOUS_COLUMNS)
+  EIGEN_STATIC_ASSERT(!NumTraits<typename Derived::Scalar>::IsComplex, NUMERIC_TYPE_MUST_BE_REAL)
+  EIGEN_ONLY_USED_FOR_DEBUG(fields);
+  eigen_assert(batch.cols() == fields && "the batch does not have the expected number of fields");
+}
+
+}  // end namespace internal
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_BATCHED_SOA_H
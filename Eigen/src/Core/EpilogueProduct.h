@@ -0,0 +1,152 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_EPILOGUE_PRODUCT_H
+#define EIGEN_EPILOGUE_PRODUCT_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+template <typename Lhs, typename Rhs, typename Epilogue>
+struct traits<EpilogueProduct<Lhs, Rhs, Epilogue>> : traits<typename Product<Lhs, Rhs>::PlainObject> {
+  using PlainObject = typename Product<Lhs, Rhs>::PlainObject;
+  using BaseTraits = traits<PlainObject>;
+  enum { Flags = BaseTraits::Flags & RowMajorBit };
+};
+
+// Activation of BiasActivation which leaves its argument unchanged.
+template <typename Scalar>
+struct scalar_no_activation_op {
+  EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE Scalar operator()(const Scalar& a) const { return a; }
+  template <typename Packet>
+  EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE Packet packetOp(const Packet& a) const {
+    return a;
+  }
+};
+
+}  // end namespace internal
+
+/** \class EpilogueProduct
+ * \ingroup Core_Module
+ *
+ * \brief Expression of a matrix product followed by an element-wise epilogue
+ *
+ * \tparam Lhs the type of the left-hand side of the product
+ * \tparam Rhs the type of the right-hand side of the product
+ * \tparam Epilogue the type of the functor applied to each coefficient of the product
+ *
+ * This class represents the expression returned by Product::withEpilogue(). Post-processing a
+ * product with regular expressions, e.g. the bias of a fully connected layer in
+ * <tt>Y = (W * X).colwise() + b</tt>, evaluates the product into the destination and then reads and
+ * writes it again. Instead,
+ * \code
+ * Y.noalias() = (W * X).withEpilogue(BiasActivation<float>(b));
+ * \endcode
+ * lets the matrix-matrix product kernel apply the epilogue to each block of \c Y right after it
+ * has computed it, while the block is still in the cache. This fusion is used for large products
+ * assigned to a column-major destination with direct access; other cases, including \c += and
+ * \c -=, evaluate the product first and apply the epilogue in a second pass.
+ *
+ * An epilogue functor receives the coefficients along with their position in the product, one at
+ * a time or as a packet of consecutive coefficients of a column, e.g. for a rectified product:
+ * \code
+ * struct Relu {
+ *   float operator()(float x, Index row, Index col) const { return numext::maxi(x, 0.f); }
+ *   // x holds the coefficients (row, col) to (row + size - 1, col).
+ *   template <typename Packet>
+ *   Packet packetOp(const Packet& x, Index row, Index col) const {
+ *     return internal::pmax(x, internal::pzero(x));
+ *   }
+ * };
+ * \endcode
+ * Scalar factors of the operands, as in \c (2*W)*X, are applied to the product before the epilogue.
+ *
+ * \sa BiasActivation
+ */
+template <typename Lhs, typename Rhs, typename Epilogue>
+class EpilogueProduct : public internal::generic_xpr_base<EpilogueProduct<Lhs, Rhs, Epilogue>>::type {
+ public:
+  using Base = typename internal::generic_xpr_base<EpilogueProduct>::type;
+  using Scalar = typename internal::traits<EpilogueProduct>::Scalar;
+  using StorageIndex = typename internal::traits<EpilogueProduct>::StorageIndex;
+  using Nested = typename internal::ref_selector<EpilogueProduct>::type;
+  using LhsNested = typename internal::ref_selector<Lhs>::type;
+  using RhsNested = typename internal::ref_selector<Rhs>::type;
+  using LhsNestedCleaned = internal::remove_all_t<LhsNested>;
+  using RhsNestedCleaned = internal::remove_all_t<RhsNested>;
+
+  EpilogueProduct(const Lhs& lhs, const Rhs& rhs, const Epilogue& epilogue)
+      : m_lhs(lhs), m_rhs(rhs), m_epilogue(epilogue) {
+    eigen_assert(lhs.cols() == rhs.rows() && "invalid matrix product");
+  }
+
+  EIGEN_DEVICE_FUNC constexpr Index rows() const noexcept { return m_lhs.rows(); }
+  EIGEN_DEVICE_FUNC constexpr Index cols() const noexcept { return m_rhs.cols(); }
+
+  const LhsNestedCleaned& lhs() const { return m_lhs; }
+  const RhsNestedCleaned& rhs() const { return m_rhs; }
+  const Epilogue& epilogue() const { return m_epilogue; }
+
+ protected:
+  LhsNested m_lhs;
+  RhsNested m_rhs;
+  Epilogue m_epilogue;
+};
+
+/** \class BiasActivation
+ * \ingroup Core_Module
+ *
+ * \brief Epilogue adding a bias to each row of a product and applying an activation function
+ *
+ * \tparam Scalar_ the scalar type of the product
+ * \tparam Activation_ a unary functor with \c operator() and \c packetOp(), e.g.
+ *                     internal::scalar_logistic_op<Scalar_>; none by default
+ *
+ * Computes <tt>activation(x + bias(row))</tt> for each coefficient \c x of the product, i.e.
+ * <tt>(W * X).withEpilogue(BiasActivation<float>(b))</tt> is <tt>(W * X).colwise() + b</tt>. An
+ * empty bias (the default) is not added.
+ *
+ * \sa EpilogueProduct
+ */
+template <typename Scalar_, typename Activation_ = internal::scalar_no_activation_op<Scalar_>>
+class BiasActivation {
+ public:
+  using Scalar = Scalar_;
+  using Activation = Activation_;
+  using BiasVector = Matrix<Scalar, Dynamic, 1>;
+
+  /** Adds \a bias, unless it is empty, and applies \a activation. The bias is copied. */
+  explicit BiasActivation(const BiasVector& bias = BiasVector(), const Activation& activation = Activation())
+      : m_bias(bias), m_activation(activation) {}
+
+  Scalar operator()(const Scalar& x, Index row, Index /*col*/) const {
+    return m_activation(m_bias.size() == 0 ? x : Scalar(x + m_bias.coeff(row)));
+  }
+
+  template <typename Packet>
+  Packet packetOp(const Packet& x, Index row, Index /*col*/) const {
+    if (m_bias.size() == 0) return m_activation.packetOp(x);
+    return m_activation.packetOp(internal::padd(x, internal::ploadu<Packet>(m_bias.data() + row)));
+  }
+
+  const BiasVector& bias() const { return m_bias; }
+  const Activation& activation() const { return m_activation; }
+
+ protected:
+  BiasVector m_bias;
+  Activation m_activation;
+};
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_EPILOGUE_PRODUCT_H
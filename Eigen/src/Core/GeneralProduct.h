@@ -308,22 +308,30 @@ EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE void gemv_prepare_rhs(
   }
 }
 
+// Runs the general_matrix_vector_product kernel Gemv, split across threads if parallel is true (see
+// GeneralMatrixVector.h).
+template <typename Gemv, typename LhsMapper, typename RhsMapper, typename ResScalar, typename AlphaScalar>
+void parallelize_gemv(Index rows, Index cols, const LhsMapper& lhs, const RhsMapper& rhs, ResScalar* res,
+                      Index resIncr, AlphaScalar alpha, bool parallel);
+
 // The vector is on the left => transposition
 template <int StorageOrder, bool BlasCompatible>
 struct gemv_dense_selector<OnTheLeft, StorageOrder, BlasCompatible> {
   template <typename Lhs, typename Rhs, typename Dest>
-  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha) {
+  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha,
+                  bool parallel = true) {
     Transpose<Dest> destT(dest);
     enum { OtherStorageOrder = StorageOrder == RowMajor ? ColMajor : RowMajor };
     gemv_dense_selector<OnTheRight, OtherStorageOrder, BlasCompatible>::run(rhs.transpose(), lhs.transpose(), destT,
-                                                                            alpha);
+                                                                            alpha, parallel);
   }
 };
 
 template <>
 struct gemv_dense_selector<OnTheRight, ColMajor, true> {
   template <typename Lhs, typename Rhs, typename Dest>
-  static inline void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha) {
+  static inline void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha,
+                         bool parallel = true) {
     using LhsScalar = typename Lhs::Scalar;
     using RhsScalar = typename Rhs::Scalar;
     using ResScalar = typename Dest::Scalar;
@@ -351,15 +359,14 @@ struct gemv_dense_selector<OnTheRight, ColMajor, true> {
 
     using LhsMapper = const_blas_data_mapper<LhsScalar, Index, ColMajor>;
     using RhsMapper = const_blas_data_mapper<RhsScalar, Index, RowMajor>;
+    using Gemv = general_matrix_vector_product<Index, LhsScalar, LhsMapper, ColMajor, LhsBlasTraits::NeedToConjugate,
+                                               RhsScalar, RhsMapper, RhsBlasTraits::NeedToConjugate>;
     EIGEN_IF_CONSTEXPR (!MightCannotUseDest) {
       // shortcut if we are sure to be able to use dest directly,
       // this eases the compiler to generate cleaner and more optimized code for most common cases
-      general_matrix_vector_product<
-          Index, LhsScalar, LhsMapper, ColMajor, LhsBlasTraits::NeedToConjugate, RhsScalar, RhsMapper,
-          RhsBlasTraits::NeedToConjugate>::run(actualLhs.rows(), actualLhs.cols(),
-                                               LhsMapper(actualLhs.data(), actualLhs.outerStride()),
-                                               RhsMapper(actualRhs.data(), actualRhs.innerStride()), dest.data(), 1,
-                                               get_factor<ResScalar, RhsScalar>::run(actualAlpha));
+      parallelize_gemv<Gemv>(actualLhs.rows(), actualLhs.cols(), LhsMapper(actualLhs.data(), actualLhs.outerStride()),
+                             RhsMapper(actualRhs.data(), actualRhs.innerStride()), dest.data(), Index(1),
+                             get_factor<ResScalar, RhsScalar>::run(actualAlpha), parallel);
     } else {
       gemv_static_vector_if<ResScalar, ActualDest::SizeAtCompileTime, ActualDest::MaxSizeAtCompileTime,
                             MightCannotUseDest>
@@ -372,14 +379,9 @@ struct gemv_dense_selector<OnTheRight, ColMajor, true> {
 
       destPolicy.prepare(dest, actualDestPtr);
 
-      general_matrix_vector_product<Index, LhsScalar, LhsMapper, ColMajor, LhsBlasTraits::NeedToConjugate, RhsScalar,
-                                    RhsMapper, RhsBlasTraits::NeedToConjugate>::run(actualLhs.rows(), actualLhs.cols(),
-                                                                                    LhsMapper(actualLhs.data(),
-                                                                                              actualLhs.outerStride()),
-                                                                                    RhsMapper(actualRhs.data(),
-                                                                                              actualRhs.innerStride()),
-                                                                                    actualDestPtr, 1,
-                                                                                    destPolicy.compatible_alpha());
+      parallelize_gemv<Gemv>(actualLhs.rows(), actualLhs.cols(), LhsMapper(actualLhs.data(), actualLhs.outerStride()),
+                             RhsMapper(actualRhs.data(), actualRhs.innerStride()), actualDestPtr, Index(1),
+                             destPolicy.compatible_alpha(), parallel);
 
       destPolicy.copy_back(dest, actualDestPtr);
     }
@@ -389,7 +391,8 @@ struct gemv_dense_selector<OnTheRight, ColMajor, true> {
 template <>
 struct gemv_dense_selector<OnTheRight, RowMajor, true> {
   template <typename Lhs, typename Rhs, typename Dest>
-  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha) {
+  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha,
+                  bool parallel = true) {
     using LhsScalar = typename Lhs::Scalar;
     using RhsScalar = typename Rhs::Scalar;
     using ResScalar = typename Dest::Scalar;
@@ -424,20 +427,20 @@ struct gemv_dense_selector<OnTheRight, RowMajor, true> {
 
     using LhsMapper = const_blas_data_mapper<LhsScalar, Index, RowMajor>;
     using RhsMapper = const_blas_data_mapper<RhsScalar, Index, ColMajor>;
-    general_matrix_vector_product<Index, LhsScalar, LhsMapper, RowMajor, LhsBlasTraits::NeedToConjugate, RhsScalar,
-                                  RhsMapper, RhsBlasTraits::NeedToConjugate>::
-        run(actualLhs.rows(), actualLhs.cols(), LhsMapper(actualLhs.data(), actualLhs.outerStride()),
-            RhsMapper(actualRhsPtr, 1), dest.data(),
-            dest.col(0).innerStride(),  // NOTE  if dest is not a vector at compile-time, then dest.innerStride() might
-                                        // be wrong. (bug 1166)
-            actualAlpha);
+    using Gemv = general_matrix_vector_product<Index, LhsScalar, LhsMapper, RowMajor, LhsBlasTraits::NeedToConjugate,
+                                               RhsScalar, RhsMapper, RhsBlasTraits::NeedToConjugate>;
+    parallelize_gemv<Gemv>(actualLhs.rows(), actualLhs.cols(), LhsMapper(actualLhs.data(), actualLhs.outerStride()),
+                           RhsMapper(actualRhsPtr, 1), dest.data(),
+                           dest.col(0).innerStride(),  // NOTE  if dest is not a vector at compile-time, then
+                                                       // dest.innerStride() might be wrong. (bug 1166)
+                           actualAlpha, parallel);
   }
 };
 
 template <>
 struct gemv_dense_selector<OnTheRight, ColMajor, false> {
   template <typename Lhs, typename Rhs, typename Dest>
-  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha) {
+  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha, bool = true) {
     EIGEN_STATIC_ASSERT((!nested_eval<Lhs, 1>::Evaluate),
                         EIGEN_INTERNAL_COMPILATION_ERROR_OR_YOU_MADE_A_PROGRAMMING_MISTAKE);
     // TODO: if rhs is large enough it might be beneficial to make sure that dest is sequentially stored in memory,
@@ -451,7 +454,7 @@ struct gemv_dense_selector<OnTheRight, ColMajor, false> {
 template <>
 struct gemv_dense_selector<OnTheRight, RowMajor, false> {
   template <typename Lhs, typename Rhs, typename Dest>
-  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha) {
+  static void run(const Lhs& lhs, const Rhs& rhs, Dest& dest, const typename Dest::Scalar& alpha, bool = true) {
     EIGEN_STATIC_ASSERT((!nested_eval<Lhs, 1>::Evaluate),
                         EIGEN_INTERNAL_COMPILATION_ERROR_OR_YOU_MADE_A_PROGRAMMING_MISTAKE);
     typename nested_eval<Rhs, Lhs::RowsAtCompileTime>::type actual_rhs(rhs);
@@ -301,6 +301,15 @@ class ProductImpl<Lhs, Rhs, Option, Dense> : public internal::dense_product_base
 
     return internal::evaluator<Derived>(derived()).coeff(i);
   }
+
+  /** \returns an expression of this product followed by the element-wise \a epilogue, which is
+   * applied by the product kernel as it computes the result.
+   *
+   * \sa class EpilogueProduct, class BiasActivation */
+  template <typename Epilogue>
+  EpilogueProduct<Lhs, Rhs, Epilogue> withEpilogue(const Epilogue& epilogue) const {
+    return EpilogueProduct<Lhs, Rhs, Epilogue>(derived().lhs(), derived().rhs(), epilogue);
+  }
 };
 
 }  // end namespace Eigen
@@ -76,14 +76,6 @@ struct evaluator<Diagonal<const Product<Lhs, Rhs, DefaultProduct>, DiagIndex>>
             Product<Lhs, Rhs, LazyProduct>(xpr.nestedExpression().lhs(), xpr.nestedExpression().rhs()), xpr.index())) {}
 };
 
-// Helper class to perform a matrix product with the destination at hand.
-// Depending on the sizes of the factors, there are different evaluation strategies
-// as controlled by internal::product_type.
-template <typename Lhs, typename Rhs, typename LhsShape = typename evaluator_traits<Lhs>::Shape,
-          typename RhsShape = typename evaluator_traits<Rhs>::Shape,
-          int ProductType = internal::product_type<Lhs, Rhs>::value>
-struct generic_product_impl;
-
 template <typename Lhs, typename Rhs>
 struct evaluator_assume_aliasing<Product<Lhs, Rhs, DefaultProduct>> : std::true_type {};
 
@@ -165,6 +157,45 @@ struct Assignment<DstXprType, Product<Lhs, Rhs, Options>, internal::sub_assign_o
   }
 };
 
+template <typename Lhs, typename Rhs, typename Epilogue>
+struct epilogue_product_impl;
+
+// Dense = Product.withEpilogue()
+template <typename DstXprType, typename Lhs, typename Rhs, typename Epilogue, typename Scalar>
+struct Assignment<DstXprType, EpilogueProduct<Lhs, Rhs, Epilogue>, internal::assign_op<Scalar, Scalar>, Dense2Dense> {
+  using SrcXprType = EpilogueProduct<Lhs, Rhs, Epilogue>;
+  static void run(DstXprType& dst, const SrcXprType& src, const internal::assign_op<Scalar, Scalar>&) {
+    Index dstRows = src.rows();
+    Index dstCols = src.cols();
+    if ((dst.rows() != dstRows) || (dst.cols() != dstCols)) dst.resize(dstRows, dstCols);
+    epilogue_product_impl<typename SrcXprType::LhsNestedCleaned, typename SrcXprType::RhsNestedCleaned,
+                          Epilogue>::evalTo(dst, src.lhs(), src.rhs(), src.epilogue());
+  }
+};
+
+template <typename Lhs, typename Rhs, typename Epilogue>
+struct evaluator_assume_aliasing<EpilogueProduct<Lhs, Rhs, Epilogue>> : std::true_type {};
+
+// Other uses of Product.withEpilogue(), e.g. Dense += Product.withEpilogue(), go through a temporary.
+template <typename Lhs, typename Rhs, typename Epilogue>
+struct evaluator<EpilogueProduct<Lhs, Rhs, Epilogue>>
+    : public evaluator<typename EpilogueProduct<Lhs, Rhs, Epilogue>::PlainObject> {
+  using XprType = EpilogueProduct<Lhs, Rhs, Epilogue>;
+  using PlainObject = typename XprType::PlainObject;
+  using Base = evaluator<PlainObject>;
+
+  enum { Flags = Base::Flags | EvalBeforeNestingBit };
+
+  explicit evaluator(const XprType& xpr) : m_result(xpr.rows(), xpr.cols()) {
+    internal::construct_at<Base>(this, m_result);
+    epilogue_product_impl<typename XprType::LhsNestedCleaned, typename XprType::RhsNestedCleaned, Epilogue>::evalTo(
+        m_result, xpr.lhs(), xpr.rhs(), xpr.epilogue());
+  }
+
+ protected:
+  PlainObject m_result;
+};
+
 // Dense ?= scalar * Product
 // TODO: we should apply that rule if that's really helpful
 // for instance, this is not good for inner products
@@ -432,9 +463,11 @@ struct generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemvProduct>
   enum { Side = Lhs::IsVectorAtCompileTime ? OnTheLeft : OnTheRight };
   using MatrixType = internal::remove_all_t<std::conditional_t<int(Side) == OnTheRight, LhsNested, RhsNested>>;
 
+  // With parallel = false, the product runs on the calling thread only, as needed by callers which already run on
+  // other threads than those of the OpenMP team or of the GEMM ThreadPool (see CoreThreadPoolDevice).
   template <typename Dest>
   static EIGEN_DEVICE_FUNC EIGEN_STRONG_INLINE void scaleAndAddTo(Dest& dst, const Lhs& lhs, const Rhs& rhs,
-                                                                  const Scalar& alpha) {
+                                                                  const Scalar& alpha, bool parallel = true) {
     // Fallback to inner product if both the lhs and rhs is a runtime vector.
     if (lhs.rows() == 1 && rhs.cols() == 1) {
       dst.coeffRef(0, 0) += alpha * lhs.row(0).conjugate().dot(rhs.col(0));
@@ -445,7 +478,7 @@ struct generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemvProduct>
     internal::gemv_dense_selector<Side, (int(MatrixType::Flags) & RowMajorBit) ? RowMajor : ColMajor,
                                   bool(internal::blas_traits<MatrixType>::HasUsableDirectAccess)>::run(actual_lhs,
                                                                                                        actual_rhs, dst,
-                                                                                                       alpha);
+                                                                                                       alpha, parallel);
   }
 };
 
@@ -101,14 +101,27 @@ struct triangular_solver_selector<Lhs, Rhs, Side, Mode, NoUnrolling, Dynamic> {
       return;
     }
 
-    BlockingType blocking(rhs.rows(), rhs.cols(), size, 1, false);
-
-    triangular_solve_matrix<Scalar, Index, Side, Mode, LhsProductTraits::NeedToConjugate,
-                            (int(Lhs::Flags) & RowMajorBit) ? RowMajor : ColMajor,
-                            (Rhs::Flags & RowMajorBit) ? RowMajor : ColMajor,
-                            Rhs::InnerStrideAtCompileTime>::run(size, othersize, &actualLhs.coeffRef(0, 0),
-                                                                actualLhs.outerStride(), &rhs.coeffRef(0, 0),
-                                                                rhs.innerStride(), rhs.outerStride(), blocking);
+    using Solver = triangular_solve_matrix<Scalar, Index, Side, Mode, LhsProductTraits::NeedToConjugate,
+                                           (int(Lhs::Flags) & RowMajorBit) ? RowMajor : ColMajor,
+                                           (Rhs::Flags & RowMajorBit) ? RowMajor : ColMajor,
+                                           Rhs::InnerStrideAtCompileTime>;
+
+    // The right hand sides (the columns of rhs when solving on the left, its rows otherwise) are independent, so
+    // large solves are split into blocks of them, each solved by one thread with its own blocking.
+    const Index blockSize = 4 * plain_enum_max(gebp_traits<Scalar, Scalar>::mr, gebp_traits<Scalar, Scalar>::nr);
+    const Index blocks = numext::div_ceil(othersize, blockSize);
+    auto task = [&](Index begin, Index end) {
+      const Index first = begin * blockSize;
+      const Index actualOthersize = numext::mini(othersize, end * blockSize) - first;
+      Scalar* other = Side == OnTheLeft ? &rhs.coeffRef(0, first) : &rhs.coeffRef(first, 0);
+      BlockingType blocking(Side == OnTheLeft ? rhs.rows() : actualOthersize,
+                            Side == OnTheLeft ? actualOthersize : rhs.cols(), size, 1, false);
+      Solver::run(size, actualOthersize, &actualLhs.coeffRef(0, 0), actualLhs.outerStride(), other, rhs.innerStride(),
+                  rhs.outerStride(), blocking);
+    };
+
+    const double work = static_cast<double>(size) * static_cast<double>(size) * static_cast<double>(othersize);
+    parallelize_range(task, blocks, parallel_threads_for_work(work));
   }
 };
 
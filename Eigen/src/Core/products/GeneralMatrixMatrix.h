@@ -112,6 +112,19 @@ struct general_matrix_matrix_product<Index, LhsScalar, LhsStorageOrder, Conjugat
                                   ResInnerStride>::run(cols, rows, depth, rhs, rhsStride, lhs, lhsStride, res, resIncr,
                                                        resStride, alpha, blocking, info);
   }
+
+#if !defined(EIGEN_USE_BLAS) && (defined(EIGEN_HAS_OPENMP) || defined(EIGEN_GEMM_THREADPOOL))
+  template <typename Launcher>
+  static void run_tiled(Index rows, Index cols, Index depth, const LhsScalar* lhs, Index lhsStride,
+                        const RhsScalar* rhs, Index rhsStride, ResScalar* res, Index resIncr, Index resStride,
+                        ResScalar alpha, level3_blocking<RhsScalar, LhsScalar>& blocking, int threads,
+                        const Launcher& launch) {
+    general_matrix_matrix_product<Index, RhsScalar, RhsStorageOrder == RowMajor ? ColMajor : RowMajor, ConjugateRhs,
+                                  LhsScalar, LhsStorageOrder == RowMajor ? ColMajor : RowMajor, ConjugateLhs, ColMajor,
+                                  ResInnerStride>::run_tiled(cols, rows, depth, rhs, rhsStride, lhs, lhsStride, res,
+                                                             resIncr, resStride, alpha, blocking, threads, launch);
+  }
+#endif
 };
 
 /*  Specialization for a col-major destination matrix
@@ -243,6 +256,88 @@ struct general_matrix_matrix_product<Index, LhsScalar, LhsStorageOrder, Conjugat
                               alpha);
     }
   }
+
+#if !defined(EIGEN_USE_BLAS) && (defined(EIGEN_HAS_OPENMP) || defined(EIGEN_GEMM_THREADPOOL))
+  // Dynamically scheduled parallel version (see setGemmDynamicScheduling()).
+  // The result is cut into mc x nc tiles that the workers started by launch(worker) grab one at a time from a shared
+  // counter, so that a worker which gets preempted only holds back the tile it is working on instead of a static
+  // slab of the result. Tiles are enumerated column by column, so that concurrent tiles mostly belong to different
+  // block rows. Each mc x kc block of the lhs is packed once by the first tile needing it and is shared by all the
+  // tiles of its block row through a reference count; a tile finding the block being packed by another worker packs
+  // a private copy rather than waiting for it.
+  template <typename Launcher>
+  static void run_tiled(Index rows, Index cols, Index depth, const LhsScalar* lhs_, Index lhsStride,
+                        const RhsScalar* rhs_, Index rhsStride, ResScalar* res_, Index resIncr, Index resStride,
+                        ResScalar alpha, level3_blocking<LhsScalar, RhsScalar>& blocking, int threads,
+                        const Launcher& launch) {
+    if (numext::is_exactly_zero(alpha)) return;
+
+    using LhsMapper = const_blas_data_mapper<LhsScalar, Index, LhsStorageOrder>;
+    using RhsMapper = const_blas_data_mapper<RhsScalar, Index, RhsStorageOrder>;
+    using ResMapper = blas_data_mapper<typename Traits::ResScalar, Index, ColMajor, Unaligned, ResInnerStride>;
+    LhsMapper lhs(lhs_, lhsStride);
+    RhsMapper rhs(rhs_, rhsStride);
+    ResMapper res(res_, resStride, resIncr);
+
+    const Index kc = blocking.kc();
+    const Index mc = (std::min)(rows, blocking.mc());
+    const Index mb = numext::div_ceil(rows, mc), kb = numext::div_ceil(depth, kc);
+    // Cut the columns finely enough for every worker to have several tiles to pick from.
+    const Index nbTarget = numext::div_ceil(Index(4 * threads), mb);
+    const Index nc = (std::min)((std::min)(cols, blocking.nc()),
+                                numext::div_ceil(numext::div_ceil(cols, nbTarget), Index(Traits::nr)) * Traits::nr);
+    const Index nb = numext::div_ceil(cols, nc);
+    const Index numTiles = mb * nb;
+
+    struct SharedBlock {
+      std::atomic<int> state{0};  // 0: not packed, 1: being packed, 2: packed
+      std::atomic<Index> users{0};
+      LhsScalar* data = nullptr;
+    };
+    std::unique_ptr<SharedBlock[]> blocks(new SharedBlock[mb * kb]);
+    for (Index b = 0; b < mb * kb; ++b) blocks[b].users.store(nb, std::memory_order_relaxed);
+    std::atomic<Index> nextTile{0};
+
+    auto worker = [&]() {
+      gemm_pack_lhs<LhsScalar, Index, LhsMapper, Traits::mr, Traits::LhsProgress, typename Traits::LhsPacket4Packing,
+                    LhsStorageOrder>
+          pack_lhs;
+      gemm_pack_rhs<RhsScalar, Index, RhsMapper, Traits::nr, RhsStorageOrder> pack_rhs;
+      gebp_kernel<LhsScalar, RhsScalar, Index, ResMapper, Traits::mr, Traits::nr, ConjugateLhs, ConjugateRhs> gebp;
+      ei_declare_aligned_stack_constructed_variable(LhsScalar, privateA, kc * mc, 0);
+      ei_declare_aligned_stack_constructed_variable(RhsScalar, blockB, kc * nc, 0);
+
+      for (Index t = nextTile++; t < numTiles; t = nextTile++) {
+        const Index i2 = (t % mb) * mc, actual_mc = (std::min)(i2 + mc, rows) - i2;
+        const Index j2 = (t / mb) * nc, actual_nc = (std::min)(j2 + nc, cols) - j2;
+        for (Index k = 0; k < kb; ++k) {
+          const Index k2 = k * kc, actual_kc = (std::min)(k2 + kc, depth) - k2;
+          SharedBlock& block = blocks[(t % mb) * kb + k];
+          const LhsScalar* blockA = privateA;
+          int state = 0;
+          if (block.state.compare_exchange_strong(state, 1, std::memory_order_acquire)) {
+            block.data = aligned_new<LhsScalar>(actual_mc * actual_kc);
+            pack_lhs(block.data, lhs.getSubMapper(i2, k2), actual_kc, actual_mc);
+            block.state.store(2, std::memory_order_release);
+            blockA = block.data;
+          } else if (state == 2) {
+            blockA = block.data;
+          } else {
+            pack_lhs(privateA, lhs.getSubMapper(i2, k2), actual_kc, actual_mc);
+          }
+
+          pack_rhs(blockB, rhs.getSubMapper(k2, j2), actual_kc, actual_nc);
+          gebp(res.getSubMapper(i2, j2), blockA, blockB, actual_mc, actual_kc, actual_nc, alpha);
+
+          // The last tile of the block row releases the shared block.
+          if (block.users.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            aligned_delete(block.data, block.data ? actual_mc * actual_kc : 0);
+        }
+      }
+    };
+    launch(worker);
+  }
+#endif  // !defined(EIGEN_USE_BLAS) && (defined(EIGEN_HAS_OPENMP) || defined(EIGEN_GEMM_THREADPOOL))
 };
 
 /*********************************************************************************
@@ -261,6 +356,17 @@ struct gemm_functor {
     m_blocking.allocateA();
   }
 
+#if !defined(EIGEN_USE_BLAS) && (defined(EIGEN_HAS_OPENMP) || defined(EIGEN_GEMM_THREADPOOL))
+  // Evaluates the whole product with dynamically scheduled tiles, launch(worker) running worker() on each of the
+  // (at most) num_threads threads.
+  template <typename Launcher>
+  void runTiled(int num_threads, const Launcher& launch) const {
+    Gemm::run_tiled(m_lhs.rows(), m_rhs.cols(), m_lhs.cols(), &m_lhs.coeffRef(0, 0), m_lhs.outerStride(),
+                    &m_rhs.coeffRef(0, 0), m_rhs.outerStride(), (Scalar*)&(m_dest.coeffRef(0, 0)),
+                    m_dest.innerStride(), m_dest.outerStride(), m_actualAlpha, m_blocking, num_threads, launch);
+  }
+#endif
+
   void operator()(Index row, Index rows, Index col = 0, Index cols = -1, GemmParallelInfo<Index>* info = 0) const {
     if (cols == -1) cols = m_rhs.cols();
 
@@ -279,6 +385,51 @@ struct gemm_functor {
   BlockingType& m_blocking;
 };
 
+// Base of the parallelize_gemm functors whose calls func(row, rows, col, cols) evaluate independent blocks of the
+// result and pack their own panels. It provides their dynamic scheduling: the workers grab panels of columns of the
+// result (of rows if Derived::TiledByRows) one at a time from a shared counter. Derived provides rows() and cols(),
+// the size of the result.
+template <typename Derived>
+struct gemm_panel_tiled_functor {
+#if !defined(EIGEN_USE_BLAS) && (defined(EIGEN_HAS_OPENMP) || defined(EIGEN_GEMM_THREADPOOL))
+  template <typename Launcher>
+  void runTiled(int num_threads, const Launcher& launch) const {
+    const Derived& func = static_cast<const Derived&>(*this);
+    const bool byRows = bool(Derived::TiledByRows);
+    const Index rows = func.rows(), cols = func.cols();
+    const Index size = byRows ? rows : cols;
+    const Index align = byRows ? Index(Derived::Traits::mr) : Index(Derived::Traits::nr);
+    const Index chunk = numext::maxi(align, (numext::div_ceil(size, Index(4 * num_threads)) / align) * align);
+    std::atomic<Index> next{0};
+    launch([&]() {
+      for (Index start = next.fetch_add(chunk); start < size; start = next.fetch_add(chunk)) {
+        const Index length = numext::mini(chunk, size - start);
+        if (byRows)
+          func(start, length, 0, cols);
+        else
+          func(0, rows, start, length);
+      }
+    });
+  }
+#endif
+};
+
+#ifdef EIGEN_GEMM_AUTOTUNE
+template <typename LhsScalar, typename RhsScalar, int KcFactor>
+bool gemm_autotuned_blocking_sizes(Index& k, Index& m, Index& n);
+#endif
+
+// Products of bfloat16/half operands cast to float, see GeneralMatrixMatrixFloat16.h
+template <typename Lhs, typename Rhs, typename Dest>
+struct gemm_float16_product_enabled;
+template <typename Lhs, typename Rhs, typename Dest, bool Enabled>
+struct gemm_float16_product;
+// Products of int8 operands cast to int32, see GeneralMatrixMatrixInt8.h
+template <typename Lhs, typename Rhs, typename Dest>
+struct gemm_int8_product_enabled;
+template <typename Lhs, typename Rhs, typename Dest, bool Enabled>
+struct gemm_int8_product;
+
 template <int StorageOrder, typename LhsScalar, typename RhsScalar, int MaxRows, int MaxCols, int MaxDepth,
           int KcFactor = 1, bool FiniteAtCompileTime = MaxRows != Dynamic && MaxCols != Dynamic && MaxDepth != Dynamic>
 class gemm_blocking_space;
@@ -373,7 +524,14 @@ class gemm_blocking_space<StorageOrder, LhsScalar_, RhsScalar_, MaxRows, MaxCols
     this->m_kc = depth;
 
     if (l3_blocking) {
-      computeProductBlockingSizes<LhsScalar, RhsScalar, KcFactor>(this->m_kc, this->m_mc, this->m_nc, num_threads);
+      bool tuned = false;
+#ifdef EIGEN_GEMM_AUTOTUNE
+      // Multi-threaded products recompute their blocking in initParallel() anyway.
+      tuned = num_threads == 1 &&
+              gemm_autotuned_blocking_sizes<LhsScalar, RhsScalar, KcFactor>(this->m_kc, this->m_mc, this->m_nc);
+#endif
+      if (!tuned)
+        computeProductBlockingSizes<LhsScalar, RhsScalar, KcFactor>(this->m_kc, this->m_mc, this->m_nc, num_threads);
     } else  // no l3 blocking
     {
       Index n = this->m_nc;
@@ -474,6 +632,18 @@ struct generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemmProduct>
 
   template <typename Dest>
   static void scaleAndAddTo(Dest& dst, const Lhs& a_lhs, const Rhs& a_rhs, const Scalar& alpha) {
+    scaleAndAddTo(dst, a_lhs, a_rhs, alpha, [](const auto& func, Index rows, Index cols, Index depth, bool transpose) {
+      internal::parallelize_gemm<(Dest::MaxRowsAtCompileTime > 32 || Dest::MaxRowsAtCompileTime == Dynamic)>(
+          func, rows, cols, depth, transpose);
+    });
+  }
+
+  // Same as above, but the gemm functor is evaluated by parallelize(func, rows, cols, depth, transpose), which must
+  // cover the whole rows x cols result by calls to func(row, rows, col, cols). This is how products evaluated on a
+  // device (see EigenBase::device()) use the threads of that device instead of those of parallelize_gemm.
+  template <typename Dest, typename Parallelizer>
+  static void scaleAndAddTo(Dest& dst, const Lhs& a_lhs, const Rhs& a_rhs, const Scalar& alpha,
+                            const Parallelizer& parallelize) {
     eigen_assert(dst.rows() == a_lhs.rows() && dst.cols() == a_rhs.cols());
     if (a_lhs.cols() == 0 || a_lhs.rows() == 0 || a_rhs.cols() == 0) return;
 
@@ -489,6 +659,21 @@ struct generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemmProduct>
                                             GemvProduct>::scaleAndAddTo(dst_vec, a_lhs.row(0), a_rhs, alpha);
     }
 
+    // Casts of bfloat16/half operands to float are widened while packing instead of being evaluated into temporaries.
+    using Float16Product =
+        internal::gemm_float16_product<Lhs, Rhs, Dest, internal::gemm_float16_product_enabled<Lhs, Rhs, Dest>::value>;
+    EIGEN_IF_CONSTEXPR(Float16Product::value) {
+      Float16Product::run(dst, a_lhs, a_rhs, alpha, parallelize);
+      return;
+    }
+    // Same for casts of int8 operands to int32, which use the int8 dot-product kernels.
+    using Int8Product =
+        internal::gemm_int8_product<Lhs, Rhs, Dest, internal::gemm_int8_product_enabled<Lhs, Rhs, Dest>::value>;
+    EIGEN_IF_CONSTEXPR(Int8Product::value) {
+      Int8Product::run(dst, a_lhs, a_rhs, alpha, parallelize);
+      return;
+    }
+
     add_const_on_value_type_t<ActualLhsType> lhs = LhsBlasTraits::extract(a_lhs);
     add_const_on_value_type_t<ActualRhsType> rhs = RhsBlasTraits::extract(a_rhs);
 
@@ -508,9 +693,8 @@ struct generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemmProduct>
         ActualLhsTypeCleaned, ActualRhsTypeCleaned, Dest, BlockingType>;
 
     BlockingType blocking(dst.rows(), dst.cols(), lhs.cols(), 1, true);
-    internal::parallelize_gemm<(Dest::MaxRowsAtCompileTime > 32 || Dest::MaxRowsAtCompileTime == Dynamic)>(
-        GemmFunctor(lhs, rhs, dst, actualAlpha, blocking), a_lhs.rows(), a_rhs.cols(), a_lhs.cols(),
-        Dest::Flags & RowMajorBit);
+    parallelize(GemmFunctor(lhs, rhs, dst, actualAlpha, blocking), a_lhs.rows(), a_rhs.cols(), a_lhs.cols(),
+                bool(Dest::Flags & RowMajorBit));
   }
 };
 
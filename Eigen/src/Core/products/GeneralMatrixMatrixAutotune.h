@@ -0,0 +1,330 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_GENERAL_MATRIX_MATRIX_AUTOTUNE_H
+#define EIGEN_GENERAL_MATRIX_MATRIX_AUTOTUNE_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+#ifndef EIGEN_GEMM_AUTOTUNE_CACHE_SIZE
+#define EIGEN_GEMM_AUTOTUNE_CACHE_SIZE 256
+#endif
+
+namespace Eigen {
+
+namespace internal {
+
+/* Runtime autotuning of the GEMM blocking sizes (EIGEN_GEMM_AUTOTUNE).
+ *
+ * tuneGemmBlockingSizes() times a few kc/mc/nc triples around the cache-size heuristic of
+ * computeProductBlockingSizes for a given kernel (scalar types and mr x nr register block) and shape class, and
+ * remembers the fastest one. A shape class rounds each of k, m and n up to a power of two; the candidates are
+ * timed on a product of exactly that size, capped to gemm_autotune_max_trial_size along each dimension, so that
+ * the choice does not depend on which member of the class is tuned. The winners live in a small LRU table that can
+ * be saved to and restored from a text file (see saveGemmBlockingSizes()). Sequential products only look the table
+ * up: they never time anything themselves. */
+
+// Identifies a scalar type by its size, kind, and number of mantissa digits.
+template <typename Scalar>
+inline int gemm_autotune_scalar_code() {
+  return int(sizeof(Scalar)) | (int(NumTraits<Scalar>::IsComplex) << 8) | (int(NumTraits<Scalar>::IsInteger) << 9) |
+         (NumTraits<Scalar>::digits() << 10);
+}
+
+// Smallest b such that 2^b >= size.
+inline int gemm_autotune_size_class(Index size) {
+  int b = 0;
+  while ((Index(1) << b) < size) ++b;
+  return b;
+}
+
+const Index gemm_autotune_max_trial_size = 512;
+
+struct gemm_blocking_key {
+  int lhs, rhs, mr, nr, kcFactor, k, m, n;
+
+  bool operator==(const gemm_blocking_key& o) const {
+    return lhs == o.lhs && rhs == o.rhs && mr == o.mr && nr == o.nr && kcFactor == o.kcFactor && k == o.k &&
+           m == o.m && n == o.n;
+  }
+};
+
+struct gemm_blocking_key_hash {
+  std::size_t operator()(const gemm_blocking_key& key) const noexcept {
+    const int fields[] = {key.lhs, key.rhs, key.mr, key.nr, key.kcFactor, key.k, key.m, key.n};
+    std::size_t h = 0;
+    for (int f : fields) h = h * 31u + std::hash<int>{}(f);
+    return h;
+  }
+};
+
+struct gemm_blocking_sizes {
+  Index kc, mc, nc;
+};
+
+struct gemm_blocking_table {
+  std::mutex mutex;
+  LruCache<gemm_blocking_key, gemm_blocking_sizes, gemm_blocking_key_hash> cache{EIGEN_GEMM_AUTOTUNE_CACHE_SIZE};
+  std::atomic<bool> enabled{true};
+};
+
+inline gemm_blocking_table& gemm_autotuned_blocking_table() {
+  static gemm_blocking_table table;
+  return table;
+}
+
+// A level3_blocking with prescribed sizes, owning its packing buffers.
+template <typename LhsScalar, typename RhsScalar>
+class gemm_autotune_blocking : public level3_blocking<LhsScalar, RhsScalar> {
+ public:
+  gemm_autotune_blocking(Index kc, Index mc, Index nc) {
+    this->m_kc = kc;
+    this->m_mc = mc;
+    this->m_nc = nc;
+    this->m_blockA = aligned_new<LhsScalar>(mc * kc);
+    this->m_blockB = aligned_new<RhsScalar>(kc * nc);
+  }
+
+  ~gemm_autotune_blocking() {
+    aligned_delete(this->m_blockA, this->m_mc * this->m_kc);
+    aligned_delete(this->m_blockB, this->m_kc * this->m_nc);
+  }
+};
+
+template <typename LhsScalar, typename RhsScalar, int KcFactor>
+struct gemm_blocking_autotuner {
+  using Traits = gebp_traits<LhsScalar, RhsScalar>;
+  using Gemm =
+      general_matrix_matrix_product<Index, LhsScalar, ColMajor, false, RhsScalar, ColMajor, false, ColMajor, 1>;
+  using ResScalar = typename Gemm::ResScalar;
+
+  static gemm_blocking_key key(Index k, Index m, Index n) {
+    return gemm_blocking_key{gemm_autotune_scalar_code<LhsScalar>(),
+                             gemm_autotune_scalar_code<RhsScalar>(),
+                             int(Traits::mr),
+                             int(Traits::nr),
+                             KcFactor,
+                             gemm_autotune_size_class(k),
+                             gemm_autotune_size_class(m),
+                             gemm_autotune_size_class(n)};
+  }
+
+  // Rounds a candidate block size down to a multiple of align, or up to the whole dimension.
+  static Index fit(Index block, Index size, Index align) {
+    block = numext::maxi(block, align);
+    return block >= size ? size : block - block % align;
+  }
+
+  // Best of three timings, in seconds, of a batch of products with the given blocking.
+  static double time(const gemm_blocking_sizes& sizes, Index k, Index m, Index n, const LhsScalar* lhs,
+                     const RhsScalar* rhs, ResScalar* res, int reps) {
+    gemm_autotune_blocking<LhsScalar, RhsScalar> blocking(sizes.kc, sizes.mc, sizes.nc);
+    double best = (std::numeric_limits<double>::max)();
+    for (int trial = 0; trial < 3; ++trial) {
+      const auto start = std::chrono::steady_clock::now();
+      for (int r = 0; r < reps; ++r)
+        Gemm::run(m, n, k, lhs, m, rhs, k, res, 1, m, ResScalar(1), blocking);
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      best = numext::mini(best, elapsed.count());
+    }
+    return best;
+  }
+
+  // Times the candidates in turn, the heuristic first, until maxSeconds have been spent, and returns the fastest.
+  static gemm_blocking_sizes run(const gemm_blocking_key& key, double maxSeconds) {
+    const Index k = numext::mini(Index(1) << key.k, gemm_autotune_max_trial_size);
+    const Index m = numext::mini(Index(1) << key.m, gemm_autotune_max_trial_size);
+    const Index n = numext::mini(Index(1) << key.n, gemm_autotune_max_trial_size);
+
+    Index k0 = k, m0 = m, n0 = n;
+    evaluateProductBlockingSizesHeuristic<LhsScalar, RhsScalar, KcFactor, Index>(k0, m0, n0, 1);
+
+    // Scalings of (kc, mc, nc), in halves, around the heuristic.
+    const int scales[][3] = {{2, 2, 2}, {1, 2, 2}, {4, 2, 2}, {2, 1, 2}, {2, 4, 2}, {2, 2, 1}, {1, 4, 2}, {4, 1, 2}};
+    std::vector<gemm_blocking_sizes> candidates;
+    for (const auto& s : scales) {
+      const gemm_blocking_sizes c{fit(k0 * s[0] / 2, k, 8), fit(m0 * s[1] / 2, m, Traits::mr),
+                                  fit(n0 * s[2] / 2, n, Traits::nr)};
+      bool duplicate = false;
+      for (const auto& other : candidates)
+        duplicate = duplicate || (other.kc == c.kc && other.mc == c.mc && other.nc == c.nc);
+      if (!duplicate) candidates.push_back(c);
+    }
+    if (candidates.size() == 1) return candidates[0];
+
+    using LhsMatrix = Matrix<LhsScalar, Dynamic, Dynamic>;
+    using RhsMatrix = Matrix<RhsScalar, Dynamic, Dynamic>;
+    using ResMatrix = Matrix<ResScalar, Dynamic, Dynamic>;
+    const LhsMatrix lhs = LhsMatrix::Ones(m, k);
+    const RhsMatrix rhs = RhsMatrix::Ones(k, n);
+    ResMatrix res = ResMatrix::Zero(m, n);
+
+    // Repeat small products so that each timing covers at least about 2^26 multiply-adds.
+    const double work = double(m) * double(n) * double(k);
+    const int reps = int(numext::maxi(1.0, 67108864.0 / work));
+
+    const auto start = std::chrono::steady_clock::now();
+    gemm_blocking_sizes best = candidates[0];
+    double bestTime = (std::numeric_limits<double>::max)();
+    for (const auto& c : candidates) {
+      const double t = time(c, k, m, n, lhs.data(), rhs.data(), res.data(), reps);
+      if (t < bestTime) {
+        bestTime = t;
+        best = c;
+      }
+      const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+      if (elapsed.count() >= maxSeconds) break;
+    }
+    return best;
+  }
+};
+
+// Whether the blocking sizes of a k x m x n product are worth tuning.
+template <typename LhsScalar, typename RhsScalar>
+bool gemm_autotune_applies(Index k, Index m, Index n) {
+#ifdef EIGEN_TEST_SPECIFIC_BLOCKING_SIZES
+  if (EIGEN_TEST_SPECIFIC_BLOCKING_SIZES) return false;
+#endif
+  // Custom scalar types run the generic kernel, and small products are not blocked at all.
+  return packet_traits<LhsScalar>::Vectorizable && packet_traits<RhsScalar>::Vectorizable &&
+         (numext::maxi)(k, (numext::maxi)(m, n)) >= 48;
+}
+
+/* Sets k, m and n to the tuned blocking sizes of a sequential k x m x n product, if its shape class has been tuned
+ * by tuneGemmBlockingSizes() or loaded by loadGemmBlockingSizes(). This only looks the table up.
+ * \returns false, leaving k, m and n unchanged, if autotuning is disabled or no sizes are known for this product. */
+template <typename LhsScalar, typename RhsScalar, int KcFactor>
+bool gemm_autotuned_blocking_sizes(Index& k, Index& m, Index& n) {
+  if (!gemm_autotune_applies<LhsScalar, RhsScalar>(k, m, n)) return false;
+  gemm_blocking_table& table = gemm_autotuned_blocking_table();
+  if (!table.enabled.load(std::memory_order_relaxed)) return false;
+
+  const gemm_blocking_key key = gemm_blocking_autotuner<LhsScalar, RhsScalar, KcFactor>::key(k, m, n);
+  gemm_blocking_sizes sizes;
+  {
+    std::lock_guard<std::mutex> lock(table.mutex);
+    const gemm_blocking_sizes* cached = table.cache.find(key);
+    if (!cached) return false;
+    sizes = *cached;
+  }
+  k = numext::mini(k, sizes.kc);
+  m = numext::mini(m, sizes.mc);
+  n = numext::mini(n, sizes.nc);
+  return true;
+}
+
+}  // end namespace internal
+
+/** \ingroup Core_Module
+ *
+ * Tunes the blocking sizes of the sequential products of a \a rows x \a depth matrix of \c LhsScalar by a
+ * \a depth x \a cols matrix of \c RhsScalar into a column-major result (swap \a rows and \a cols for a row-major
+ * one). A few candidate blockings around the cache-size heuristic of %Eigen are timed on the calling thread, on a
+ * product of the shape class of these dimensions (each rounded up to a power of two, and capped to 512), and the
+ * fastest one is used by all later products of that class while setGemmBlockingAutotuning() is enabled.
+ *
+ * The candidates are timed in turn until \a maxSeconds have been spent, so that the cost of a call exceeds it by at
+ * most the timing of one candidate. Products never tune themselves: without a call to this function or to
+ * loadGemmBlockingSizes(), they use the heuristic.
+ *
+ * \returns false, without timing anything, if the product is too small or of scalar types without vectorized
+ * kernels to be tuned.
+ * \sa setGemmBlockingAutotuning(), saveGemmBlockingSizes(), loadGemmBlockingSizes() */
+template <typename LhsScalar, typename RhsScalar = LhsScalar>
+bool tuneGemmBlockingSizes(Index rows, Index cols, Index depth, double maxSeconds = 0.5) {
+  if (!internal::gemm_autotune_applies<LhsScalar, RhsScalar>(depth, rows, cols)) return false;
+  using Autotuner = internal::gemm_blocking_autotuner<LhsScalar, RhsScalar, 1>;
+  const internal::gemm_blocking_key key = Autotuner::key(depth, rows, cols);
+  const internal::gemm_blocking_sizes sizes = Autotuner::run(key, maxSeconds);
+  internal::gemm_blocking_table& table = internal::gemm_autotuned_blocking_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  table.cache.insert(key, sizes);
+  return true;
+}
+
+/** \ingroup Core_Module
+ *
+ * Enables or disables the use of the tuned blocking sizes by matrix-matrix products. It is enabled by default when
+ * \c EIGEN_GEMM_AUTOTUNE is defined. Disabling it restores the heuristic but keeps the tuned sizes.
+ *
+ * \sa gemmBlockingAutotuning(), tuneGemmBlockingSizes(), saveGemmBlockingSizes(), loadGemmBlockingSizes() */
+inline void setGemmBlockingAutotuning(bool enable) {
+  internal::gemm_autotuned_blocking_table().enabled.store(enable, std::memory_order_relaxed);
+}
+
+/** \returns whether the blocking sizes of matrix-matrix products are autotuned
+ * \sa setGemmBlockingAutotuning() */
+inline bool gemmBlockingAutotuning() {
+  return internal::gemm_autotuned_blocking_table().enabled.load(std::memory_order_relaxed);
+}
+
+/** Forgets all the autotuned blocking sizes.
+ * \sa setGemmBlockingAutotuning() */
+inline void clearGemmBlockingSizes() {
+  internal::gemm_blocking_table& table = internal::gemm_autotuned_blocking_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  table.cache.clear();
+}
+
+/** Writes the autotuned blocking sizes to the text file \a filename, so that a later run on the same machine can
+ * restore them with loadGemmBlockingSizes() instead of calling tuneGemmBlockingSizes() again. The entries are specific to the
+ * kernels, and thus to the instruction set, the program was compiled for, and to the caches of the machine.
+ *
+ * \returns false if the file could not be written.
+ * \sa loadGemmBlockingSizes(), setGemmBlockingAutotuning() */
+inline bool saveGemmBlockingSizes(const char* filename) {
+  std::FILE* file = std::fopen(filename, "w");
+  if (!file) return false;
+  bool ok = std::fprintf(file, "# Eigen GEMM blocking sizes: lhs rhs mr nr kcfactor k m n kc mc nc\n") > 0;
+  internal::gemm_blocking_table& table = internal::gemm_autotuned_blocking_table();
+  {
+    std::lock_guard<std::mutex> lock(table.mutex);
+    table.cache.forEach([&](const internal::gemm_blocking_key& key, const internal::gemm_blocking_sizes& sizes) {
+      ok = ok && std::fprintf(file, "%d %d %d %d %d %d %d %d %lld %lld %lld\n", key.lhs, key.rhs, key.mr, key.nr,
+                              key.kcFactor, key.k, key.m, key.n, static_cast<long long>(sizes.kc),
+                              static_cast<long long>(sizes.mc), static_cast<long long>(sizes.nc)) > 0;
+    });
+  }
+  return std::fclose(file) == 0 && ok;
+}
+
+/** Adds the blocking sizes stored in \a filename by saveGemmBlockingSizes() to the autotuned ones, typically at
+ * the start of a program. Entries of other scalar types or kernels are kept but never used.
+ *
+ * \returns false, without changing the autotuned sizes, if the file could not be read or is malformed.
+ * \sa saveGemmBlockingSizes(), setGemmBlockingAutotuning() */
+inline bool loadGemmBlockingSizes(const char* filename) {
+  std::FILE* file = std::fopen(filename, "r");
+  if (!file) return false;
+  std::vector<std::pair<internal::gemm_blocking_key, internal::gemm_blocking_sizes>> entries;
+  bool ok = true;
+  char line[256];
+  while (ok && std::fgets(line, sizeof(line), file)) {
+    if (line[0] == '#' || line[0] == '\n') continue;
+    internal::gemm_blocking_key key;
+    long long kc, mc, nc;
+    ok = std::sscanf(line, "%d %d %d %d %d %d %d %d %lld %lld %lld", &key.lhs, &key.rhs, &key.mr, &key.nr,
+                     &key.kcFactor, &key.k, &key.m, &key.n, &kc, &mc, &nc) == 11 &&
+         kc > 0 && mc > 0 && nc > 0;
+    if (ok) entries.emplace_back(key, internal::gemm_blocking_sizes{Index(kc), Index(mc), Index(nc)});
+  }
+  ok = !std::ferror(file) && ok;
+  std::fclose(file);
+  if (!ok) return false;
+
+  internal::gemm_blocking_table& table = internal::gemm_autotuned_blocking_table();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  for (const auto& entry : entries) table.cache.insert(entry.first, entry.second);
+  return true;
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_GENERAL_MATRIX_MATRIX_AUTOTUNE_H
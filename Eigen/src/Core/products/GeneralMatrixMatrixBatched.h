@@ -0,0 +1,166 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_GENERAL_MATRIX_MATRIX_BATCHED_H
+#define EIGEN_GENERAL_MATRIX_MATRIX_BATCHED_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+/* Batched GEMM over a strided sequence of equally shaped products:
+ *   dst_b = lhs_b * rhs_b,  b = 0, ..., batchSize - 1
+ * where X_b has the shape and strides of X and starts at X.data() + b * XBatchStride.
+ *
+ * Compared to a loop of dst.noalias() = lhs * rhs, the blocking sizes and the
+ * packing buffers are computed and allocated once per thread instead of once per
+ * product, and the batch dimension is split across threads by parallelize_range.
+ * When one operand is shared by the whole batch (batch stride 0) and the other
+ * operand and the destination are laid out back to back, the batch collapses into
+ * a single wide GEMM so that the packed panels of the shared operand are reused
+ * across the batch. */
+template <typename Lhs, typename Rhs, typename Dst>
+struct batched_gemm_impl {
+  using Scalar = typename Dst::Scalar;
+  enum {
+    LhsOrder = (Lhs::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    RhsOrder = (Rhs::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    DstOrder = (Dst::Flags & RowMajorBit) ? RowMajor : ColMajor
+  };
+
+  using Gemm = general_matrix_matrix_product<Index, Scalar, LhsOrder, false, Scalar, RhsOrder, false, DstOrder,
+                                             Dst::InnerStrideAtCompileTime>;
+  using BlockingType = gemm_blocking_space<DstOrder, Scalar, Scalar, Dynamic, Dynamic, Dynamic>;
+
+  using LhsMap = Map<const Matrix<Scalar, Dynamic, Dynamic, LhsOrder>, Unaligned, OuterStride<>>;
+  using RhsMap = Map<const Matrix<Scalar, Dynamic, Dynamic, RhsOrder>, Unaligned, OuterStride<>>;
+  using DstStride = Stride<Dynamic, Dst::InnerStrideAtCompileTime>;
+  using DstMap = Map<Matrix<Scalar, Dynamic, Dynamic, DstOrder>, Unaligned, DstStride>;
+
+  static void run(const Lhs& lhs, const Rhs& rhs, Dst& dst, Index batchSize, Index lhsBatchStride,
+                  Index rhsBatchStride, Index dstBatchStride) {
+    const Index rows = dst.rows(), cols = dst.cols(), depth = lhs.cols();
+    if (batchSize == 0 || rows == 0 || cols == 0) return;
+
+    const Scalar* lhsData = lhs.data();
+    const Scalar* rhsData = rhs.data();
+    Scalar* dstData = dst.data();
+    const Index lhsStride = lhs.outerStride(), rhsStride = rhs.outerStride();
+    const Index dstIncr = dst.innerStride(), dstStride = dst.outerStride();
+
+    auto dstMap = [&](Index b, Index r, Index c) {
+      return DstMap(dstData + b * dstBatchStride, r, c, DstStride(dstStride, dstIncr));
+    };
+
+    if (depth == 0) {
+      for (Index b = 0; b < batchSize; ++b) dstMap(b, rows, cols).setZero();
+      return;
+    }
+
+    // Shared lhs, column-major rhs and destination stored back to back: a single rows x (batchSize * cols) product.
+    if (lhsBatchStride == 0 && int(RhsOrder) == ColMajor && int(DstOrder) == ColMajor && dstIncr == 1 &&
+        rhsBatchStride == cols * rhsStride && dstBatchStride == cols * dstStride) {
+      dstMap(0, rows, batchSize * cols).noalias() =
+          LhsMap(lhsData, rows, depth, OuterStride<>(lhsStride)) *
+          RhsMap(rhsData, depth, batchSize * cols, OuterStride<>(rhsStride));
+      return;
+    }
+    // Shared rhs, row-major lhs and destination stored back to back: a single (batchSize * rows) x cols product.
+    if (rhsBatchStride == 0 && int(LhsOrder) == RowMajor && int(DstOrder) == RowMajor && dstIncr == 1 &&
+        lhsBatchStride == rows * lhsStride && dstBatchStride == rows * dstStride) {
+      dstMap(0, batchSize * rows, cols).noalias() =
+          LhsMap(lhsData, batchSize * rows, depth, OuterStride<>(lhsStride)) *
+          RhsMap(rhsData, depth, cols, OuterStride<>(rhsStride));
+      return;
+    }
+
+    // Same size heuristic as generic_product_impl<..., GemmProduct>: tiny products skip packing altogether.
+    if ((depth + rows + cols) < EIGEN_GEMM_TO_COEFFBASED_THRESHOLD) {
+      for (Index b = 0; b < batchSize; ++b) {
+        dstMap(b, rows, cols).noalias() =
+            LhsMap(lhsData + b * lhsBatchStride, rows, depth, OuterStride<>(lhsStride))
+                .lazyProduct(RhsMap(rhsData + b * rhsBatchStride, depth, cols, OuterStride<>(rhsStride)));
+      }
+      return;
+    }
+
+    auto task = [&](Index begin, Index end) {
+      // One blocking (and one set of packing buffers) per thread, shared by all products of its chunk.
+      BlockingType blocking(rows, cols, depth, 1, true);
+      blocking.allocateAll();
+      for (Index b = begin; b < end; ++b) {
+        dstMap(b, rows, cols).setZero();
+        Gemm::run(rows, cols, depth, lhsData + b * lhsBatchStride, lhsStride, rhsData + b * rhsBatchStride, rhsStride,
+                  dstData + b * dstBatchStride, dstIncr, dstStride, Scalar(1), blocking);
+      }
+    };
+
+    const double work = static_cast<double>(rows) * static_cast<double>(cols) * static_cast<double>(depth) *
+                        static_cast<double>(batchSize);
+    parallelize_range(task, batchSize, parallel_threads_for_work(work));
+  }
+};
+
+}  // end namespace internal
+
+/** \ingroup Core_Module
+ *
+ * Computes the batch of independent products
+ * \code
+ * dst_b.noalias() = lhs_b * rhs_b;   // b = 0, ..., batchSize - 1
+ * \endcode
+ * where \c X_b denotes the matrix having the sizes and strides of \a X and starting at
+ * <tt>X.data() + b * XBatchStride</tt>. The expressions \a lhs, \a rhs and \a dst typically are
+ * Map objects describing the first matrix of each batch, and must have direct access with a unit
+ * inner stride (a non-unit inner stride is allowed for \a dst). A batch stride of 0 reuses the same
+ * operand for the whole batch.
+ *
+ * Unlike a loop of products, the blocking parameters and the packing buffers are computed once and
+ * reused across the batch, and when multi-threading is enabled (see setNbThreads()) the batch is split
+ * across threads rather than each product. When a shared operand is combined with back to back
+ * storage of the other operand and of the destination, the whole batch is evaluated as one larger
+ * product so that the packed shared operand is reused.
+ *
+ * Example:
+ * \code
+ * std::vector<float> a(n * 16 * 16), b(n * 16 * 16), c(n * 16 * 16);
+ * Map<MatrixXf> A(a.data(), 16, 16), B(b.data(), 16, 16), C(c.data(), 16, 16);
+ * batchedProduct(A, B, C, n, 16 * 16, 16 * 16, 16 * 16);
+ * \endcode
+ *
+ * \a dst must not alias \a lhs or \a rhs.
+ *
+ * \sa setNbThreads()
+ */
+template <typename Lhs, typename Rhs, typename Dst>
+void batchedProduct(const MatrixBase<Lhs>& lhs, const MatrixBase<Rhs>& rhs, const MatrixBase<Dst>& dst,
+                    Index batchSize, Index lhsBatchStride, Index rhsBatchStride, Index dstBatchStride) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename Lhs::Scalar, typename Rhs::Scalar>::value &&
+                       std::is_same<typename Lhs::Scalar, typename Dst::Scalar>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  EIGEN_STATIC_ASSERT((bool(internal::traits<Lhs>::Flags & DirectAccessBit) &&
+                       bool(internal::traits<Rhs>::Flags & DirectAccessBit) &&
+                       bool(internal::traits<Dst>::Flags & DirectAccessBit)),
+                      THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_WITH_DIRECT_MEMORY_ACCESS_SUCH_AS_MAP_OR_PLAIN_MATRICES)
+  EIGEN_STATIC_ASSERT(Lhs::InnerStrideAtCompileTime == 1 && Rhs::InnerStrideAtCompileTime == 1,
+                      THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_WITH_DIRECT_MEMORY_ACCESS_SUCH_AS_MAP_OR_PLAIN_MATRICES)
+  eigen_assert(lhs.cols() == rhs.rows() && dst.rows() == lhs.rows() && dst.cols() == rhs.cols() &&
+               "invalid batched matrix product");
+  eigen_assert(batchSize >= 0 && "batchSize must be non-negative");
+  Dst& actualDst = dst.const_cast_derived();
+  internal::batched_gemm_impl<Lhs, Rhs, Dst>::run(lhs.derived(), rhs.derived(), actualDst, batchSize,
+                                                  lhsBatchStride, rhsBatchStride, dstBatchStride);
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_GENERAL_MATRIX_MATRIX_BATCHED_H
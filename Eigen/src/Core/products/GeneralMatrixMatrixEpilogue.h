@@ -0,0 +1,240 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_GENERAL_MATRIX_MATRIX_EPILOGUE_H
+#define EIGEN_GENERAL_MATRIX_MATRIX_EPILOGUE_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+// Applies epilogue to the rows x cols block of the column-major res, whose first coefficient is
+// the coefficient (row, col) of the product.
+template <typename Scalar, typename Index, typename Epilogue>
+void gemm_apply_epilogue(Scalar* res, Index resStride, Index rows, Index cols, Index row, Index col,
+                         const Epilogue& epilogue) {
+  using Packet = typename packet_traits<Scalar>::type;
+  enum { PacketSize = unpacket_traits<Packet>::size };
+  for (Index j = 0; j < cols; ++j) {
+    Scalar* c = res + j * resStride;
+    Index i = 0;
+    EIGEN_IF_CONSTEXPR(PacketSize > 1) {
+      for (; i + PacketSize <= rows; i += PacketSize)
+        pstoreu(c + i, epilogue.packetOp(ploadu<Packet>(c + i), row + i, col + j));
+    }
+    for (; i < rows; ++i) c[i] = epilogue(c[i], row + i, col + j);
+  }
+}
+
+/* Column-major GEMM applying an epilogue to the result: the same blocking and kernels as
+ * general_matrix_matrix_product, except that during the last pass over the depth the gebp kernel is
+ * called on column strips of the result small enough to stay in the L2 cache, each of which is handed
+ * to the epilogue right after the kernel has stored it. The architecture-specific gebp kernels write
+ * through the data pointer of the result, so the epilogue is not applied by the kernel stores
+ * themselves. */
+template <typename Index, typename LhsScalar, int LhsStorageOrder, bool ConjugateLhs, typename RhsScalar,
+          int RhsStorageOrder, bool ConjugateRhs>
+struct general_matrix_matrix_product_epilogue {
+  using Traits = gebp_traits<LhsScalar, RhsScalar>;
+  using ResScalar = typename ScalarBinaryOpTraits<LhsScalar, RhsScalar>::ReturnType;
+
+  // The result block at (row, col) of the product is res.
+  template <typename Epilogue>
+  static void run(Index rows, Index cols, Index depth, const LhsScalar* lhs_, Index lhsStride, const RhsScalar* rhs_,
+                  Index rhsStride, ResScalar* res_, Index resStride, ResScalar alpha, const Epilogue& epilogue,
+                  Index row, Index col) {
+    using LhsMapper = const_blas_data_mapper<LhsScalar, Index, LhsStorageOrder>;
+    using RhsMapper = const_blas_data_mapper<RhsScalar, Index, RhsStorageOrder>;
+    using ResMapper = blas_data_mapper<typename Traits::ResScalar, Index, ColMajor>;
+    LhsMapper lhs(lhs_, lhsStride);
+    RhsMapper rhs(rhs_, rhsStride);
+    ResMapper res(res_, resStride);
+
+    gemm_pack_lhs<LhsScalar, Index, LhsMapper, Traits::mr, Traits::LhsProgress, typename Traits::LhsPacket4Packing,
+                  LhsStorageOrder>
+        pack_lhs;
+    gemm_pack_rhs<RhsScalar, Index, RhsMapper, Traits::nr, RhsStorageOrder> pack_rhs;
+    gebp_kernel<LhsScalar, RhsScalar, Index, ResMapper, Traits::mr, Traits::nr, ConjugateLhs, ConjugateRhs> gebp;
+
+    gemm_blocking_space<ColMajor, LhsScalar, RhsScalar, Dynamic, Dynamic, Dynamic> blocking(rows, cols, depth, 1, true);
+    blocking.allocateAll();
+    LhsScalar* blockA = blocking.blockA();
+    RhsScalar* blockB = blocking.blockB();
+    const Index kc = blocking.kc();
+    const Index mc = (std::min)(rows, blocking.mc());
+    const Index nc = (std::min)(cols, blocking.nc());
+
+    for (Index i2 = 0; i2 < rows; i2 += mc) {
+      const Index actual_mc = (std::min)(i2 + mc, rows) - i2;
+      // Half of the L2 cache for a strip of the result, in whole micro panels.
+      const Index strip = numext::maxi(
+          Index(Traits::nr),
+          Index(l2CacheSize() / (2 * actual_mc * Index(sizeof(ResScalar))) / Traits::nr * Traits::nr));
+
+      for (Index k2 = 0; k2 < depth; k2 += kc) {
+        const Index actual_kc = (std::min)(k2 + kc, depth) - k2;
+        const bool last = k2 + actual_kc == depth;
+        const Index step = last ? (std::min)(strip, nc) : nc;
+
+        pack_lhs(blockA, lhs.getSubMapper(i2, k2), actual_kc, actual_mc);
+        for (Index j2 = 0; j2 < cols; j2 += step) {
+          const Index actual_nc = (std::min)(j2 + step, cols) - j2;
+          pack_rhs(blockB, rhs.getSubMapper(k2, j2), actual_kc, actual_nc);
+          gebp(res.getSubMapper(i2, j2), blockA, blockB, actual_mc, actual_kc, actual_nc, alpha);
+          if (last)
+            gemm_apply_epilogue(res_ + i2 + j2 * resStride, resStride, actual_mc, actual_nc, row + i2, col + j2,
+                                epilogue);
+        }
+      }
+    }
+  }
+};
+
+// Adapter of general_matrix_matrix_product_epilogue to parallelize_gemm. Each call evaluates an
+// independent block of the result and packs its own panels.
+template <typename Index, typename LhsScalar, int LhsStorageOrder, bool ConjugateLhs, typename RhsScalar,
+          int RhsStorageOrder, bool ConjugateRhs, typename Epilogue>
+struct gemm_epilogue_functor
+    : gemm_panel_tiled_functor<gemm_epilogue_functor<Index, LhsScalar, LhsStorageOrder, ConjugateLhs, RhsScalar,
+                                                     RhsStorageOrder, ConjugateRhs, Epilogue>> {
+  using Kernel = general_matrix_matrix_product_epilogue<Index, LhsScalar, LhsStorageOrder, ConjugateLhs, RhsScalar,
+                                                        RhsStorageOrder, ConjugateRhs>;
+  using Traits = typename Kernel::Traits;
+  using ResScalar = typename Kernel::ResScalar;
+  enum { TiledByRows = false };
+
+  gemm_epilogue_functor(const LhsScalar* lhs, Index lhsStride, const RhsScalar* rhs, Index rhsStride, ResScalar* res,
+                        Index resStride, Index rows, Index cols, Index depth, ResScalar alpha,
+                        const Epilogue& epilogue)
+      : m_lhs(lhs),
+        m_lhsStride(lhsStride),
+        m_rhs(rhs),
+        m_rhsStride(rhsStride),
+        m_res(res),
+        m_resStride(resStride),
+        m_rows(rows),
+        m_cols(cols),
+        m_depth(depth),
+        m_alpha(alpha),
+        m_epilogue(epilogue) {}
+
+  void initParallelSession(Index) const {}
+
+  void operator()(Index row, Index rows, Index col = 0, Index cols = -1, GemmParallelInfo<Index>* = 0) const {
+    if (cols == -1) cols = m_cols;
+    Kernel::run(rows, cols, m_depth, m_lhs + (LhsStorageOrder == RowMajor ? row * m_lhsStride : row), m_lhsStride,
+                m_rhs + (RhsStorageOrder == RowMajor ? col : col * m_rhsStride), m_rhsStride,
+                m_res + row + col * m_resStride, m_resStride, m_alpha, m_epilogue, row, col);
+  }
+
+  Index rows() const { return m_rows; }
+  Index cols() const { return m_cols; }
+
+ protected:
+  const LhsScalar* m_lhs;
+  Index m_lhsStride;
+  const RhsScalar* m_rhs;
+  Index m_rhsStride;
+  ResScalar* m_res;
+  Index m_resStride;
+  Index m_rows, m_cols, m_depth;
+  ResScalar m_alpha;
+  Epilogue m_epilogue;
+};
+
+// Fused evaluation of a matrix-matrix product with an epilogue into a column-major dst with unit
+// inner stride. Returns false for the products which are not evaluated by the GEMM kernel.
+template <typename Lhs, typename Rhs, bool Enabled = product_type<Lhs, Rhs>::value == GemmProduct>
+struct epilogue_product_gemm {
+  template <typename Dst, typename Epilogue>
+  static bool run(Dst&, const Lhs&, const Rhs&, const Epilogue&) {
+    return false;
+  }
+};
+
+template <typename Lhs, typename Rhs>
+struct epilogue_product_gemm<Lhs, Rhs, true> {
+  using Scalar = typename Product<Lhs, Rhs>::Scalar;
+  using LhsBlasTraits = blas_traits<Lhs>;
+  using ActualLhsType = typename LhsBlasTraits::DirectLinearAccessType;
+  using ActualLhsTypeCleaned = remove_all_t<ActualLhsType>;
+  using RhsBlasTraits = blas_traits<Rhs>;
+  using ActualRhsType = typename RhsBlasTraits::DirectLinearAccessType;
+  using ActualRhsTypeCleaned = remove_all_t<ActualRhsType>;
+
+  template <typename Dst, typename Epilogue>
+  static bool run(Dst& dst, const Lhs& a_lhs, const Rhs& a_rhs, const Epilogue& epilogue) {
+    using GemmImpl = generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemmProduct>;
+    if (a_lhs.cols() == 0 || dst.rows() == 1 || dst.cols() == 1 || GemmImpl::useRuntimeCoeffBasedProduct(dst, a_rhs))
+      return false;
+
+    add_const_on_value_type_t<ActualLhsType> lhs = LhsBlasTraits::extract(a_lhs);
+    add_const_on_value_type_t<ActualRhsType> rhs = RhsBlasTraits::extract(a_rhs);
+    const Scalar alpha = combine_scalar_factors(Scalar(1), a_lhs, a_rhs);
+
+    using Functor = gemm_epilogue_functor<Index, typename Lhs::Scalar,
+                                          (ActualLhsTypeCleaned::Flags & RowMajorBit) ? RowMajor : ColMajor,
+                                          bool(LhsBlasTraits::NeedToConjugate), typename Rhs::Scalar,
+                                          (ActualRhsTypeCleaned::Flags & RowMajorBit) ? RowMajor : ColMajor,
+                                          bool(RhsBlasTraits::NeedToConjugate), Epilogue>;
+    dst.setZero();
+    parallelize_gemm<(Dst::MaxRowsAtCompileTime > 32 || Dst::MaxRowsAtCompileTime == Dynamic)>(
+        Functor(lhs.data(), lhs.outerStride(), rhs.data(), rhs.outerStride(), dst.data(), dst.outerStride(),
+                dst.rows(), dst.cols(), a_lhs.cols(), alpha, epilogue),
+        dst.rows(), dst.cols(), a_lhs.cols(), false);
+    return true;
+  }
+};
+
+template <typename Dst>
+struct epilogue_product_direct_dest {
+  enum {
+    value = bool(traits<Dst>::Flags & DirectAccessBit) && !bool(traits<Dst>::Flags & RowMajorBit) &&
+            int(Dst::InnerStrideAtCompileTime) == 1
+  };
+};
+
+template <typename Dst, bool Direct = epilogue_product_direct_dest<Dst>::value>
+struct epilogue_product_dest {
+  template <typename Lhs, typename Rhs, typename Epilogue>
+  static void run(Dst& dst, const Lhs& lhs, const Rhs& rhs, const Epilogue& epilogue) {
+    if (epilogue_product_gemm<Lhs, Rhs>::run(dst, lhs, rhs, epilogue)) return;
+    call_assignment_no_alias(dst, Product<Lhs, Rhs>(lhs, rhs));
+    gemm_apply_epilogue(dst.data(), dst.outerStride(), dst.rows(), dst.cols(), Index(0), Index(0), epilogue);
+  }
+};
+
+// Other destinations are evaluated through a column-major temporary.
+template <typename Dst>
+struct epilogue_product_dest<Dst, false> {
+  template <typename Lhs, typename Rhs, typename Epilogue>
+  static void run(Dst& dst, const Lhs& lhs, const Rhs& rhs, const Epilogue& epilogue) {
+    using Tmp = Matrix<typename Dst::Scalar, Dynamic, Dynamic, ColMajor>;
+    Tmp tmp(dst.rows(), dst.cols());
+    epilogue_product_dest<Tmp, true>::run(tmp, lhs, rhs, epilogue);
+    call_assignment_no_alias(dst, tmp);
+  }
+};
+
+template <typename Lhs, typename Rhs, typename Epilogue>
+struct epilogue_product_impl {
+  template <typename Dst>
+  static void evalTo(Dst& dst, const Lhs& lhs, const Rhs& rhs, const Epilogue& epilogue) {
+    epilogue_product_dest<Dst>::run(dst, lhs, rhs, epilogue);
+  }
+};
+
+}  // end namespace internal
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_GENERAL_MATRIX_MATRIX_EPILOGUE_H
@@ -0,0 +1,283 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_GENERAL_MATRIX_MATRIX_FLOAT16_H
+#define EIGEN_GENERAL_MATRIX_MATRIX_FLOAT16_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+// The packing routines of these targets are tied to their own operand layouts, so the products
+// below keep evaluating the casts into float temporaries there.
+#ifndef EIGEN_GEMM_FLOAT16_PACKING
+#if defined(EIGEN_VECTORIZE_ALTIVEC) || defined(EIGEN_VECTORIZE_VSX) || defined(EIGEN_VECTORIZE_SME)
+#define EIGEN_GEMM_FLOAT16_PACKING 0
+#else
+#define EIGEN_GEMM_FLOAT16_PACKING 1
+#endif
+#endif
+
+namespace Eigen {
+
+namespace internal {
+
+/* Matrix products of bfloat16 or half operands accumulated in float:
+ *   C.noalias() = A.cast<float>() * B.cast<float>();   // C float, A and B bfloat16 or half
+ * Instead of evaluating the casts into float copies of A and B, the GEMM reads the 16-bit
+ * operands directly and widens them to float while packing them into the blockA/blockB panels.
+ * The float gebp micro-kernel of the target then runs unchanged on the packed panels, so that
+ * the accumulation is done in float and only half of the operand bytes are streamed from memory.
+ * One of the operands may also be a plain float matrix. */
+
+template <typename Scalar>
+struct is_float16 : std::false_type {};
+template <>
+struct is_float16<bfloat16> : std::true_type {};
+template <>
+struct is_float16<half> : std::true_type {};
+
+// Loads a float packet from 16-bit storage, with a vectorized conversion when the target has one for this width.
+template <typename Packet, typename SrcScalar,
+          bool Vectorized = (unpacket_traits<Packet>::size > 1) &&
+                            bool(type_casting_traits<SrcScalar, float>::VectorizedCast) &&
+                            find_packet_by_size<SrcScalar, unpacket_traits<Packet>::size>::value>
+struct float16_packet_loader {
+  static EIGEN_ALWAYS_INLINE Packet run(const SrcScalar* from) {
+    using SrcPacket = typename find_packet_by_size<SrcScalar, unpacket_traits<Packet>::size>::type;
+    return pcast<SrcPacket, Packet>(ploadu<SrcPacket>(from));
+  }
+};
+
+template <typename Packet, typename SrcScalar>
+struct float16_packet_loader<Packet, SrcScalar, false> {
+  static EIGEN_ALWAYS_INLINE Packet run(const SrcScalar* from) {
+    enum { Size = unpacket_traits<Packet>::size };
+    EIGEN_ALIGN_MAX float tmp[Size];
+    for (int i = 0; i < Size; ++i) tmp[i] = static_cast<float>(from[i]);
+    return pload<Packet>(tmp);
+  }
+};
+
+// Data mappers presenting a 16-bit matrix as a float one to gemm_pack_lhs/gemm_pack_rhs.
+template <typename SrcScalar, typename Index>
+class float16_linear_mapper {
+ public:
+  EIGEN_ALWAYS_INLINE explicit float16_linear_mapper(const SrcScalar* data) : m_data(data) {}
+
+  EIGEN_ALWAYS_INLINE void prefetch(Index i) const { internal::prefetch(m_data + i); }
+
+  EIGEN_ALWAYS_INLINE float operator()(Index i) const { return static_cast<float>(m_data[i]); }
+
+  template <typename PacketType>
+  EIGEN_ALWAYS_INLINE PacketType loadPacket(Index i) const {
+    return float16_packet_loader<PacketType, SrcScalar>::run(m_data + i);
+  }
+
+ protected:
+  const SrcScalar* m_data;
+};
+
+template <typename SrcScalar, typename Index, int StorageOrder>
+class float16_data_mapper {
+ public:
+  using LinearMapper = float16_linear_mapper<SrcScalar, Index>;
+  using SubMapper = float16_data_mapper;
+
+  EIGEN_ALWAYS_INLINE float16_data_mapper(const SrcScalar* data, Index stride) : m_data(data), m_stride(stride) {}
+
+  EIGEN_ALWAYS_INLINE SubMapper getSubMapper(Index i, Index j) const { return SubMapper(address(i, j), m_stride); }
+
+  EIGEN_ALWAYS_INLINE LinearMapper getLinearMapper(Index i, Index j) const { return LinearMapper(address(i, j)); }
+
+  EIGEN_ALWAYS_INLINE void prefetch(Index i, Index j) const { internal::prefetch(address(i, j)); }
+
+  EIGEN_ALWAYS_INLINE float operator()(Index i, Index j) const { return static_cast<float>(*address(i, j)); }
+
+  template <typename PacketType>
+  EIGEN_ALWAYS_INLINE PacketType loadPacket(Index i, Index j) const {
+    return float16_packet_loader<PacketType, SrcScalar>::run(address(i, j));
+  }
+
+  EIGEN_ALWAYS_INLINE Index stride() const { return m_stride; }
+
+ protected:
+  EIGEN_ALWAYS_INLINE const SrcScalar* address(Index i, Index j) const {
+    return m_data + (StorageOrder == RowMajor ? j + i * m_stride : i + j * m_stride);
+  }
+
+  const SrcScalar* m_data;
+  const Index m_stride;
+};
+
+template <typename SrcScalar, typename Index, int StorageOrder>
+struct float16_gemm_mapper {
+  using type = float16_data_mapper<SrcScalar, Index, StorageOrder>;
+};
+template <typename Index, int StorageOrder>
+struct float16_gemm_mapper<float, Index, StorageOrder> {
+  using type = const_blas_data_mapper<float, Index, StorageOrder>;
+};
+
+template <typename SrcScalar>
+struct float16_gemm_packed_scalar {
+  typedef float type;
+};
+
+// Sequential GEMM res += alpha * lhs * rhs with float packed panels, following
+// general_matrix_matrix_product: a row-major result is computed as the transposed product.
+template <typename Index, typename LhsScalar, int LhsStorageOrder, typename RhsScalar, int RhsStorageOrder,
+          int ResStorageOrder, int ResInnerStride>
+struct float16_gemm_kernel;
+
+template <typename Index, typename LhsScalar, int LhsStorageOrder, typename RhsScalar, int RhsStorageOrder,
+          int ResInnerStride>
+struct float16_gemm_kernel<Index, LhsScalar, LhsStorageOrder, RhsScalar, RhsStorageOrder, RowMajor, ResInnerStride> {
+  static void run(Index rows, Index cols, Index depth, const LhsScalar* lhs, Index lhsStride, const RhsScalar* rhs,
+                  Index rhsStride, float* res, Index resIncr, Index resStride, float alpha) {
+    float16_gemm_kernel<Index, RhsScalar, RhsStorageOrder == RowMajor ? ColMajor : RowMajor, LhsScalar,
+                        LhsStorageOrder == RowMajor ? ColMajor : RowMajor, ColMajor,
+                        ResInnerStride>::run(cols, rows, depth, rhs, rhsStride, lhs, lhsStride, res, resIncr,
+                                             resStride, alpha);
+  }
+};
+
+template <typename Index, typename LhsScalar, int LhsStorageOrder, typename RhsScalar, int RhsStorageOrder,
+          int ResInnerStride>
+struct float16_gemm_kernel<Index, LhsScalar, LhsStorageOrder, RhsScalar, RhsStorageOrder, ColMajor, ResInnerStride> {
+  // Dependent on the operand types, so that the gebp_traits<float, float> specializations of the architecture
+  // kernels included after this file are the ones picked up.
+  using Scalar = typename float16_gemm_packed_scalar<LhsScalar>::type;
+  using Traits = gebp_traits<Scalar, Scalar>;
+
+  static void run(Index rows, Index cols, Index depth, const LhsScalar* lhs_, Index lhsStride, const RhsScalar* rhs_,
+                  Index rhsStride, Scalar* res_, Index resIncr, Index resStride, Scalar alpha) {
+    using LhsMapper = typename float16_gemm_mapper<LhsScalar, Index, LhsStorageOrder>::type;
+    using RhsMapper = typename float16_gemm_mapper<RhsScalar, Index, RhsStorageOrder>::type;
+    using ResMapper = blas_data_mapper<Scalar, Index, ColMajor, Unaligned, ResInnerStride>;
+    LhsMapper lhs(lhs_, lhsStride);
+    RhsMapper rhs(rhs_, rhsStride);
+    ResMapper res(res_, resStride, resIncr);
+
+    gemm_pack_lhs<Scalar, Index, LhsMapper, Traits::mr, Traits::LhsProgress, typename Traits::LhsPacket4Packing,
+                  LhsStorageOrder>
+        pack_lhs;
+    gemm_pack_rhs<Scalar, Index, RhsMapper, Traits::nr, RhsStorageOrder> pack_rhs;
+    gebp_kernel<Scalar, Scalar, Index, ResMapper, Traits::mr, Traits::nr, false, false> gebp;
+
+    // The panels hold floats, so the blocking is the one of a float product.
+    gemm_blocking_space<ColMajor, Scalar, Scalar, Dynamic, Dynamic, Dynamic> blocking(rows, cols, depth, 1, true);
+    blocking.allocateAll();
+    gemm_pack_lhs_first_loop_policy::run(rows, cols, depth, blocking.kc(), (std::min)(rows, blocking.mc()),
+                                         (std::min)(cols, blocking.nc()), lhs, rhs, res, pack_lhs, pack_rhs, gebp,
+                                         blocking.blockA(), blocking.blockB(), alpha);
+  }
+};
+
+// A GEMM operand: either a plain float matrix, or the cast to float of a bfloat16/half one,
+// with direct access and unit inner stride in both cases.
+template <typename Xpr>
+struct float16_gemm_operand {
+  using Source = typename Xpr::Scalar;
+  using Arg = Xpr;
+  enum {
+    IsCast = false,
+    value = std::is_same<Source, float>::value && has_direct_access<Xpr>::value &&
+            inner_stride_at_compile_time<Xpr>::value == 1
+  };
+  static const Arg& arg(const Xpr& xpr) { return xpr; }
+};
+
+template <typename SrcScalar, typename ArgType>
+struct float16_gemm_operand<CwiseUnaryOp<core_cast_op<SrcScalar, float>, ArgType>> {
+  using Source = SrcScalar;
+  using Arg = remove_all_t<ArgType>;
+  enum {
+    IsCast = true,
+    value = is_float16<SrcScalar>::value && has_direct_access<Arg>::value &&
+            inner_stride_at_compile_time<Arg>::value == 1
+  };
+  static const Arg& arg(const CwiseUnaryOp<core_cast_op<SrcScalar, float>, ArgType>& xpr) {
+    return xpr.nestedExpression();
+  }
+};
+
+// Adapter of a float16 product to the parallelizers of generic_product_impl<..., GemmProduct>::scaleAndAddTo.
+// Each call evaluates an independent block of the result and packs its own panels.
+template <typename Lhs, typename Rhs, typename Dest>
+struct float16_gemm_functor : gemm_panel_tiled_functor<float16_gemm_functor<Lhs, Rhs, Dest>> {
+  using LhsOperand = float16_gemm_operand<remove_all_t<Lhs>>;
+  using RhsOperand = float16_gemm_operand<remove_all_t<Rhs>>;
+  using LhsArg = typename LhsOperand::Arg;
+  using RhsArg = typename RhsOperand::Arg;
+  using LhsSource = typename LhsOperand::Source;
+  using RhsSource = typename RhsOperand::Source;
+  enum {
+    LhsOrder = (traits<LhsArg>::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    RhsOrder = (traits<RhsArg>::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    DstOrder = (traits<Dest>::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    TiledByRows = int(DstOrder) == int(RowMajor)
+  };
+  using Kernel =
+      float16_gemm_kernel<Index, LhsSource, LhsOrder, RhsSource, RhsOrder, DstOrder, Dest::InnerStrideAtCompileTime>;
+  using Traits = gebp_traits<typename Dest::Scalar, typename Dest::Scalar>;
+
+  float16_gemm_functor(const LhsArg& lhs, const RhsArg& rhs, Dest& dst, float alpha)
+      : m_lhs(lhs), m_rhs(rhs), m_dst(dst), m_alpha(alpha) {}
+
+  void initParallelSession(Index) const {}
+
+  void operator()(Index row, Index rows, Index col = 0, Index cols = -1, GemmParallelInfo<Index>* = 0) const {
+    if (cols == -1) cols = m_dst.cols();
+    Kernel::run(rows, cols, m_lhs.cols(), &m_lhs.coeffRef(row, 0), m_lhs.outerStride(), &m_rhs.coeffRef(0, col),
+                m_rhs.outerStride(), &m_dst.coeffRef(row, col), m_dst.innerStride(), m_dst.outerStride(), m_alpha);
+  }
+
+  Index rows() const { return m_dst.rows(); }
+  Index cols() const { return m_dst.cols(); }
+
+ protected:
+  const LhsArg& m_lhs;
+  const RhsArg& m_rhs;
+  Dest& m_dst;
+  float m_alpha;
+};
+
+template <typename Lhs, typename Rhs, typename Dest>
+struct gemm_float16_product_enabled {
+  using LhsOperand = float16_gemm_operand<remove_all_t<Lhs>>;
+  using RhsOperand = float16_gemm_operand<remove_all_t<Rhs>>;
+  enum {
+    value = EIGEN_GEMM_FLOAT16_PACKING && std::is_same<typename Dest::Scalar, float>::value &&
+            bool(LhsOperand::value) && bool(RhsOperand::value) && (bool(LhsOperand::IsCast) || bool(RhsOperand::IsCast))
+  };
+};
+
+template <typename Lhs, typename Rhs, typename Dest, bool Enabled>
+struct gemm_float16_product {
+  enum { value = false };
+  template <typename Scalar, typename Parallelizer>
+  static void run(Dest&, const Lhs&, const Rhs&, const Scalar&, const Parallelizer&) {}
+};
+
+template <typename Lhs, typename Rhs, typename Dest>
+struct gemm_float16_product<Lhs, Rhs, Dest, true> {
+  enum { value = true };
+  template <typename Parallelizer>
+  static void run(Dest& dst, const Lhs& lhs, const Rhs& rhs, float alpha, const Parallelizer& parallelize) {
+    using Functor = float16_gemm_functor<Lhs, Rhs, Dest>;
+    parallelize(Functor(Functor::LhsOperand::arg(lhs), Functor::RhsOperand::arg(rhs), dst, alpha), dst.rows(),
+                dst.cols(), lhs.cols(), bool(Dest::Flags & RowMajorBit));
+  }
+};
+
+}  // end namespace internal
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_GENERAL_MATRIX_MATRIX_FLOAT16_H
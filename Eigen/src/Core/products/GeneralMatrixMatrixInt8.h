@@ -0,0 +1,559 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_GENERAL_MATRIX_MATRIX_INT8_H
+#define EIGEN_GENERAL_MATRIX_MATRIX_INT8_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+/* Products of int8 matrices with int32 accumulation:
+ *   C.noalias() = A.cast<int>() * B.cast<int>();             // C int32, A and B int8
+ *   quantizedProduct(A, za, sa, B, zb, sb, C);               // C float, dequantized
+ *
+ * The operands are packed as int8, with groups of 4 consecutive depth indices stored next to each
+ * other for every row of a lhs micro panel and every column of a rhs micro panel. This is the layout
+ * of the 4-way int8 dot-product instructions: AVX512-VNNI/AVX-VNNI vpdpbusd, which multiplies
+ * unsigned by signed bytes (the lhs is thus stored with an offset of 128, compensated by the
+ * column sums of the rhs stored in front of each rhs micro panel), and NEON sdot. Other targets
+ * pack one depth index at a time, widen the lhs to int32 while packing, and run a portable kernel
+ * on the int32 packets of the target.
+ *
+ * The kernels reduce an mr x nr tile over a whole depth block in int32 registers, and hand it to an
+ * epilogue functor which either accumulates it into an int32 destination, or, when the depth is not
+ * split into blocks, removes the zero points and applies the scales while storing a float result.
+ * Blocking follows computeProductBlockingSizes<int8_t, int8_t> and the loops are those of
+ * general_matrix_matrix_product (gemm_pack_lhs_first_loop_policy).
+ *
+ * The int32 accumulation is exact as long as the depth is below 2^17. */
+
+struct int8_gemm_traits {
+#if defined(EIGEN_VECTORIZE_AVX512VNNI)
+  typedef int8_t LhsPacked;
+  enum { mr = 32, nr = 8, KGroup = 4, LhsOffset = 128 };
+#elif defined(EIGEN_VECTORIZE_AVXVNNI)
+  typedef int8_t LhsPacked;
+  enum { mr = 16, nr = 4, KGroup = 4, LhsOffset = 128 };
+#elif defined(EIGEN_VECTORIZE_NEON) && EIGEN_ARCH_ARM64 && defined(__ARM_FEATURE_DOTPROD)
+  typedef int8_t LhsPacked;
+  enum { mr = 8, nr = 8, KGroup = 4, LhsOffset = 0 };
+#else
+  // Portable kernel on the int32 packets of the target: the lhs is widened to int32 while packing.
+  typedef int32_t LhsPacked;
+  enum { mr = 2 * unpacket_traits<packet_traits<int32_t>::type>::size, nr = 6, KGroup = 1, LhsOffset = 0 };
+#endif
+
+  // Number of KGroup-sized depth groups of a packed panel.
+  static EIGEN_ALWAYS_INLINE Index groups(Index depth) { return numext::div_ceil(depth, Index(KGroup)); }
+  // Number of LhsPacked in a packed lhs micro panel, and of bytes in a packed rhs micro panel including its
+  // nr int32 initial accumulators.
+  static EIGEN_ALWAYS_INLINE Index lhsPanelSize(Index depth) { return mr * KGroup * groups(depth); }
+  static EIGEN_ALWAYS_INLINE Index rhsPanelSize(Index depth) {
+    return nr * (KGroup * groups(depth) + Index(sizeof(int32_t)));
+  }
+};
+
+// Computes the mr x nr tile (column-major, int32) of a packed lhs micro panel times a packed rhs micro panel.
+template <typename Traits>
+struct int8_gemm_micro_kernel {
+  typedef typename packet_traits<int32_t>::type Packet;
+  enum { PacketSize = unpacket_traits<Packet>::size, nr = Traits::nr };
+
+  static EIGEN_ALWAYS_INLINE void run(const typename Traits::LhsPacked* blockA, const int8_t* blockB, Index groups,
+                                      int32_t* tile) {
+    EIGEN_STATIC_ASSERT(int(Traits::mr) == 2 * int(PacketSize) && int(Traits::KGroup) == 1, INTERNAL_ERROR)
+    Packet acc0[nr], acc1[nr];
+    for (int j = 0; j < nr; ++j) {
+      int32_t init;
+      std::memcpy(&init, blockB + j * sizeof(int32_t), sizeof(int32_t));
+      acc0[j] = acc1[j] = pset1<Packet>(init);
+    }
+    blockB += nr * sizeof(int32_t);
+    for (Index k = 0; k < groups; ++k, blockA += 2 * PacketSize, blockB += nr) {
+      const Packet a0 = ploadu<Packet>(blockA);
+      const Packet a1 = ploadu<Packet>(blockA + PacketSize);
+      for (int j = 0; j < nr; ++j) {
+        const Packet b = pset1<Packet>(int32_t(blockB[j]));
+        acc0[j] = pmadd(a0, b, acc0[j]);
+        acc1[j] = pmadd(a1, b, acc1[j]);
+      }
+    }
+    for (int j = 0; j < nr; ++j) {
+      pstoreu(tile + j * Traits::mr, acc0[j]);
+      pstoreu(tile + j * Traits::mr + PacketSize, acc1[j]);
+    }
+  }
+};
+
+#if defined(EIGEN_VECTORIZE_AVX512VNNI)
+template <>
+EIGEN_ALWAYS_INLINE void int8_gemm_micro_kernel<int8_gemm_traits>::run(const int8_t* blockA, const int8_t* blockB,
+                                                                        Index groups, int32_t* tile) {
+  __m512i acc0[8], acc1[8];
+  for (int j = 0; j < 8; ++j) {
+    int32_t init;
+    std::memcpy(&init, blockB + j * sizeof(int32_t), sizeof(int32_t));
+    acc0[j] = acc1[j] = _mm512_set1_epi32(init);
+  }
+  blockB += 8 * sizeof(int32_t);
+  for (Index q = 0; q < groups; ++q, blockA += 128, blockB += 32) {
+    const __m512i a0 = _mm512_loadu_si512(blockA);
+    const __m512i a1 = _mm512_loadu_si512(blockA + 64);
+    for (int j = 0; j < 8; ++j) {
+      int32_t bj;
+      std::memcpy(&bj, blockB + 4 * j, sizeof(int32_t));
+      const __m512i b = _mm512_set1_epi32(bj);
+      acc0[j] = _mm512_dpbusd_epi32(acc0[j], a0, b);
+      acc1[j] = _mm512_dpbusd_epi32(acc1[j], a1, b);
+    }
+  }
+  for (int j = 0; j < 8; ++j) {
+    _mm512_storeu_si512(tile + 32 * j, acc0[j]);
+    _mm512_storeu_si512(tile + 32 * j + 16, acc1[j]);
+  }
+}
+#elif defined(EIGEN_VECTORIZE_AVXVNNI)
+template <>
+EIGEN_ALWAYS_INLINE void int8_gemm_micro_kernel<int8_gemm_traits>::run(const int8_t* blockA, const int8_t* blockB,
+                                                                        Index groups, int32_t* tile) {
+  __m256i acc0[4], acc1[4];
+  for (int j = 0; j < 4; ++j) {
+    int32_t init;
+    std::memcpy(&init, blockB + j * sizeof(int32_t), sizeof(int32_t));
+    acc0[j] = acc1[j] = _mm256_set1_epi32(init);
+  }
+  blockB += 4 * sizeof(int32_t);
+  for (Index q = 0; q < groups; ++q, blockA += 64, blockB += 16) {
+    const __m256i a0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blockA));
+    const __m256i a1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blockA + 32));
+    for (int j = 0; j < 4; ++j) {
+      int32_t bj;
+      std::memcpy(&bj, blockB + 4 * j, sizeof(int32_t));
+      const __m256i b = _mm256_set1_epi32(bj);
+      acc0[j] = _mm256_dpbusd_avx_epi32(acc0[j], a0, b);
+      acc1[j] = _mm256_dpbusd_avx_epi32(acc1[j], a1, b);
+    }
+  }
+  for (int j = 0; j < 4; ++j) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(tile + 16 * j), acc0[j]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(tile + 16 * j + 8), acc1[j]);
+  }
+}
+#elif defined(EIGEN_VECTORIZE_NEON) && EIGEN_ARCH_ARM64 && defined(__ARM_FEATURE_DOTPROD)
+template <>
+EIGEN_ALWAYS_INLINE void int8_gemm_micro_kernel<int8_gemm_traits>::run(const int8_t* blockA, const int8_t* blockB,
+                                                                        Index groups, int32_t* tile) {
+  // acc0[j] and acc1[j] hold the rows 0-3 and 4-7 of the column j.
+  int32x4_t acc0[8], acc1[8];
+  for (int j = 0; j < 8; ++j) {
+    int32_t init;
+    std::memcpy(&init, blockB + j * sizeof(int32_t), sizeof(int32_t));
+    acc0[j] = acc1[j] = vdupq_n_s32(init);
+  }
+  blockB += 8 * sizeof(int32_t);
+  for (Index q = 0; q < groups; ++q, blockA += 32, blockB += 32) {
+    const int8x16_t a0 = vld1q_s8(blockA);
+    const int8x16_t a1 = vld1q_s8(blockA + 16);
+    const int8x16_t b0 = vld1q_s8(blockB);
+    const int8x16_t b1 = vld1q_s8(blockB + 16);
+#define EIGEN_INT8_GEMM_SDOT(J, B, LANE)             \
+  acc0[J] = vdotq_laneq_s32(acc0[J], a0, B, LANE); \
+  acc1[J] = vdotq_laneq_s32(acc1[J], a1, B, LANE);
+    EIGEN_INT8_GEMM_SDOT(0, b0, 0)
+    EIGEN_INT8_GEMM_SDOT(1, b0, 1)
+    EIGEN_INT8_GEMM_SDOT(2, b0, 2)
+    EIGEN_INT8_GEMM_SDOT(3, b0, 3)
+    EIGEN_INT8_GEMM_SDOT(4, b1, 0)
+    EIGEN_INT8_GEMM_SDOT(5, b1, 1)
+    EIGEN_INT8_GEMM_SDOT(6, b1, 2)
+    EIGEN_INT8_GEMM_SDOT(7, b1, 3)
+#undef EIGEN_INT8_GEMM_SDOT
+  }
+  for (int j = 0; j < 8; ++j) {
+    vst1q_s32(tile + 8 * j, acc0[j]);
+    vst1q_s32(tile + 8 * j + 4, acc1[j]);
+  }
+}
+#endif
+
+// Packs the first count (<= Width) rows of the count x depth matrix element(i, k) into a micro panel,
+// with KGroup consecutive k per row. Missing rows and depth indices are filled with zeros, so that
+// they do not contribute to the products.
+template <typename Traits, int Width, int Offset, typename Packed, typename Element>
+EIGEN_ALWAYS_INLINE void int8_gemm_pack_panel(Packed* out, Index count, Index depth, const Element& element) {
+  enum { KGroup = Traits::KGroup };
+  const auto pack = [](int8_t v) { return Packed(int8_t(uint8_t(v) ^ uint8_t(Offset))); };
+  for (Index k = 0; k < depth; k += KGroup, out += Width * KGroup) {
+    if (count == Width && k + KGroup <= depth) {
+      for (int i = 0; i < Width; ++i)
+        for (int t = 0; t < KGroup; ++t) out[i * KGroup + t] = pack(element(i, k + t));
+    } else {
+      for (int i = 0; i < Width; ++i)
+        for (int t = 0; t < KGroup; ++t)
+          out[i * KGroup + t] = pack((i < count && k + t < depth) ? element(i, k + t) : int8_t(0));
+    }
+  }
+}
+
+template <typename Traits, typename Index, typename DataMapper>
+struct int8_gemm_pack_lhs {
+  void operator()(typename Traits::LhsPacked* blockA, const DataMapper& lhs, Index depth, Index rows) const {
+    const Index panelSize = Traits::lhsPanelSize(depth);
+    for (Index i0 = 0; i0 < rows; i0 += Traits::mr, blockA += panelSize) {
+      int8_gemm_pack_panel<Traits, Traits::mr, Traits::LhsOffset>(
+          blockA, numext::mini(Index(Traits::mr), rows - i0), depth,
+          [&](Index i, Index k) -> int8_t { return lhs(i0 + i, k); });
+    }
+  }
+};
+
+// Each rhs micro panel starts with the nr initial values of the accumulators: the column sums times -LhsOffset.
+template <typename Traits, typename Index, typename DataMapper>
+struct int8_gemm_pack_rhs {
+  void operator()(int8_t* blockB, const DataMapper& rhs, Index depth, Index cols) const {
+    const Index panelSize = Traits::rhsPanelSize(depth);
+    for (Index j0 = 0; j0 < cols; j0 += Traits::nr, blockB += panelSize) {
+      const Index count = numext::mini(Index(Traits::nr), cols - j0);
+      for (Index j = 0; j < Traits::nr; ++j) {
+        int32_t init = 0;
+        if (Traits::LhsOffset != 0 && j < count) {
+          for (Index k = 0; k < depth; ++k) init += int32_t(rhs(k, j0 + j));
+          init *= -int32_t(Traits::LhsOffset);
+        }
+        std::memcpy(blockB + j * sizeof(int32_t), &init, sizeof(int32_t));
+      }
+      int8_gemm_pack_panel<Traits, Traits::nr, 0>(blockB + Traits::nr * sizeof(int32_t), count, depth,
+                                                  [&](Index j, Index k) -> int8_t { return rhs(k, j0 + j); });
+    }
+  }
+};
+
+// Column-major destination block, which keeps track of its position in the whole result for the epilogues.
+template <typename ResScalar>
+struct int8_gemm_res_mapper {
+  ResScalar* data;
+  Index stride;
+  Index row, col;
+
+  int8_gemm_res_mapper getSubMapper(Index i, Index j) const {
+    return int8_gemm_res_mapper{data + i + j * stride, stride, row + i, col + j};
+  }
+  Map<Matrix<ResScalar, Dynamic, Dynamic>, Unaligned, OuterStride<>> block(Index i, Index j, Index rows,
+                                                                           Index cols) const {
+    return Map<Matrix<ResScalar, Dynamic, Dynamic>, Unaligned, OuterStride<>>(data + i + j * stride, rows, cols,
+                                                                              OuterStride<>(stride));
+  }
+};
+
+template <typename Traits>
+using int8_gemm_tile = Map<const Matrix<int32_t, Dynamic, Dynamic>, 0, OuterStride<Traits::mr>>;
+
+// res += alpha * tile
+struct int8_gemm_accumulate_epilogue {
+  enum { FullDepth = false };
+  int32_t alpha;
+
+  int8_gemm_accumulate_epilogue transposed() const { return *this; }
+
+  template <typename Traits>
+  EIGEN_ALWAYS_INLINE void store(const int8_gemm_res_mapper<int32_t>& res, Index i, Index j,
+                                 const int8_gemm_tile<Traits>& tile) const {
+    auto dst = res.block(i, j, tile.rows(), tile.cols());
+    if (alpha == 1)
+      dst += tile;
+    else
+      dst += alpha * tile;
+  }
+};
+
+// res = rowScale * colScale * sum_k (lhs(i, k) - rowZero) * (rhs(k, j) - colZero), where the sum is expanded as
+// tile - colZero * rowSum - rowZero * (colSum - depth * colZero) with the sums of the lhs rows and rhs columns.
+struct int8_gemm_dequantize_epilogue {
+  enum { FullDepth = true };
+  const int32_t* rowZero;
+  const float* rowScale;
+  const int32_t* rowSum;
+  const int32_t* colZero;
+  const float* colScale;
+  const int32_t* colSum;
+  int32_t depth;
+
+  int8_gemm_dequantize_epilogue transposed() const {
+    return int8_gemm_dequantize_epilogue{colZero, colScale, colSum, rowZero, rowScale, rowSum, depth};
+  }
+
+  template <typename Traits>
+  EIGEN_ALWAYS_INLINE void store(const int8_gemm_res_mapper<float>& res, Index i, Index j,
+                                 const int8_gemm_tile<Traits>& tile) const {
+    const Index m = tile.rows(), row = res.row + i, col = res.col + j;
+    Map<const ArrayXi> zr(rowZero + row, m), sr(rowSum + row, m);
+    Map<const ArrayXf> scale(rowScale + row, m);
+    for (Index jj = 0; jj < tile.cols(); ++jj) {
+      const int32_t zc = colZero[col + jj], sc = colSum[col + jj] - depth * zc;
+      res.block(i, j + jj, m, 1).array() =
+          (tile.col(jj).array() - zc * sr - sc * zr).template cast<float>() * (colScale[col + jj] * scale);
+    }
+  }
+};
+
+// Runs the micro kernel over all the micro panels of a packed block and hands the tiles to the epilogue.
+template <typename Traits, typename Epilogue>
+struct int8_gebp_kernel {
+  const Epilogue& epilogue;
+
+  template <typename ResMapper, typename Alpha>
+  void operator()(const ResMapper& res, const typename Traits::LhsPacked* blockA, const int8_t* blockB, Index rows,
+                  Index depth, Index cols, Alpha /*unused*/) const {
+    enum { mr = Traits::mr, nr = Traits::nr };
+    const Index groups = Traits::groups(depth);
+    const Index lhsPanelSize = Traits::lhsPanelSize(depth), rhsPanelSize = Traits::rhsPanelSize(depth);
+    EIGEN_ALIGN_MAX int32_t tile[mr * nr];
+    for (Index j = 0; j < cols; j += nr, blockB += rhsPanelSize) {
+      const typename Traits::LhsPacked* A = blockA;
+      for (Index i = 0; i < rows; i += mr, A += lhsPanelSize) {
+        int8_gemm_micro_kernel<Traits>::run(A, blockB, groups, tile);
+        epilogue.template store<Traits>(
+            res, i, j,
+            int8_gemm_tile<Traits>(tile, numext::mini(Index(mr), rows - i), numext::mini(Index(nr), cols - j)));
+      }
+    }
+  }
+};
+
+// Sequential int8 GEMM over a block of the result, following general_matrix_matrix_product:
+// a row-major result is computed as the transposed product.
+template <typename Index, int LhsStorageOrder, int RhsStorageOrder, int ResStorageOrder>
+struct int8_gemm_kernel;
+
+template <typename Index, int LhsStorageOrder, int RhsStorageOrder>
+struct int8_gemm_kernel<Index, LhsStorageOrder, RhsStorageOrder, RowMajor> {
+  template <typename ResScalar, typename Epilogue>
+  static void run(Index rows, Index cols, Index depth, const int8_t* lhs, Index lhsStride, const int8_t* rhs,
+                  Index rhsStride, const int8_gemm_res_mapper<ResScalar>& res, const Epilogue& epilogue) {
+    int8_gemm_kernel<Index, RhsStorageOrder == RowMajor ? ColMajor : RowMajor,
+                     LhsStorageOrder == RowMajor ? ColMajor : RowMajor, ColMajor>::run(cols, rows, depth, rhs,
+                                                                                       rhsStride, lhs, lhsStride, res,
+                                                                                       epilogue.transposed());
+  }
+};
+
+template <typename Index, int LhsStorageOrder, int RhsStorageOrder>
+struct int8_gemm_kernel<Index, LhsStorageOrder, RhsStorageOrder, ColMajor> {
+  using Traits = int8_gemm_traits;
+
+  template <typename ResScalar, typename Epilogue>
+  static void run(Index rows, Index cols, Index depth, const int8_t* lhs_, Index lhsStride, const int8_t* rhs_,
+                  Index rhsStride, const int8_gemm_res_mapper<ResScalar>& res_, const Epilogue& epilogue) {
+    using LhsMapper = const_blas_data_mapper<int8_t, Index, LhsStorageOrder>;
+    using RhsMapper = const_blas_data_mapper<int8_t, Index, RhsStorageOrder>;
+    LhsMapper lhs(lhs_, lhsStride);
+    RhsMapper rhs(rhs_, rhsStride);
+    int8_gemm_res_mapper<ResScalar> res = res_;
+
+    Index kc = depth, mc = rows, nc = cols;
+    computeProductBlockingSizes<int8_t, int8_t>(kc, mc, nc);
+    if (Epilogue::FullDepth && kc < depth) {
+      // The epilogue needs complete sums: keep the whole depth in one block and shrink the panels accordingly.
+      const double shrink = double(kc) / double(depth);
+      mc = numext::mini(rows, numext::maxi(Index(Traits::mr), Index(double(mc) * shrink) / Traits::mr * Traits::mr));
+      nc = numext::mini(cols, numext::maxi(Index(Traits::nr), Index(double(nc) * shrink) / Traits::nr * Traits::nr));
+      kc = depth;
+    }
+
+    const Index sizeA = numext::div_ceil(mc, Index(Traits::mr)) * Traits::lhsPanelSize(kc);
+    const Index sizeB = numext::div_ceil(nc, Index(Traits::nr)) * Traits::rhsPanelSize(kc);
+    ei_declare_aligned_stack_constructed_variable(typename Traits::LhsPacked, blockA, sizeA, 0);
+    ei_declare_aligned_stack_constructed_variable(int8_t, blockB, sizeB, 0);
+
+    int8_gemm_pack_lhs<Traits, Index, typename LhsMapper::SubMapper> pack_lhs;
+    int8_gemm_pack_rhs<Traits, Index, typename RhsMapper::SubMapper> pack_rhs;
+    int8_gebp_kernel<Traits, Epilogue> gebp{epilogue};
+    gemm_pack_lhs_first_loop_policy::run(rows, cols, depth, kc, mc, nc, lhs, rhs, res, pack_lhs, pack_rhs, gebp,
+                                         blockA, blockB, int32_t(1));
+  }
+};
+
+// Adapter of an int8 product to parallelize_gemm and to the parallelizers of generic_product_impl::scaleAndAddTo.
+// Each call evaluates an independent block of the result and packs its own panels.
+template <int LhsOrder, int RhsOrder, int DstOrder, typename ResScalar, typename Epilogue>
+struct int8_gemm_functor
+    : gemm_panel_tiled_functor<int8_gemm_functor<LhsOrder, RhsOrder, DstOrder, ResScalar, Epilogue>> {
+  using Kernel = int8_gemm_kernel<Index, LhsOrder, RhsOrder, DstOrder>;
+  using Traits = int8_gemm_traits;
+  enum { TiledByRows = DstOrder == RowMajor };
+
+  int8_gemm_functor(const int8_t* lhs, Index lhsStride, const int8_t* rhs, Index rhsStride, ResScalar* dst,
+                    Index dstStride, Index rows, Index cols, Index depth, const Epilogue& epilogue)
+      : m_lhs(lhs),
+        m_lhsStride(lhsStride),
+        m_rhs(rhs),
+        m_rhsStride(rhsStride),
+        m_dst(dst),
+        m_dstStride(dstStride),
+        m_rows(rows),
+        m_cols(cols),
+        m_depth(depth),
+        m_epilogue(epilogue) {}
+
+  void initParallelSession(Index) const {}
+
+  void operator()(Index row, Index rows, Index col = 0, Index cols = -1, GemmParallelInfo<Index>* = 0) const {
+    if (cols == -1) cols = m_cols;
+    const bool lhsRowMajor = LhsOrder == RowMajor, rhsRowMajor = RhsOrder == RowMajor;
+    const bool dstRowMajor = DstOrder == RowMajor;
+    // In the transposed storage of a row-major result, (row, col) is at (col, row).
+    const int8_gemm_res_mapper<ResScalar> res{
+        m_dst + (dstRowMajor ? col + row * m_dstStride : row + col * m_dstStride), m_dstStride,
+        dstRowMajor ? col : row, dstRowMajor ? row : col};
+    Kernel::run(rows, cols, m_depth, m_lhs + (lhsRowMajor ? row * m_lhsStride : row), m_lhsStride,
+                m_rhs + (rhsRowMajor ? col : col * m_rhsStride), m_rhsStride, res, m_epilogue);
+  }
+
+  Index rows() const { return m_rows; }
+  Index cols() const { return m_cols; }
+
+ protected:
+  const int8_t* m_lhs;
+  Index m_lhsStride;
+  const int8_t* m_rhs;
+  Index m_rhsStride;
+  ResScalar* m_dst;
+  Index m_dstStride;
+  Index m_rows, m_cols, m_depth;
+  Epilogue m_epilogue;
+};
+
+// A.cast<int>() with A an int8 matrix with direct access and unit inner stride.
+template <typename Xpr>
+struct int8_gemm_operand {
+  enum { value = false };
+};
+
+template <typename ArgType>
+struct int8_gemm_operand<CwiseUnaryOp<core_cast_op<int8_t, int32_t>, ArgType>> {
+  using Arg = remove_all_t<ArgType>;
+  enum {
+    value = has_direct_access<Arg>::value && inner_stride_at_compile_time<Arg>::value == 1,
+    Order = (traits<Arg>::Flags & RowMajorBit) ? RowMajor : ColMajor
+  };
+  static const Arg& arg(const CwiseUnaryOp<core_cast_op<int8_t, int32_t>, ArgType>& xpr) {
+    return xpr.nestedExpression();
+  }
+};
+
+template <typename Lhs, typename Rhs, typename Dest>
+struct gemm_int8_product_enabled {
+  enum {
+    value = std::is_same<typename Dest::Scalar, int32_t>::value && bool(int8_gemm_operand<remove_all_t<Lhs>>::value) &&
+            bool(int8_gemm_operand<remove_all_t<Rhs>>::value) && inner_stride_at_compile_time<Dest>::value == 1
+  };
+};
+
+template <typename Lhs, typename Rhs, typename Dest, bool Enabled>
+struct gemm_int8_product {
+  enum { value = false };
+  template <typename Scalar, typename Parallelizer>
+  static void run(Dest&, const Lhs&, const Rhs&, const Scalar&, const Parallelizer&) {}
+};
+
+template <typename Lhs, typename Rhs, typename Dest>
+struct gemm_int8_product<Lhs, Rhs, Dest, true> {
+  enum { value = true };
+  using LhsOperand = int8_gemm_operand<remove_all_t<Lhs>>;
+  using RhsOperand = int8_gemm_operand<remove_all_t<Rhs>>;
+  enum { DstOrder = (traits<Dest>::Flags & RowMajorBit) ? RowMajor : ColMajor };
+
+  template <typename Parallelizer>
+  static void run(Dest& dst, const Lhs& a_lhs, const Rhs& a_rhs, int32_t alpha, const Parallelizer& parallelize) {
+    const auto& lhs = LhsOperand::arg(a_lhs);
+    const auto& rhs = RhsOperand::arg(a_rhs);
+    using Functor =
+        int8_gemm_functor<LhsOperand::Order, RhsOperand::Order, DstOrder, int32_t, int8_gemm_accumulate_epilogue>;
+    parallelize(Functor(lhs.data(), lhs.outerStride(), rhs.data(), rhs.outerStride(), dst.data(), dst.outerStride(),
+                        dst.rows(), dst.cols(), lhs.cols(), int8_gemm_accumulate_epilogue{alpha}),
+                dst.rows(), dst.cols(), lhs.cols(), int(DstOrder) == int(RowMajor));
+  }
+};
+
+}  // end namespace internal
+
+/** \ingroup Core_Module
+ *
+ * Computes the product of two int8 matrices quantized with per-row (\a lhs) and per-column (\a rhs)
+ * zero points and scales:
+ * \code
+ * dst(i, j) = lhsScales(i) * rhsScales(j) * sum_k (lhs(i, k) - lhsZeroPoints(i)) * (rhs(k, j) - rhsZeroPoints(j))
+ * \endcode
+ * The sums are accumulated exactly in int32 by the int8 GEMM kernels (VNNI or dot-product instructions when
+ * available), and the zero points and scales are applied while storing the float result, without an int32
+ * temporary. Per-tensor parameters are passed as constant vectors, e.g. <tt>VectorXi::Constant(rows, z)</tt>.
+ *
+ * \a lhs, \a rhs and \a dst must have direct access with a unit inner stride, and \a dst must not alias the
+ * operands. The products are exact for depths below 2^17. Like other products, this is multi-threaded
+ * according to setNbThreads().
+ *
+ * The raw int32 product is obtained with <tt>C.noalias() = A.cast<int>() * B.cast<int>()</tt>, which uses the
+ * same kernels.
+ */
+template <typename Lhs, typename Rhs, typename Dst>
+void quantizedProduct(const MatrixBase<Lhs>& lhs, const Ref<const VectorXi>& lhsZeroPoints,
+                      const Ref<const VectorXf>& lhsScales, const MatrixBase<Rhs>& rhs,
+                      const Ref<const VectorXi>& rhsZeroPoints, const Ref<const VectorXf>& rhsScales,
+                      const MatrixBase<Dst>& dst) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename Lhs::Scalar, int8_t>::value &&
+                       std::is_same<typename Rhs::Scalar, int8_t>::value &&
+                       std::is_same<typename Dst::Scalar, float>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  EIGEN_STATIC_ASSERT((bool(internal::traits<Lhs>::Flags & DirectAccessBit) &&
+                       bool(internal::traits<Rhs>::Flags & DirectAccessBit) &&
+                       bool(internal::traits<Dst>::Flags & DirectAccessBit)),
+                      THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_WITH_DIRECT_MEMORY_ACCESS_SUCH_AS_MAP_OR_PLAIN_MATRICES)
+  EIGEN_STATIC_ASSERT(Lhs::InnerStrideAtCompileTime == 1 && Rhs::InnerStrideAtCompileTime == 1 &&
+                          Dst::InnerStrideAtCompileTime == 1,
+                      THIS_METHOD_IS_ONLY_FOR_EXPRESSIONS_WITH_DIRECT_MEMORY_ACCESS_SUCH_AS_MAP_OR_PLAIN_MATRICES)
+  eigen_assert(lhs.cols() == rhs.rows() && dst.rows() == lhs.rows() && dst.cols() == rhs.cols() &&
+               "invalid matrix product");
+  eigen_assert(lhsZeroPoints.size() == lhs.rows() && lhsScales.size() == lhs.rows() &&
+               rhsZeroPoints.size() == rhs.cols() && rhsScales.size() == rhs.cols() &&
+               "quantizedProduct: one zero point and scale per row of lhs and per column of rhs");
+  const Index rows = dst.rows(), cols = dst.cols(), depth = lhs.cols();
+  if (rows == 0 || cols == 0) return;
+  Dst& actualDst = dst.const_cast_derived();
+  if (depth == 0) {
+    actualDst.setZero();
+    return;
+  }
+
+  const VectorXi lhsSums = lhs.derived().template cast<int32_t>().rowwise().sum();
+  const RowVectorXi rhsSums = rhs.derived().template cast<int32_t>().colwise().sum();
+  const internal::int8_gemm_dequantize_epilogue epilogue{lhsZeroPoints.data(), lhsScales.data(),
+                                                         lhsSums.data(),       rhsZeroPoints.data(),
+                                                         rhsScales.data(),     rhsSums.data(),
+                                                         static_cast<int32_t>(depth)};
+
+  enum {
+    LhsOrder = (internal::traits<Lhs>::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    RhsOrder = (internal::traits<Rhs>::Flags & RowMajorBit) ? RowMajor : ColMajor,
+    DstOrder = (internal::traits<Dst>::Flags & RowMajorBit) ? RowMajor : ColMajor
+  };
+  using Functor =
+      internal::int8_gemm_functor<LhsOrder, RhsOrder, DstOrder, float, internal::int8_gemm_dequantize_epilogue>;
+  internal::parallelize_gemm<true>(
+      Functor(lhs.derived().data(), lhs.derived().outerStride(), rhs.derived().data(), rhs.derived().outerStride(),
+              actualDst.data(), actualDst.outerStride(), rows, cols, depth, epilogue),
+      rows, cols, depth, int(DstOrder) == int(RowMajor));
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_GENERAL_MATRIX_MATRIX_INT8_H
@@ -0,0 +1,321 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_GENERAL_MATRIX_MATRIX_PACKED_H
+#define EIGEN_GENERAL_MATRIX_MATRIX_PACKED_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+// Destinations the packed kernel can write to in place: column-major with unit inner stride.
+template <typename Dest>
+struct packed_gemm_direct_dest {
+  enum {
+    value = bool(traits<Dest>::Flags & DirectAccessBit) && !bool(traits<Dest>::Flags & RowMajorBit) &&
+            int(Dest::InnerStrideAtCompileTime) == 1
+  };
+};
+
+template <typename Dest, bool Direct = packed_gemm_direct_dest<Dest>::value>
+struct packed_gemm_dest {
+  template <typename Packed, typename OtherRef>
+  static void run(const Packed& packed, const OtherRef& other, Dest& dst, const typename Packed::Scalar& alpha,
+                  bool accumulate) {
+    if (!accumulate) dst.setZero();
+    packed.template runKernel<(OtherRef::Flags & RowMajorBit) ? RowMajor : ColMajor>(
+        other.data(), other.outerStride(), other.rows(), other.cols(), dst.data(), dst.outerStride(), alpha);
+  }
+};
+
+// Other destinations are evaluated through a column-major temporary.
+template <typename Dest>
+struct packed_gemm_dest<Dest, false> {
+  template <typename Packed, typename OtherRef>
+  static void run(const Packed& packed, const OtherRef& other, Dest& dst, const typename Packed::Scalar& alpha,
+                  bool accumulate) {
+    typedef Matrix<typename Packed::Scalar, Dynamic, Dynamic, ColMajor> Tmp;
+    Tmp tmp = accumulate ? Tmp(dst) : Tmp(Tmp::Zero(dst.rows(), dst.cols()));
+    packed_gemm_dest<Tmp, true>::run(packed, other, tmp, alpha, true);
+    dst = tmp;
+  }
+};
+
+}  // end namespace internal
+
+/** \class PackedMatrix
+ * \ingroup Core_Module
+ *
+ * \brief A matrix stored in the packed panel layout consumed by the GEMM kernel
+ *
+ * \tparam Scalar_ the scalar type of the matrix and of the products it is used in
+ * \tparam Side_ \c OnTheLeft (the default) if the matrix is the left-hand side of the products,
+ *               \c OnTheRight if it is the right-hand side
+ *
+ * A matrix product \c W*X first copies blocks of both operands into the panel layout expected by
+ * the gebp micro-kernel (gemm_pack_lhs/gemm_pack_rhs), which is wasted work when the same \c W is
+ * multiplied many times, e.g. a weight matrix in an inference loop. A PackedMatrix performs this
+ * packing once, for the architecture's gebp_traits, so that later products only pack the other
+ * operand:
+ * \code
+ * PackedMatrix<float> Wp(W);    // pack once
+ * for (...) {
+ *   Wp.multiply(X, Y);          // Y = W * X
+ *   Wp.multiplyAdd(X, Z, 2.f);  // Z += 2 * W * X
+ * }
+ * PackedMatrix<float, OnTheRight> Vp(V);
+ * Vp.multiply(X, Y);            // Y = X * V
+ * \endcode
+ * With a packed left-hand side, each column block of \c X is packed exactly once per product, which
+ * is the dominant saving for tall-skinny \c X. Products are multi-threaded like regular ones (see
+ * setNbThreads()), by splitting the columns (resp. rows) of the result across threads.
+ *
+ * The packed copy is a snapshot: call compute() again after modifying the original matrix. The
+ * layout depends on the cache sizes at packing time (see setCpuCacheSizes()) and on the instruction
+ * set the code is compiled for, so a PackedMatrix must not be shared between translation units
+ * compiled with different vectorization flags.
+ *
+ * \sa batchedProduct()
+ */
+template <typename Scalar_, int Side_ = OnTheLeft>
+class PackedMatrix {
+ public:
+  typedef Scalar_ Scalar;
+  enum { Side = Side_ };
+  typedef internal::gebp_traits<Scalar, Scalar> Traits;
+
+  PackedMatrix() : m_rows(0), m_cols(0), m_kc(0), m_bc(0) {}
+
+  /** Packs \a mat. \sa compute() */
+  template <typename Derived>
+  explicit PackedMatrix(const MatrixBase<Derived>& mat) : m_rows(0), m_cols(0), m_kc(0), m_bc(0) {
+    compute(mat);
+  }
+
+  /** Packs \a mat, discarding any previously packed matrix. */
+  template <typename Derived>
+  PackedMatrix& compute(const MatrixBase<Derived>& mat) {
+    EIGEN_STATIC_ASSERT((std::is_same<typename Derived::Scalar, Scalar>::value),
+                        YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+    enum { Order = Derived::IsRowMajor ? RowMajor : ColMajor };
+    Ref<const Matrix<Scalar, Dynamic, Dynamic, Order>, 0, OuterStride<>> ref(mat.derived());
+    m_rows = ref.rows();
+    m_cols = ref.cols();
+    pack<Order>(ref.data(), ref.outerStride());
+    return *this;
+  }
+
+  /** \returns the number of rows of the packed matrix */
+  Index rows() const { return m_rows; }
+  /** \returns the number of columns of the packed matrix */
+  Index cols() const { return m_cols; }
+
+  /** Computes \a dst = \c *this * \a other if \c Side is \c OnTheLeft, and \a dst = \a other * \c *this
+   * otherwise. \a dst must have the size of the result and must not alias \a other. */
+  template <typename OtherDerived, typename Dest>
+  void multiply(const MatrixBase<OtherDerived>& other, const MatrixBase<Dest>& dst) const {
+    run(other, dst.const_cast_derived(), Scalar(1), false);
+  }
+
+  /** Computes \a dst += \a alpha * \c *this * \a other if \c Side is \c OnTheLeft, and
+   * \a dst += \a alpha * \a other * \c *this otherwise. */
+  template <typename OtherDerived, typename Dest>
+  void multiplyAdd(const MatrixBase<OtherDerived>& other, const MatrixBase<Dest>& dst,
+                   const Scalar& alpha = Scalar(1)) const {
+    run(other, dst.const_cast_derived(), alpha, true);
+  }
+
+  /** \internal Accumulates alpha * (*this) * other (or alpha * other * (*this)) into the column-major
+   * result \a res. */
+  template <int OtherOrder>
+  void runKernel(const Scalar* other, Index otherStride, Index otherRows, Index otherCols, Scalar* res,
+                 Index resStride, const Scalar& alpha) const {
+    EIGEN_IF_CONSTEXPR (int(Side) == OnTheLeft) {
+      runLhsKernel<OtherOrder>(other, otherStride, otherCols, res, resStride, alpha);
+    } else {
+      runRhsKernel<OtherOrder>(other, otherStride, otherRows, res, resStride, alpha);
+    }
+  }
+
+ protected:
+  typedef internal::blas_data_mapper<Scalar, Index, ColMajor, Unaligned, 1> ResMapper;
+  typedef internal::gebp_kernel<Scalar, Scalar, Index, ResMapper, Traits::mr, Traits::nr, false, false> Gebp;
+
+  // Extent of the packed matrix along the depth of the products, and along the other dimension.
+  Index depth() const { return int(Side) == OnTheLeft ? m_cols : m_rows; }
+  Index size() const { return int(Side) == OnTheLeft ? m_rows : m_cols; }
+
+  const Scalar* panel(Index i, Index k) const {
+    return m_data.data() + m_offsets[i * numext::div_ceil(depth(), m_kc) + k];
+  }
+
+  template <typename OtherDerived, typename Dest>
+  void run(const MatrixBase<OtherDerived>& other, Dest& dst, const Scalar& alpha, bool accumulate) const {
+    EIGEN_STATIC_ASSERT((std::is_same<typename OtherDerived::Scalar, Scalar>::value),
+                        YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+    enum { OtherOrder = OtherDerived::IsRowMajor ? RowMajor : ColMajor };
+    typedef Ref<const Matrix<Scalar, Dynamic, Dynamic, OtherOrder>, 0, OuterStride<>> OtherRef;
+    OtherRef ref(other.derived());
+    if (int(Side) == OnTheLeft) {
+      eigen_assert(ref.rows() == m_cols && dst.rows() == m_rows && dst.cols() == ref.cols() &&
+                   "invalid packed matrix product");
+    } else {
+      eigen_assert(ref.cols() == m_rows && dst.rows() == ref.rows() && dst.cols() == m_cols &&
+                   "invalid packed matrix product");
+    }
+    if (dst.size() == 0) return;
+    if (depth() == 0) {
+      if (!accumulate) dst.setZero();
+      return;
+    }
+    internal::packed_gemm_dest<Dest>::run(*this, ref, dst, alpha, accumulate);
+  }
+
+  template <int Order>
+  void pack(const Scalar* data, Index stride) {
+    typedef internal::const_blas_data_mapper<Scalar, Index, Order> Mapper;
+    const Index k = depth(), n = size();
+    m_offsets.clear();
+    m_data.resize(0);
+    if (k == 0 || n == 0) return;
+
+    // Blocking along the depth follows the regular GEMM heuristic (the packed panels are streamed
+    // through L1); for the other dimension, a square product is assumed.
+    m_kc = k;
+    m_bc = n;
+    Index other = n;
+    if (int(Side) == OnTheLeft)
+      internal::computeProductBlockingSizes<Scalar, Scalar>(m_kc, m_bc, other);
+    else
+      internal::computeProductBlockingSizes<Scalar, Scalar>(m_kc, other, m_bc);
+
+    // Each kc x bc panel starts on a packet boundary, as required by the aligned loads of gebp.
+    const Index align = numext::maxi<Index>(1, EIGEN_MAX_ALIGN_BYTES / Index(sizeof(Scalar)));
+    const Index nk = numext::div_ceil(k, m_kc), nb = numext::div_ceil(n, m_bc);
+    m_offsets.resize(nb * nk + 1);
+    m_offsets[0] = 0;
+    for (Index b = 0; b < nb; ++b) {
+      const Index actual_bc = numext::mini(m_bc, n - b * m_bc);
+      for (Index kb = 0; kb < nk; ++kb) {
+        const Index actual_kc = numext::mini(m_kc, k - kb * m_kc);
+        m_offsets[b * nk + kb + 1] = m_offsets[b * nk + kb] + numext::div_ceil(actual_bc * actual_kc, align) * align;
+      }
+    }
+    m_data.resize(m_offsets.back());
+
+    Mapper mapper(data, stride);
+    for (Index b = 0; b < nb; ++b) {
+      const Index i2 = b * m_bc, actual_bc = numext::mini(m_bc, n - i2);
+      for (Index kb = 0; kb < nk; ++kb) {
+        const Index k2 = kb * m_kc, actual_kc = numext::mini(m_kc, k - k2);
+        Scalar* dst = m_data.data() + m_offsets[b * nk + kb];
+        EIGEN_IF_CONSTEXPR (int(Side) == OnTheLeft) {
+          internal::gemm_pack_lhs<Scalar, Index, Mapper, Traits::mr, Traits::LhsProgress,
+                                  typename Traits::LhsPacket4Packing, Order>
+              pack_lhs;
+          pack_lhs(dst, mapper.getSubMapper(i2, k2), actual_kc, actual_bc);
+        } else {
+          internal::gemm_pack_rhs<Scalar, Index, Mapper, Traits::nr, Order> pack_rhs;
+          pack_rhs(dst, mapper.getSubMapper(k2, i2), actual_kc, actual_bc);
+        }
+      }
+    }
+  }
+
+  static int threadsFor(Index rows, Index cols, Index depth, Index panels) {
+    const double work = static_cast<double>(rows) * static_cast<double>(cols) * static_cast<double>(depth);
+    return static_cast<int>(numext::mini<Index>(panels, internal::parallel_threads_for_work(work)));
+  }
+
+  // res += alpha * packed * rhs, with the packed matrix as the m x k lhs.
+  template <int RhsOrder>
+  void runLhsKernel(const Scalar* rhs_, Index rhsStride, Index cols, Scalar* res_, Index resStride,
+                    const Scalar& alpha) const {
+    typedef internal::const_blas_data_mapper<Scalar, Index, RhsOrder> RhsMapper;
+    const Index rows = m_rows, depth = m_cols, nk = numext::div_ceil(depth, m_kc);
+    RhsMapper rhs(rhs_, rhsStride);
+    ResMapper res(res_, resStride);
+
+    Index kc = m_kc, mc = m_bc, nc = cols;
+    internal::computeProductBlockingSizes<Scalar, Scalar>(kc, mc, nc);
+
+    // Since the lhs is already packed, the rhs-first loop order packs each kc x nc block of the rhs
+    // exactly once and streams all the packed lhs panels through it.
+    auto task = [&](Index begin, Index end) {
+      const Index j_begin = begin * Traits::nr, j_end = numext::mini(end * Traits::nr, cols);
+      internal::gemm_pack_rhs<Scalar, Index, RhsMapper, Traits::nr, RhsOrder> pack_rhs;
+      Gebp gebp;
+      ei_declare_aligned_stack_constructed_variable(Scalar, blockB, m_kc * nc, 0);
+      for (Index j2 = j_begin; j2 < j_end; j2 += nc) {
+        const Index actual_nc = numext::mini(j2 + nc, j_end) - j2;
+        for (Index kb = 0; kb < nk; ++kb) {
+          const Index k2 = kb * m_kc, actual_kc = numext::mini(m_kc, depth - k2);
+          pack_rhs(blockB, rhs.getSubMapper(k2, j2), actual_kc, actual_nc);
+          for (Index i2 = 0; i2 < rows; i2 += m_bc) {
+            const Index actual_mc = numext::mini(m_bc, rows - i2);
+            gebp(res.getSubMapper(i2, j2), panel(i2 / m_bc, kb), blockB, actual_mc, actual_kc, actual_nc, alpha);
+          }
+        }
+      }
+    };
+    const Index panels = numext::div_ceil(cols, Index(Traits::nr));
+    internal::parallelize_range(task, panels, threadsFor(rows, cols, depth, panels));
+  }
+
+  // res += alpha * lhs * packed, with the packed matrix as the k x n rhs.
+  template <int LhsOrder>
+  void runRhsKernel(const Scalar* lhs_, Index lhsStride, Index rows, Scalar* res_, Index resStride,
+                    const Scalar& alpha) const {
+    typedef internal::const_blas_data_mapper<Scalar, Index, LhsOrder> LhsMapper;
+    const Index cols = m_cols, depth = m_rows, nk = numext::div_ceil(depth, m_kc);
+    LhsMapper lhs(lhs_, lhsStride);
+    ResMapper res(res_, resStride);
+
+    Index kc = m_kc, mc = rows, nc = m_bc;
+    internal::computeProductBlockingSizes<Scalar, Scalar>(kc, mc, nc);
+
+    // Mirror of runLhsKernel: each mc x kc block of the lhs is packed once and multiplied by all the
+    // packed rhs panels.
+    auto task = [&](Index begin, Index end) {
+      const Index i_begin = begin * Traits::mr, i_end = numext::mini(end * Traits::mr, rows);
+      internal::gemm_pack_lhs<Scalar, Index, LhsMapper, Traits::mr, Traits::LhsProgress,
+                              typename Traits::LhsPacket4Packing, LhsOrder>
+          pack_lhs;
+      Gebp gebp;
+      ei_declare_aligned_stack_constructed_variable(Scalar, blockA, m_kc * mc, 0);
+      for (Index i2 = i_begin; i2 < i_end; i2 += mc) {
+        const Index actual_mc = numext::mini(i2 + mc, i_end) - i2;
+        for (Index kb = 0; kb < nk; ++kb) {
+          const Index k2 = kb * m_kc, actual_kc = numext::mini(m_kc, depth - k2);
+          pack_lhs(blockA, lhs.getSubMapper(i2, k2), actual_kc, actual_mc);
+          for (Index j2 = 0; j2 < cols; j2 += m_bc) {
+            const Index actual_nc = numext::mini(m_bc, cols - j2);
+            gebp(res.getSubMapper(i2, j2), blockA, panel(j2 / m_bc, kb), actual_mc, actual_kc, actual_nc, alpha);
+          }
+        }
+      }
+    };
+    const Index panels = numext::div_ceil(rows, Index(Traits::mr));
+    internal::parallelize_range(task, panels, threadsFor(rows, cols, depth, panels));
+  }
+
+  Index m_rows, m_cols;
+  Index m_kc;  // blocking size along the depth
+  Index m_bc;  // blocking size along the other dimension (mc for a lhs, nc for a rhs)
+  // Offsets of the packed panels within m_data, ordered by block of rows (resp. columns) first.
+  std::vector<Index> m_offsets;
+  Matrix<Scalar, Dynamic, 1> m_data;
+};
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_GENERAL_MATRIX_MATRIX_PACKED_H
@@ -686,6 +686,42 @@ general_matrix_vector_product<Index, LhsScalar, LhsMapper, RowMajor, ConjugateLh
   }
 }
 
+/* Multi-threaded GEMV: res += alpha * lhs * rhs is split into blocks of rows of lhs and res, which are independent
+ * products run with the sequential kernel Gemv. This applies to both storage orders: each thread performs the axpy
+ * updates of its rows for the col-major kernel, and the dot products of its rows for the row-major one. As for
+ * parallelize_gemm, the threads come from the OpenMP team or from the GEMM ThreadPool, limited by nbThreads(), and
+ * nested calls run sequentially. Since GEMV is bound by the memory bandwidth, it is only split when each thread gets
+ * a large enough block of lhs. With parallel = false, Gemv runs the whole product on the calling thread.
+ */
+template <typename Gemv, typename LhsMapper, typename RhsMapper, typename ResScalar, typename AlphaScalar>
+void parallelize_gemv(Index rows, Index cols, const LhsMapper& lhs, const RhsMapper& rhs, ResScalar* res,
+                      Index resIncr, AlphaScalar alpha, bool parallel) {
+#if !defined(EIGEN_USE_BLAS) && (defined(EIGEN_HAS_OPENMP) || defined(EIGEN_GEMM_THREADPOOL))
+  // Rows are distributed in blocks spanning several iterations of the row loops of the kernels.
+  const Index kRowBlock = 64;
+  // Minimum number of coefficients of lhs per thread.
+  const double kMinTaskSize = 65536;
+  const double work = static_cast<double>(rows) * static_cast<double>(cols);
+  if (parallel && work >= 2 * kMinTaskSize && rows >= 2 * kRowBlock) {
+    const Index blocks = numext::div_ceil(rows, kRowBlock);
+    const Index max_threads = numext::mini<Index>(blocks, static_cast<Index>(work / kMinTaskSize));
+    const int threads = static_cast<int>(numext::mini<Index>(nbThreads(), max_threads));
+    if (threads > 1) {
+      auto task = [&](Index begin, Index end) {
+        const Index i = begin * kRowBlock;
+        const Index actual_rows = numext::mini(rows, end * kRowBlock) - i;
+        Gemv::run(actual_rows, cols, lhs.getSubMapper(i, 0), rhs, res + i * resIncr, resIncr, alpha);
+      };
+      parallelize_range(task, blocks, threads);
+      return;
+    }
+  }
+#else
+  EIGEN_UNUSED_VARIABLE(parallel);
+#endif
+  Gemv::run(rows, cols, lhs, rhs, res, resIncr, alpha);
+}
+
 }  // end namespace internal
 
 }  // end namespace Eigen
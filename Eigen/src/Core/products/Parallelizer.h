@@ -62,6 +62,31 @@ inline int nbThreads() {
  * \sa nbThreads */
 inline void setNbThreads(int v) { internal::manage_multi_threading(SetAction, &v); }
 
+namespace internal {
+inline bool& gemm_dynamic_scheduling() {
+  static bool m_dynamic = false;
+  return m_dynamic;
+}
+}  // namespace internal
+
+/** Selects how multi-threaded matrix-matrix products share the work between threads.
+ *
+ * By default (\a dynamic = \c false), the result is split into one static slab per thread, and the threads
+ * synchronize on each other after packing their part of the left-hand side. This is the fastest schedule when all
+ * the threads run uninterrupted, but a single preempted thread stalls the whole product. With \a dynamic = \c true,
+ * the result is cut into many cache-sized tiles that idle threads pick one at a time, so that the progress of the
+ * product does not depend on any particular thread; this is more robust on loaded or shared machines.
+ *
+ * This only affects the OpenMP and \c EIGEN_GEMM_THREADPOOL backends. Like setNbThreads(), it must not be called
+ * while a product is running.
+ *
+ * \sa gemmDynamicScheduling(), setNbThreads() */
+inline void setGemmDynamicScheduling(bool dynamic) { internal::gemm_dynamic_scheduling() = dynamic; }
+
+/** \returns whether multi-threaded matrix-matrix products use dynamic tile scheduling
+ * \sa setGemmDynamicScheduling() */
+inline bool gemmDynamicScheduling() { return internal::gemm_dynamic_scheduling(); }
+
 #ifdef EIGEN_GEMM_THREADPOOL
 // Sets the ThreadPool used by Eigen parallel Gemm.
 //
@@ -69,8 +94,10 @@ inline void setNbThreads(int v) { internal::manage_multi_threading(SetAction, &v
 // parallelize_gemm below, and should not be called while
 // an instance of that function is running.
 //
-// TODO(rmlarsen): Make the device API available instead of
-// storing a local static pointer variable to avoid this issue.
+// Products evaluated on a device, i.e.
+//   dst.device(CoreThreadPoolDevice(pool)).noalias() = a * b;
+// use the pool of that device instead, which avoids this issue and
+// allows different callers to use different pools concurrently.
 inline ThreadPool* setGemmThreadPool(ThreadPool* new_pool) {
   static ThreadPool* pool = nullptr;
   if (new_pool != nullptr) {
@@ -91,6 +118,16 @@ inline ThreadPool* getGemmThreadPool() { return setGemmThreadPool(nullptr); }
 
 namespace internal {
 
+// Minimum amount of work, in multiply-adds, given to each thread of a parallel product.
+// FIXME: tune this minimum task-size heuristic based on architecture and scalar type.
+constexpr double kParallelMinTaskSize = 50000;
+
+// \returns the number of threads worth using for a product of \a work multiply-adds: work / kParallelMinTaskSize,
+// limited to nbThreads(). This is the thread count given to parallelize_range by the kernels built on it.
+inline int parallel_threads_for_work(double work) {
+  return static_cast<int>(numext::mini<double>(nbThreads(), work / kParallelMinTaskSize));
+}
+
 // Implementation.
 
 #if defined(EIGEN_USE_BLAS) || (!defined(EIGEN_HAS_OPENMP) && !defined(EIGEN_GEMM_THREADPOOL))
@@ -112,6 +149,10 @@ EIGEN_STRONG_INLINE void parallelize_gemm(const Functor& func, Index rows, Index
                                           bool /*unused*/) {
   func(0, rows, 0, cols);
 }
+template <typename Functor>
+EIGEN_STRONG_INLINE void parallelize_range(const Functor& func, Index size, int /*unused*/) {
+  func(0, size);
+}
 
 #else
 
@@ -185,15 +226,12 @@ EIGEN_STRONG_INLINE void parallelize_gemm(const Functor& func, Index rows, Index
 
   // compute the maximal number of threads from the total amount of work:
   double work = static_cast<double>(rows) * static_cast<double>(cols) * static_cast<double>(depth);
-  double kMinTaskSize = 50000;  // FIXME: tune this minimum task-size heuristic based on architecture and scalar type.
-  pb_max_threads = std::max<Index>(1, std::min<Index>(pb_max_threads, static_cast<Index>(work / kMinTaskSize)));
-
   // compute the number of threads we are going to use
-  int threads = std::min<int>(nbThreads(), static_cast<int>(pb_max_threads));
+  int threads = static_cast<int>(std::min<Index>(pb_max_threads, parallel_threads_for_work(work)));
 
   // if multi-threading is explicitly disabled, not useful, or if we already are
-  // inside a parallel session, then abort multi-threading
-  bool dont_parallelize = (!Condition) || (threads <= 1);
+  // inside a parallel session or a sequential_products_scope, then abort multi-threading
+  bool dont_parallelize = (!Condition) || (threads <= 1) || sequential_products_scope::active();
 #if defined(EIGEN_HAS_OPENMP)
   // don't parallelize if we are executing in a parallel context already.
   dont_parallelize |= omp_get_num_threads() > 1;
@@ -206,6 +244,32 @@ EIGEN_STRONG_INLINE void parallelize_gemm(const Functor& func, Index rows, Index
   dont_parallelize |= (pool == nullptr || pool->CurrentThreadId() != -1);
 #endif
   if (dont_parallelize) return func(0, rows, 0, cols);
+#ifdef EIGEN_PARALLEL_PRODUCT_PLUGIN
+  EIGEN_PARALLEL_PRODUCT_PLUGIN
+#endif
+
+  if (gemmDynamicScheduling()) {
+    // Tiles are distributed by the functor itself, each thread just runs the worker loop.
+#if defined(EIGEN_HAS_OPENMP)
+    func.runTiled(threads, [threads](const auto& worker) {
+#pragma omp parallel num_threads(threads)
+      worker();
+    });
+#elif defined(EIGEN_GEMM_THREADPOOL)
+    func.runTiled(threads, [pool, threads](const auto& worker) {
+      Barrier barrier(threads - 1);
+      for (int i = 0; i < threads - 1; ++i) {
+        pool->Schedule([&worker, &barrier]() {
+          worker();
+          barrier.Notify();
+        });
+      }
+      worker();
+      barrier.Wait();
+    });
+#endif
+    return;
+  }
 
   func.initParallelSession(threads);
 
@@ -277,6 +341,47 @@ EIGEN_STRONG_INLINE void parallelize_gemm(const Functor& func, Index rows, Index
 #endif
 }
 
+// Runs func(begin, end) over [0, size) split into at most `threads` contiguous
+// chunks of independent work (e.g. the matrices of a batched product), using
+// the same OpenMP team or GEMM ThreadPool as parallelize_gemm. Like
+// parallelize_gemm, it falls back to a single serial call when nested inside a
+// parallel region or a sequential_products_scope.
+template <typename Functor>
+void parallelize_range(const Functor& func, Index size, int threads) {
+  threads = static_cast<int>(numext::mini<Index>(threads, size));
+  bool dont_parallelize = threads <= 1 || sequential_products_scope::active();
+#if defined(EIGEN_HAS_OPENMP)
+  dont_parallelize |= omp_get_num_threads() > 1;
+#elif defined(EIGEN_GEMM_THREADPOOL)
+  ThreadPool* pool = getGemmThreadPool();
+  dont_parallelize |= (pool == nullptr || pool->CurrentThreadId() != -1);
+#endif
+  if (dont_parallelize) return func(0, size);
+#ifdef EIGEN_PARALLEL_PRODUCT_PLUGIN
+  EIGEN_PARALLEL_PRODUCT_PLUGIN
+#endif
+
+#if defined(EIGEN_HAS_OPENMP)
+#pragma omp parallel num_threads(threads)
+  {
+    const Index i = omp_get_thread_num();
+    const Index actual_threads = omp_get_num_threads();
+    func(i * size / actual_threads, (i + 1) * size / actual_threads);
+  }
+#elif defined(EIGEN_GEMM_THREADPOOL)
+  Barrier barrier(threads);
+  for (int i = 0; i < threads - 1; ++i) {
+    pool->Schedule([=, &func, &barrier]() {
+      func(i * size / threads, (i + 1) * size / threads);
+      barrier.Notify();
+    });
+  }
+  func((threads - 1) * size / threads, size);
+  barrier.Notify();
+  barrier.Wait();
+#endif
+}
+
 #endif
 
 }  // end namespace internal
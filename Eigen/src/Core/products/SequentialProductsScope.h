@@ -0,0 +1,59 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_SEQUENTIAL_PRODUCTS_SCOPE_H
+#define EIGEN_SEQUENTIAL_PRODUCTS_SCOPE_H
+
+// IWYU pragma: private
+#include "../InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+#ifndef EIGEN_AVOID_THREAD_LOCAL
+inline int& sequential_products_depth() {
+  static thread_local int depth = 0;
+  return depth;
+}
+#endif
+
+// While an object of this class is alive, the products of the calling thread run on that thread only: parallelize_gemm
+// and parallelize_range do not split them. The tasks of a CoreThreadPoolDevice run in such a scope. Those tasks already
+// use all the threads of the device, and parallelize_gemm only detects nesting inside an OpenMP team or on the GEMM
+// ThreadPool, so each of them would otherwise start nbThreads() more threads. Without thread-local storage
+// (EIGEN_AVOID_THREAD_LOCAL), this class has no effect.
+class sequential_products_scope {
+ public:
+  sequential_products_scope() {
+#ifndef EIGEN_AVOID_THREAD_LOCAL
+    ++sequential_products_depth();
+#endif
+  }
+  ~sequential_products_scope() {
+#ifndef EIGEN_AVOID_THREAD_LOCAL
+    --sequential_products_depth();
+#endif
+  }
+  sequential_products_scope(const sequential_products_scope&) = delete;
+  sequential_products_scope& operator=(const sequential_products_scope&) = delete;
+
+  // \returns whether the calling thread is inside a sequential_products_scope.
+  static bool active() {
+#ifndef EIGEN_AVOID_THREAD_LOCAL
+    return sequential_products_depth() > 0;
+#else
+    return false;
+#endif
+  }
+};
+
+}  // end namespace internal
+}  // end namespace Eigen
+
+#endif  // EIGEN_SEQUENTIAL_PRODUCTS_SCOPE_H
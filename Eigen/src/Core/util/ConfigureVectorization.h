@@ -264,6 +264,9 @@
 #ifndef EIGEN_USE_SYCL
 #define EIGEN_VECTORIZE_AVX2
 #define EIGEN_VECTORIZE_AVX
+#ifdef __AVXVNNI__
+#define EIGEN_VECTORIZE_AVXVNNI
+#endif
 #endif
 #define EIGEN_VECTORIZE_SSE3
 #define EIGEN_VECTORIZE_SSSE3
@@ -303,6 +306,9 @@
 #ifdef __AVX512BF16__
 #define EIGEN_VECTORIZE_AVX512BF16
 #endif
+#ifdef __AVX512VNNI__
+#define EIGEN_VECTORIZE_AVX512VNNI
+#endif
 #ifdef __AVX512VL__
 #define EIGEN_VECTORIZE_AVX512VL
 #endif
@@ -348,6 +354,12 @@
 #ifdef EIGEN_VECTORIZE_AVX512ER
 #undef EIGEN_VECTORIZE_AVX512ER
 #endif
+#ifdef EIGEN_VECTORIZE_AVX512VNNI
+#undef EIGEN_VECTORIZE_AVX512VNNI
+#endif
+#ifdef EIGEN_VECTORIZE_AVXVNNI
+#undef EIGEN_VECTORIZE_AVXVNNI
+#endif
 #endif
 // NOTE: Confirmed test failures in XCode 11.0, and XCode 11.2 with  -macosx-version-min=10.15 and AVX
 // NOTE using -macosx-version-min=10.15 with Xcode 11.0 results in runtime segmentation faults in many tests, 11.2
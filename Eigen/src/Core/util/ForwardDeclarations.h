@@ -110,6 +110,8 @@ class Inverse;
 
 template <typename Lhs, typename Rhs, int Option = DefaultProduct>
 class Product;
+template <typename Lhs, typename Rhs, typename Epilogue>
+class EpilogueProduct;
 
 template <typename Derived>
 class DiagonalBase;
@@ -223,6 +225,14 @@ template <typename T, int ProductTag = internal::product_type<typename T::Lhs, t
           typename LhsScalar = typename traits<typename T::Lhs>::Scalar,
           typename RhsScalar = typename traits<typename T::Rhs>::Scalar>
 struct product_evaluator;
+
+// Helper class to perform a matrix product with the destination at hand.
+// Depending on the sizes of the factors, there are different evaluation strategies
+// as controlled by internal::product_type.
+template <typename Lhs, typename Rhs, typename LhsShape = typename evaluator_traits<Lhs>::Shape,
+          typename RhsShape = typename evaluator_traits<Rhs>::Shape,
+          int ProductType = internal::product_type<Lhs, Rhs>::value>
+struct generic_product_impl;
 }  // namespace internal
 
 namespace internal {
@@ -425,8 +435,12 @@ template <typename MatrixType, typename PermutationIndex = DefaultPermutationInd
 class FullPivLU;
 template <typename MatrixType, typename PermutationIndex = DefaultPermutationIndex>
 class PartialPivLU;
+template <typename MatrixType, typename PermutationIndex = DefaultPermutationIndex>
+class UpdatableLU;
 template <typename MatrixType>
 class HouseholderQR;
+template <typename MatrixType>
+class UpdatableQR;
 template <typename MatrixType, typename PermutationIndex = DefaultPermutationIndex>
 class ColPivHouseholderQR;
 template <typename MatrixType, typename PermutationIndex = DefaultPermutationIndex>
@@ -447,12 +461,16 @@ template <typename MatrixType, int Options = 0>
 class JacobiSVD;
 template <typename MatrixType, int Options = 0>
 class BDCSVD;
+template <typename MatrixType, int Options = 0>
+class RandomizedSVD;
 template <typename MatrixType, int UpLo = Lower>
 class LLT;
 template <typename MatrixType, int UpLo = Lower>
 class LDLT;
 template <typename MatrixType, int UpLo = Lower>
 class BunchKaufman;
+template <typename Decomposition>
+class IterativeRefinement;
 template <typename VectorsType, typename CoeffsType, int Side = OnTheLeft>
 class HouseholderSequence;
 template <typename Scalar>
@@ -516,6 +534,7 @@ struct stem_function {
 
 template <typename XprType, typename Device>
 struct DeviceWrapper;
+struct CoreThreadPoolDevice;
 
 namespace internal {
 template <typename Xpr>
@@ -106,6 +106,14 @@ class LruCache {
     index_.clear();
   }
 
+  // Calls f(key, value) on every entry, from the least to the most recently
+  // used one, without changing their order. Re-inserting the entries in the
+  // visiting order into an empty cache therefore reproduces this cache.
+  template <typename Visitor>
+  void forEach(Visitor&& f) const {
+    for (auto it = items_.rbegin(); it != items_.rend(); ++it) f(it->first, it->second);
+  }
+
   std::size_t size() const { return items_.size(); }
   std::size_t capacity() const { return capacity_; }
   bool empty() const { return items_.empty(); }
@@ -210,6 +210,23 @@ class SelfAdjointEigenSolver {
     compute(matrix.derived(), options);
   }
 
+  /** \brief Constructor; computes eigendecomposition of given matrix on the threads of \a device.
+   *
+   * \sa compute(const EigenBase&, CoreThreadPoolDevice&, int)
+   */
+  template <typename InputType>
+  SelfAdjointEigenSolver(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device,
+                         int options = ComputeEigenvectors)
+      : m_eivec(matrix.rows(), matrix.cols()),
+        m_workspace(matrix.cols()),
+        m_eivalues(matrix.cols()),
+        m_subdiag(matrix.rows() > 1 ? matrix.rows() - 1 : 1),
+        m_hcoeffs(matrix.cols() > 1 ? matrix.cols() - 1 : 1),
+        m_isInitialized(false),
+        m_eigenvectorsOk(false) {
+    compute(matrix.derived(), device, options);
+  }
+
   /** \brief Computes eigendecomposition of given matrix.
    *
    * \param[in]  matrix  Selfadjoint matrix whose eigendecomposition is to
@@ -242,7 +259,34 @@ class SelfAdjointEigenSolver {
    */
   template <typename InputType>
   EIGEN_DEVICE_FUNC SelfAdjointEigenSolver& compute(const EigenBase<InputType>& matrix,
-                                                    int options = ComputeEigenvectors);
+                                                    int options = ComputeEigenvectors) {
+    return computeImpl(matrix, options);
+  }
+
+  /** \brief Computes eigendecomposition of given matrix on the threads of \a device.
+   *
+   * This is a variant of compute(const MatrixType&, int) which reduces large matrices to tridiagonal form in two
+   * stages: a blocked Householder reduction to a band matrix, whose matrix products run on the threads of \a device,
+   * followed by a reduction of the band matrix to tridiagonal form by bulge chasing. This avoids the memory-bound
+   * matrix-vector products of the one-stage reduction, which dominate compute() for large matrices. Both
+   * #EigenvaluesOnly and #ComputeEigenvectors are supported. The two-stage reduction performs more flops when the
+   * eigenvectors are requested, since the transformations of both stages are applied to them, so it pays off
+   * mostly when computing the eigenvalues only or with enough threads. Small matrices are reduced in one stage.
+   * This requires the ThreadPool module:
+   * \code
+   * #include <Eigen/ThreadPool>
+   * Eigen::ThreadPool pool(8);
+   * Eigen::CoreThreadPoolDevice device(pool);
+   * Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> es(A, device, Eigen::EigenvaluesOnly);
+   * \endcode
+   *
+   * \sa compute(const MatrixType&, int)
+   */
+  template <typename InputType>
+  SelfAdjointEigenSolver& compute(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device,
+                                  int options = ComputeEigenvectors) {
+    return computeImpl(matrix, options, device);
+  }
 
   /** \brief Computes eigendecomposition of given matrix using a closed-form algorithm
    *
@@ -410,6 +454,11 @@ class SelfAdjointEigenSolver {
  protected:
   EIGEN_STATIC_ASSERT_NON_INTEGER(Scalar)
 
+  // Computes the eigendecomposition, with a two-stage tridiagonalization on a CoreThreadPoolDevice if one is given.
+  template <typename InputType, typename... Device>
+  EIGEN_DEVICE_FUNC SelfAdjointEigenSolver& computeImpl(const EigenBase<InputType>& matrix, int options,
+                                                        Device&... device);
+
   EigenvectorsType m_eivec;
   VectorType m_workspace;
   RealVectorType m_eivalues;
@@ -447,9 +496,9 @@ EIGEN_DEVICE_FUNC static void tridiagonal_qr_step(RealScalar* diag, RealScalar*
 }  // namespace internal
 
 template <typename MatrixType>
-template <typename InputType>
-EIGEN_DEVICE_FUNC SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>::compute(
-    const EigenBase<InputType>& a_matrix, int options) {
+template <typename InputType, typename... Device>
+EIGEN_DEVICE_FUNC SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<MatrixType>::computeImpl(
+    const EigenBase<InputType>& a_matrix, int options, Device&... device) {
   const InputType& matrix(a_matrix.derived());
 
   EIGEN_USING_STD(abs);
@@ -492,7 +541,7 @@ EIGEN_DEVICE_FUNC SelfAdjointEigenSolver<MatrixType>& SelfAdjointEigenSolver<Mat
   mat.template triangularView<Lower>() /= scale;
   m_subdiag.resize(n - 1);
   m_hcoeffs.resize(n - 1);
-  internal::tridiagonalization_inplace(mat, diag, m_subdiag, m_hcoeffs, m_workspace, computeEigenvectors);
+  internal::tridiagonalization_inplace(mat, diag, m_subdiag, m_hcoeffs, m_workspace, computeEigenvectors, device...);
 
   m_info = internal::computeFromTridiagonal_impl<false>(diag, m_subdiag, m_maxIterations, computeEigenvectors, m_eivec);
 
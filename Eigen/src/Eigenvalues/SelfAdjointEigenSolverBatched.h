@@ -0,0 +1,260 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_SELFADJOINTEIGENSOLVER_BATCHED_H
+#define EIGEN_SELFADJOINTEIGENSOLVER_BATCHED_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+/* Closed-form eigen decomposition of the lanes [b, b + PacketSize) of a SoA batch of 3x3
+ * selfadjoint matrices. This follows direct_selfadjoint_eigenvalues<SolverType, 3, false>
+ * step by step, with its branches turned into selects so that each lane takes its own path. */
+template <typename Scalar, bool ComputeEigenvectors>
+struct batched_selfadjoint_eigen3_kernel {
+  const Scalar* matrices;
+  Index matrixStride;
+  Scalar* values;
+  Index valueStride;
+  Scalar* vectors;
+  Index vectorStride;
+
+  template <typename Packet>
+  static EIGEN_STRONG_INLINE void cross(const Packet* u, const Packet* v, Packet* w) {
+    w[0] = psub(pmul(u[1], v[2]), pmul(u[2], v[1]));
+    w[1] = psub(pmul(u[2], v[0]), pmul(u[0], v[2]));
+    w[2] = psub(pmul(u[0], v[1]), pmul(u[1], v[0]));
+  }
+
+  template <typename Packet>
+  static EIGEN_STRONG_INLINE Packet squared_norm(const Packet* u) {
+    return pmadd(u[2], u[2], pmadd(u[1], u[1], pmul(u[0], u[0])));
+  }
+
+  template <typename Packet>
+  static EIGEN_STRONG_INLINE void scale(Packet* u, const Packet& s) {
+    for (int i = 0; i < 3; ++i) u[i] = pmul(u[i], s);
+  }
+
+  // Unit vector of the kernel of the rank 2 symmetric matrix t, and in representative a column of t that is nearly
+  // orthogonal to it (see extract_kernel()).
+  template <typename Packet>
+  static EIGEN_STRONG_INLINE void extract_kernel(const Packet* t, Packet* res, Packet* representative) {
+    const Packet d0 = pabs(t[0]), d1 = pabs(t[4]), d2 = pabs(t[8]);
+    const Packet is1 = pcmp_lt(d0, d1);
+    const Packet is2 = pcmp_lt(pmax(d0, d1), d2);
+    Packet cA[3], cB[3];
+    for (int i = 0; i < 3; ++i) {
+      // Columns i0, i0 + 1 and i0 + 2 (mod 3) of t, with i0 the largest diagonal coefficient.
+      representative[i] = pselect(is2, t[i + 6], pselect(is1, t[i + 3], t[i]));
+      cA[i] = pselect(is2, t[i], pselect(is1, t[i + 6], t[i + 3]));
+      cB[i] = pselect(is2, t[i + 3], pselect(is1, t[i], t[i + 6]));
+    }
+    Packet c0[3], c1[3];
+    cross(representative, cA, c0);
+    cross(representative, cB, c1);
+    const Packet n0 = squared_norm(c0), n1 = squared_norm(c1);
+    const Packet first = pcmp_lt(n1, n0);
+    const Packet invNorm = pdiv(pset1<Packet>(Scalar(1)), psqrt(pselect(first, n0, n1)));
+    for (int i = 0; i < 3; ++i) res[i] = pmul(pselect(first, c0[i], c1[i]), invNorm);
+  }
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void run(Index b) {
+    using Lanes = soa_lanes<Packet>;
+    const Packet zero = pset1<Packet>(Scalar(0));
+    const Packet one = pset1<Packet>(Scalar(1));
+    const Packet third = pset1<Packet>(Scalar(1) / Scalar(3));
+    const Packet eps = pset1<Packet>(NumTraits<Scalar>::epsilon());
+
+    // Full symmetric copy of the lower triangular part.
+    Packet m[9];
+    for (int j = 0; j < 3; ++j) {
+      for (int i = j; i < 3; ++i) {
+        m[i + 3 * j] = Lanes::load(matrices, matrixStride, i + 3 * j, b);
+        m[j + 3 * i] = m[i + 3 * j];
+      }
+    }
+
+    // Shift to the mean eigenvalue and scale to [-1:1] to avoid over- and underflow.
+    const Packet shift = pmul(padd(padd(m[0], m[4]), m[8]), third);
+    for (int i = 0; i < 3; ++i) m[4 * i] = psub(m[4 * i], shift);
+    Packet maxCoeff = zero;
+    for (int i = 0; i < 9; ++i) maxCoeff = pmax(maxCoeff, pabs(m[i]));
+    const Packet scaling = pselect(pcmp_lt(zero, maxCoeff), maxCoeff, one);
+    const Packet invScaling = pdiv(one, scaling);
+    for (int i = 0; i < 9; ++i) m[i] = pmul(m[i], invScaling);
+
+    // Roots of the characteristic polynomial x^3 - c2*x^2 + c1*x - c0, as in computeRoots().
+    const Packet two = pset1<Packet>(Scalar(2));
+    Packet c0 = pmul(pmul(m[0], m[4]), m[8]);
+    c0 = padd(c0, pmul(two, pmul(pmul(m[1], m[2]), m[5])));
+    c0 = pnmadd(m[0], pmul(m[5], m[5]), c0);
+    c0 = pnmadd(m[4], pmul(m[2], m[2]), c0);
+    c0 = pnmadd(m[8], pmul(m[1], m[1]), c0);
+    Packet c1 = psub(pmul(m[0], m[4]), pmul(m[1], m[1]));
+    c1 = padd(c1, psub(pmul(m[0], m[8]), pmul(m[2], m[2])));
+    c1 = padd(c1, psub(pmul(m[4], m[8]), pmul(m[5], m[5])));
+    const Packet c2 = padd(padd(m[0], m[4]), m[8]);
+
+    const Packet c2_over_3 = pmul(c2, third);
+    const Packet a_over_3 = pmax(pmul(psub(pmul(c2, c2_over_3), c1), third), zero);
+    const Packet half_b = pmul(pset1<Packet>(Scalar(0.5)),
+                               padd(c0, pmul(c2_over_3, psub(pmul(pmul(two, c2_over_3), c2_over_3), c1))));
+    const Packet q = pmax(psub(pmul(pmul(a_over_3, a_over_3), a_over_3), pmul(half_b, half_b)), zero);
+    const Packet rho = psqrt(a_over_3);
+    const Packet theta = pmul(patan2(psqrt(q), half_b), third);
+    const Packet cos_theta = pcos(theta);
+    const Packet sqrt3_sin_theta = pmul(pset1<Packet>(numext::sqrt(Scalar(3))), psin(theta));
+    Packet e0 = psub(c2_over_3, pmul(rho, padd(cos_theta, sqrt3_sin_theta)));
+    Packet e1 = psub(c2_over_3, pmul(rho, psub(cos_theta, sqrt3_sin_theta)));
+    Packet e2 = padd(c2_over_3, pmul(pmul(two, rho), cos_theta));
+
+    // Rounding can break the theoretical ordering of the roots.
+    Packet t = pmin(e0, e1);
+    e1 = pmax(e0, e1);
+    e0 = t;
+    t = pmin(e1, e2);
+    e2 = pmax(e1, e2);
+    e1 = t;
+    t = pmin(e0, e1);
+    e1 = pmax(e0, e1);
+    e0 = t;
+
+    if (ComputeEigenvectors) {
+      // Eigenvector of the most distinct eigenvalue k first, then of the eigenvalue l at the other end.
+      const Packet d0 = psub(e2, e1), d1 = psub(e1, e0);
+      const Packet swapped = pcmp_lt(d1, d0);
+      const Packet lambdaK = pselect(swapped, e2, e0);
+      const Packet lambdaL = pselect(swapped, e0, e2);
+      const Packet gap = pselect(swapped, d1, d0);
+
+      Packet tmp[9], vk[3], vl[3], representative[3], kernel[3];
+      for (int i = 0; i < 9; ++i) tmp[i] = m[i];
+      for (int i = 0; i < 3; ++i) tmp[4 * i] = psub(m[4 * i], lambdaK);
+      extract_kernel(tmp, vk, representative);
+
+      // Two nearly equal eigenvalues: the saved column, otherwise the kernel of the matrix shifted by the eigenvalue
+      // l. Unlike computeDirect(), both are orthonormalized against vk, since the kernel is poorly determined when
+      // the two eigenvalues are merely close.
+      const Packet close = pcmp_le(gap, pmul(pmul(two, eps), d1));
+      for (int i = 0; i < 3; ++i) vl[i] = representative[i];
+      for (int i = 0; i < 3; ++i) tmp[4 * i] = psub(m[4 * i], lambdaL);
+      extract_kernel(tmp, kernel, representative);
+      for (int i = 0; i < 3; ++i) vl[i] = pselect(close, vl[i], kernel[i]);
+      const Packet dot = pmadd(vk[2], vl[2], pmadd(vk[1], vl[1], pmul(vk[0], vl[0])));
+      for (int i = 0; i < 3; ++i) vl[i] = pnmadd(dot, vk[i], vl[i]);
+      scale(vl, pdiv(one, psqrt(squared_norm(vl))));
+
+      Packet v[9];
+      for (int i = 0; i < 3; ++i) {
+        v[i] = pselect(swapped, vl[i], vk[i]);
+        v[i + 6] = pselect(swapped, vk[i], vl[i]);
+      }
+      cross(v + 6, v, v + 3);
+      scale(v + 3, pdiv(one, psqrt(squared_norm(v + 3))));
+
+      // All three eigenvalues numerically the same: any basis will do.
+      const Packet same = pcmp_le(psub(e2, e0), eps);
+      for (int j = 0; j < 3; ++j)
+        for (int i = 0; i < 3; ++i)
+          Lanes::store(vectors, vectorStride, i + 3 * j, b, pselect(same, i == j ? one : zero, v[i + 3 * j]));
+    }
+
+    // Undo the scaling and the shift.
+    Lanes::store(values, valueStride, 0, b, pmadd(e0, scaling, shift));
+    Lanes::store(values, valueStride, 1, b, pmadd(e1, scaling, shift));
+    Lanes::store(values, valueStride, 2, b, pmadd(e2, scaling, shift));
+  }
+};
+
+template <typename Scalar>
+struct batched_selfadjoint_eigen3_vectorizable {
+  enum {
+    value = packet_traits<Scalar>::HasSqrt && packet_traits<Scalar>::HasDiv && packet_traits<Scalar>::HasSin &&
+            packet_traits<Scalar>::HasCos && packet_traits<Scalar>::HasATan
+  };
+};
+
+}  // end namespace internal
+
+/** \ingroup Eigenvalues_Module
+ *
+ * Computes the eigenvalues of a batch of 3x3 real selfadjoint matrices with the closed-form
+ * algorithm of SelfAdjointEigenSolver::computeDirect().
+ *
+ * The batch is stored as a structure of arrays: \a matrices is a column-major batchSize x 9
+ * matrix whose column <tt>i + 3 * j</tt> holds the coefficient (i, j) of every matrix of the
+ * batch; only the lower triangular part is read. Row \a b of the batchSize x 3 matrix
+ * \a eigenvalues receives the eigenvalues of matrix \a b in increasing order.
+ *
+ * Compared to a loop of SelfAdjointEigenSolver<Matrix3d>::computeDirect(), each SIMD lane
+ * processes a different matrix of the batch. When the packet math of \a Scalar lacks one of the
+ * required functions (sin, cos and atan need EIGEN_FAST_MATH), the batch is processed one
+ * matrix at a time.
+ *
+ * \sa SelfAdjointEigenSolver::computeDirect()
+ */
+template <typename MatrixDerived, typename ValuesDerived>
+void batchedSelfAdjointEigen3x3(const MatrixBase<MatrixDerived>& matrices,
+                                const MatrixBase<ValuesDerived>& eigenvalues) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename MatrixDerived::Scalar, typename ValuesDerived::Scalar>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  internal::check_soa_batch(matrices, 9);
+  internal::check_soa_batch(eigenvalues, 3);
+  eigen_assert(matrices.rows() == eigenvalues.rows() && "the batches of matrices and eigenvalues differ in size");
+  using Scalar = typename MatrixDerived::Scalar;
+  ValuesDerived& values = eigenvalues.const_cast_derived();
+  internal::batched_selfadjoint_eigen3_kernel<Scalar, false> kernel{
+      matrices.derived().data(), matrices.derived().outerStride(), values.data(), values.outerStride(), nullptr, 0};
+  internal::soa_batch_for_each<Scalar, internal::batched_selfadjoint_eigen3_vectorizable<Scalar>::value>(
+      values.rows(), kernel);
+}
+
+/** \ingroup Eigenvalues_Module
+ *
+ * Computes the eigenvalues and the eigenvectors of a batch of 3x3 real selfadjoint matrices.
+ *
+ * Row \a b of the batchSize x 9 matrix \a eigenvectors receives the eigenvectors of matrix \a b,
+ * with the same structure of arrays layout as \a matrices: column <tt>i + 3 * j</tt> holds the
+ * component \a i of the eigenvector \a j, associated with the eigenvalue <tt>eigenvalues(b, j)</tt>.
+ *
+ * \sa batchedSelfAdjointEigen3x3(const MatrixBase<MatrixDerived>&, const MatrixBase<ValuesDerived>&)
+ */
+template <typename MatrixDerived, typename ValuesDerived, typename VectorsDerived>
+void batchedSelfAdjointEigen3x3(const MatrixBase<MatrixDerived>& matrices, const MatrixBase<ValuesDerived>& eigenvalues,
+                                const MatrixBase<VectorsDerived>& eigenvectors) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename MatrixDerived::Scalar, typename ValuesDerived::Scalar>::value &&
+                       std::is_same<typename MatrixDerived::Scalar, typename VectorsDerived::Scalar>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  internal::check_soa_batch(matrices, 9);
+  internal::check_soa_batch(eigenvalues, 3);
+  internal::check_soa_batch(eigenvectors, 9);
+  eigen_assert(matrices.rows() == eigenvalues.rows() && matrices.rows() == eigenvectors.rows() &&
+               "the batches of matrices, eigenvalues and eigenvectors differ in size");
+  using Scalar = typename MatrixDerived::Scalar;
+  ValuesDerived& values = eigenvalues.const_cast_derived();
+  VectorsDerived& vectors = eigenvectors.const_cast_derived();
+  internal::batched_selfadjoint_eigen3_kernel<Scalar, true> kernel{matrices.derived().data(),
+                                                                   matrices.derived().outerStride(),
+                                                                   values.data(),
+                                                                   values.outerStride(),
+                                                                   vectors.data(),
+                                                                   vectors.outerStride()};
+  internal::soa_batch_for_each<Scalar, internal::batched_selfadjoint_eigen3_vectorizable<Scalar>::value>(
+      values.rows(), kernel);
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_SELFADJOINTEIGENSOLVER_BATCHED_H
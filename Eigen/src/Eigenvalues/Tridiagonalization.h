@@ -650,6 +650,308 @@ struct tridiagonalization_inplace_selector<MatrixType, 1, IsComplex> {
   }
 };
 
+#if !defined(EIGEN_GPU_COMPILE_PHASE)
+/** \internal
+ * First stage of the two-stage tridiagonalization: reduces the selfadjoint matrix \a matA (lower triangular part) to
+ * a band matrix with \a bandwidth subdiagonals, on the threads of \a device.
+ *
+ * Each panel of \a bandwidth columns is reduced by a Householder QR of its rows below the band, and the trailing
+ * matrix is updated from both sides with the compact WY form Q = I - V T V^* of the panel reflectors:
+ *   W = A V T,  Y = W - 1/2 V (T^* V^* W),  A -= V Y^* + Y V^*.
+ * The product A V and the rank-2k update are split across the threads of \a device, which gives a BLAS-3 reduction
+ * whose every flop is multithreaded, unlike the symmetric rank-2 updates of tridiagonalization_inplace_blocked.
+ *
+ * On output, the band is stored in the lower part of \a matA, and the Householder vectors below it: the vector of
+ * column j starts at row j + bandwidth with an implicit 1, its coefficient is \a hCoeffs(j). The upper triangular
+ * part of \a matA is used as workspace.
+ */
+template <typename MatrixType, typename CoeffVectorType, typename Device>
+void tridiagonalization_band_inplace(MatrixType& matA, CoeffVectorType& hCoeffs, Index bandwidth, Device& device) {
+  using Scalar = typename MatrixType::Scalar;
+  using RealScalar = typename MatrixType::RealScalar;
+  using WorkMatrixType = Matrix<Scalar, Dynamic, Dynamic>;
+  const Index n = matA.rows();
+  eigen_assert(n == matA.cols());
+  eigen_assert(n == hCoeffs.size() + 1);
+  eigen_assert(bandwidth >= 1);
+
+  hCoeffs.setZero();
+  WorkMatrixType V, W, Y, VY, YV;
+  Matrix<Scalar, Dynamic, Dynamic, RowMajor> T, M;
+  Matrix<Scalar, Dynamic, 1> temp(bandwidth);
+  const Index granularity = gebp_traits<Scalar, Scalar>::mr;
+  for (Index j0 = 0; n - j0 - bandwidth > 1; j0 += bandwidth) {
+    const Index m = n - j0 - bandwidth;
+    const Index k = numext::mini(bandwidth, m);
+    auto panel = matA.block(j0 + bandwidth, j0, m, bandwidth);
+    for (Index c = 0; c < k; ++c) {
+      RealScalar beta;
+      panel.col(c).tail(m - c).makeHouseholderInPlace(hCoeffs.coeffRef(j0 + c), beta);
+      panel.bottomRightCorner(m - c, bandwidth - c - 1)
+          .applyHouseholderOnTheLeft(panel.col(c).tail(m - c - 1), hCoeffs.coeff(j0 + c), temp.data());
+      panel.coeffRef(c, c) = beta;
+    }
+
+    // The reflectors are applied as A = Q^* A Q with Q = H_0^* ... H_{k-1}^* = I - V T V^*.
+    V = panel.leftCols(k).template triangularView<UnitLower>();
+    T.resize(k, k);
+    make_block_householder_triangular_factor(T, V, hCoeffs.segment(j0, k).conjugate());
+
+    auto A22 = matA.bottomRightCorner(m, m);
+    W.resize(m, k);
+    auto symm = [&](Index begin, Index end) {
+      const Index rows = end - begin;
+      const Index below = m - end;
+      auto dst = W.middleRows(begin, rows);
+      dst.noalias() = A22.block(begin, begin, rows, rows).template selfadjointView<Lower>() * V.middleRows(begin, rows);
+      if (begin > 0) dst.noalias() += A22.block(begin, 0, rows, begin) * V.topRows(begin);
+      if (below > 0) dst.noalias() += A22.block(end, begin, below, rows).adjoint() * V.bottomRows(below);
+    };
+    const float cost = 2.0f * static_cast<float>(m) * static_cast<float>(m) * static_cast<float>(k);
+    device.parallelForBlocks(m, granularity, cost, symm);
+
+    W = (W * T.template triangularView<Upper>()).eval();
+    M.noalias() = RealScalar(0.5) * V.adjoint() * W;
+    M = (T.template triangularView<Upper>().adjoint() * M).eval();
+    Y = W;
+    Y.noalias() -= V * M;
+
+    VY.resize(m, 2 * k);
+    VY << V, Y;
+    YV.resize(m, 2 * k);
+    YV << Y, V;
+    // The rank-2k update is split into column blocks with equal shares of the lower triangle, at least 64 columns
+    // wide (the first one is the narrowest).
+    const Index numParts = numext::maxi<Index>(1, numext::mini<Index>(64, m / 128));
+    auto bound = [&](Index part) {
+      const double remaining = std::sqrt(1.0 - static_cast<double>(part) / static_cast<double>(numParts));
+      return part == numParts ? m : m - static_cast<Index>(static_cast<double>(m) * remaining);
+    };
+    auto rank2k = [&](Index begin, Index end) {
+      for (Index part = begin; part < end; ++part) {
+        const Index c0 = bound(part);
+        const Index c1 = bound(part + 1);
+        if (c1 > c0)
+          A22.block(c0, c0, m - c0, c1 - c0).noalias() -= VY.bottomRows(m - c0) * YV.middleRows(c0, c1 - c0).adjoint();
+      }
+    };
+    device.parallelForBlocks(numParts, 1, cost, rank2k);
+  }
+}
+
+/** \internal
+ * Forms the unitary matrix \a Q of the first stage of the two-stage tridiagonalization from the Householder vectors
+ * and coefficients left in \a matA and \a hCoeffs by tridiagonalization_band_inplace(). The block reflectors are
+ * accumulated backward, so that each of them only updates the trailing part of \a Q, with matrix products on the
+ * threads of \a device.
+ */
+template <typename MatrixType, typename CoeffVectorType, typename QType, typename Device>
+void tridiagonalization_band_householder_q(const MatrixType& matA, const CoeffVectorType& hCoeffs, Index bandwidth,
+                                           QType& Q, Device& device) {
+  using Scalar = typename MatrixType::Scalar;
+  const Index n = matA.rows();
+  Q.setIdentity(n, n);
+  if (n - bandwidth <= 1) return;
+  Matrix<Scalar, Dynamic, Dynamic> V, tmp;
+  Matrix<Scalar, Dynamic, Dynamic, RowMajor> T;
+  const Index lastPanel = ((n - bandwidth - 2) / bandwidth) * bandwidth;
+  for (Index j0 = lastPanel; j0 >= 0; j0 -= bandwidth) {
+    const Index m = n - j0 - bandwidth;
+    const Index k = numext::mini(bandwidth, m);
+    V = matA.block(j0 + bandwidth, j0, m, k).template triangularView<UnitLower>();
+    T.resize(k, k);
+    make_block_householder_triangular_factor(T, V, hCoeffs.segment(j0, k).conjugate());
+    auto trailing = Q.bottomRightCorner(m, m);
+    tmp.resize(k, m);
+    tmp.device(device).noalias() = V.adjoint() * trailing;
+    tmp = (T.template triangularView<Upper>() * tmp).eval();
+    trailing.device(device).noalias() -= V * tmp;
+  }
+}
+
+/** \internal
+ * Second stage of the two-stage tridiagonalization: reduces a selfadjoint band matrix to a real tridiagonal matrix by
+ * bulge chasing.
+ *
+ * The sweep of column j annihilates its entries below the subdiagonal with a Householder reflector acting on the next
+ * bandwidth rows. Its two-sided application creates a bulge below the band, whose first column is annihilated by the
+ * next reflector, bandwidth rows further, and so on until the bulge leaves the matrix. The rest of each bulge is
+ * annihilated by the following sweeps, so the band never grows beyond 2*bandwidth-1 subdiagonals.
+ *
+ * Both triangles of the band are stored, column by column, in m_band(m_width + i - j, j). In this layout, a block of
+ * the band matrix is a regular block with an outer stride reduced by one, so each reflector is applied with a
+ * matrix-vector product and a rank-1 update. The reflectors can be kept to apply them to the eigenvectors.
+ */
+template <typename Scalar_>
+class band_tridiagonalization {
+ public:
+  using Scalar = Scalar_;
+  using RealScalar = typename NumTraits<Scalar>::Real;
+
+  template <typename MatrixType>
+  band_tridiagonalization(const MatrixType& matA, Index bandwidth, bool storeReflectors)
+      : m_size(matA.rows()),
+        m_bandwidth(bandwidth),
+        m_width(2 * bandwidth),
+        m_band(2 * m_width + 1, m_size),
+        m_storeReflectors(storeReflectors) {
+    m_band.setZero();
+    for (Index j = 0; j < m_size; ++j) {
+      const Index len = numext::mini(m_bandwidth + 1, m_size - j);
+      column(j, j, len) = matA.col(j).segment(j, len);
+      block(j, j + 1, 1, len - 1) = matA.col(j).segment(j + 1, len - 1).adjoint();
+    }
+  }
+
+  void reduce() {
+    const Index n = m_size;
+    const Index b = m_bandwidth;
+    if (m_storeReflectors) {
+      Index numReflectors = 0;
+      for (Index j = 0; j < n - 1; ++j) numReflectors += numext::div_ceil(n - 1 - j, b);
+      m_vectors.resize(b, numReflectors);
+      m_coeffs.resize(numReflectors);
+      m_rows.resize(numReflectors);
+    }
+    Matrix<Scalar, Dynamic, 1> v(b);
+    Matrix<Scalar, 1, Dynamic> s(3 * b);
+    Matrix<Scalar, Dynamic, 1> u(3 * b);
+    Index reflector = 0;
+    for (Index j = 0; j < n - 1; ++j) {
+      for (Index c = j, p = j + 1; p < n; c = p, p += b, ++reflector) {
+        // Annihilates A(p+1:p+len, c) with a reflector H acting on the rows I = [p, p+len), and applies A = H A H^*
+        // to the columns (c, end) of the rows I and to the rows (c, end) of the columns I, which hold all their
+        // other nonzeros.
+        const Index len = numext::mini(b, n - p);
+        const Index end = numext::mini(n, p + len + b);
+        auto x = column(c, p, len);
+        auto essential = v.segment(1, len - 1);
+        Scalar tau;
+        RealScalar beta;
+        x.makeHouseholder(essential, tau, beta);
+        v(0) = Scalar(1);
+        x.setZero();
+        x(0) = beta;
+        block(c, p, 1, len).setZero();
+        block(c, p, 1, 1).setConstant(beta);
+        if (m_storeReflectors) {
+          m_vectors.col(reflector).head(len) = v.head(len);
+          m_coeffs(reflector) = tau;
+          m_rows(reflector) = p;
+        }
+        if (numext::is_exactly_zero(tau)) continue;
+
+        auto rows = block(p, c + 1, len, end - c - 1);
+        s.head(end - c - 1).noalias() = v.head(len).adjoint() * rows;
+        rows.noalias() -= (tau * v.head(len)) * s.head(end - c - 1);
+        auto cols = block(c + 1, p, end - c - 1, len);
+        u.head(end - c - 1).noalias() = cols * v.head(len);
+        cols.noalias() -= (numext::conj(tau) * u.head(end - c - 1)) * v.head(len).adjoint();
+      }
+    }
+  }
+
+  template <typename DiagonalType, typename SubDiagonalType>
+  void extract(DiagonalType& diag, SubDiagonalType& subdiag) const {
+    diag = m_band.row(m_width).real().transpose();
+    subdiag = m_band.row(m_width + 1).head(m_size - 1).real().transpose();
+  }
+
+  // Applies the reflectors of reduce() on the right of Q: Q = Q H_0^* H_1^* ... The rows of Q are independent and
+  // are split across the threads of the device, each thread applying all reflectors to blocks of its rows.
+  template <typename QType, typename Device>
+  void applyOnTheRight(QType& Q, Device& device) const {
+    eigen_assert(m_storeReflectors && Q.cols() == m_size);
+    const Index rowBlock = 64;
+    auto task = [&](Index begin, Index end) {
+      Matrix<Scalar, Dynamic, 1> tmp(rowBlock);
+      for (Index r0 = begin; r0 < end; r0 += rowBlock) {
+        const Index rows = numext::mini(rowBlock, end - r0);
+        for (Index i = 0; i < m_coeffs.size(); ++i) {
+          const Scalar tau = m_coeffs.coeff(i);
+          if (numext::is_exactly_zero(tau)) continue;
+          const Index len = numext::mini(m_bandwidth, m_size - m_rows.coeff(i));
+          auto vi = m_vectors.col(i).head(len);
+          auto blk = Q.block(r0, m_rows.coeff(i), rows, len);
+          tmp.head(rows).noalias() = blk * vi;
+          blk.noalias() -= (numext::conj(tau) * tmp.head(rows)) * vi.adjoint();
+        }
+      }
+    };
+    const float cost = 4.0f * static_cast<float>(Q.rows()) * static_cast<float>(m_coeffs.size()) *
+                       static_cast<float>(m_bandwidth);
+    device.parallelForBlocks(Q.rows(), rowBlock, cost, task);
+  }
+
+ private:
+  using BlockType = Map<Matrix<Scalar, Dynamic, Dynamic>, 0, OuterStride<>>;
+  using ColumnType = Map<Matrix<Scalar, Dynamic, 1>>;
+
+  // The block of the band matrix starting at (row, col).
+  BlockType block(Index row, Index col, Index rows, Index cols) {
+    eigen_assert(rows == 0 || cols == 0 || (row + rows - 1 - col <= m_width && col + cols - 1 - row <= m_width));
+    return BlockType(m_band.data() + (m_width + row - col) + col * m_band.outerStride(), rows, cols,
+                     OuterStride<>(m_band.outerStride() - 1));
+  }
+  // The segment of rows [row, row+rows) of a column of the band matrix.
+  ColumnType column(Index col, Index row, Index rows) {
+    eigen_assert(row >= col - m_width && row + rows - 1 - col <= m_width);
+    return ColumnType(m_band.data() + (m_width + row - col) + col * m_band.outerStride(), rows);
+  }
+
+  Index m_size;
+  Index m_bandwidth;
+  Index m_width;
+  Matrix<Scalar, Dynamic, Dynamic> m_band;
+  Matrix<Scalar, Dynamic, Dynamic> m_vectors;
+  Matrix<Scalar, Dynamic, 1> m_coeffs;
+  Matrix<Index, Dynamic, 1> m_rows;
+  bool m_storeReflectors;
+};
+
+/** \internal
+ * Two-stage tridiagonalization on the threads of \a device: the matrix is first reduced to a band matrix with
+ * blocked, multithreaded Householder transformations (tridiagonalization_band_inplace), and then to a tridiagonal
+ * matrix by bulge chasing (band_tridiagonalization). Compared to tridiagonalization_inplace, which spends half of its
+ * flops in memory-bound symmetric matrix-vector products, almost all flops of the first stage are in matrix products,
+ * while the second stage only costs O(n^2 bandwidth) flops. When \p extractQ is true, the unitary matrix of each stage
+ * is applied in parallel too, at the cost of about twice the flops of the one-stage path.
+ *
+ * Small and fixed-size matrices are reduced by tridiagonalization_inplace. Either way, no product runs on the threads
+ * of parallelize_gemm.
+ */
+template <typename MatrixType, typename DiagonalType, typename SubDiagonalType, typename CoeffVectorType,
+          typename WorkSpaceType, typename Device>
+void tridiagonalization_inplace(MatrixType& mat, DiagonalType& diag, SubDiagonalType& subdiag, CoeffVectorType& hcoeffs,
+                                WorkSpaceType& workspace, bool extractQ, Device& device) {
+  eigen_assert(mat.cols() == mat.rows() && diag.size() == mat.rows() && subdiag.size() == mat.rows() - 1);
+  const Index n = mat.rows();
+  const Index bandwidth = 32;
+  // The products evaluated on the calling thread, like those of the chunks split across the threads of the device, do
+  // not start the threads of parallelize_gemm.
+  internal::sequential_products_scope sequential;
+  EIGEN_IF_CONSTEXPR (MatrixType::RowsAtCompileTime != Dynamic && MatrixType::ColsAtCompileTime != Dynamic) {
+    tridiagonalization_inplace(mat, diag, subdiag, hcoeffs, workspace, extractQ);
+    return;
+  }
+  if (n < 16 * bandwidth) {
+    tridiagonalization_inplace(mat, diag, subdiag, hcoeffs, workspace, extractQ);
+    return;
+  }
+
+  tridiagonalization_band_inplace(mat, hcoeffs, bandwidth, device);
+  band_tridiagonalization<typename MatrixType::Scalar> band(mat, bandwidth, extractQ);
+  band.reduce();
+  band.extract(diag, subdiag);
+  if (extractQ) {
+    typename MatrixType::PlainObject Q;
+    tridiagonalization_band_householder_q(mat, hcoeffs, bandwidth, Q, device);
+    band.applyOnTheRight(Q, device);
+    mat = Q;
+  }
+}
+#endif  // !EIGEN_GPU_COMPILE_PHASE
+
 /** \internal
  * \eigenvalues_module \ingroup Eigenvalues_Module
  *
@@ -0,0 +1,91 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_QUATERNION_BATCHED_H
+#define EIGEN_QUATERNION_BATCHED_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+// Hamilton products of the lanes [b, b + PacketSize) of two SoA batches of quaternions.
+template <typename Scalar>
+struct batched_quaternion_product_kernel {
+  const Scalar* lhs;
+  Index lhsStride;
+  const Scalar* rhs;
+  Index rhsStride;
+  Scalar* dst;
+  Index dstStride;
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void run(Index b) {
+    using Lanes = soa_lanes<Packet>;
+    // Fields in the order of Quaternion::coeffs(): x, y, z, w.
+    const Packet ax = Lanes::load(lhs, lhsStride, 0, b), ay = Lanes::load(lhs, lhsStride, 1, b);
+    const Packet az = Lanes::load(lhs, lhsStride, 2, b), aw = Lanes::load(lhs, lhsStride, 3, b);
+    const Packet bx = Lanes::load(rhs, rhsStride, 0, b), by = Lanes::load(rhs, rhsStride, 1, b);
+    const Packet bz = Lanes::load(rhs, rhsStride, 2, b), bw = Lanes::load(rhs, rhsStride, 3, b);
+
+    const Packet x = pnmadd(az, by, pmadd(ay, bz, pmadd(ax, bw, pmul(aw, bx))));
+    const Packet y = pnmadd(ax, bz, pmadd(az, bx, pmadd(ay, bw, pmul(aw, by))));
+    const Packet z = pnmadd(ay, bx, pmadd(ax, by, pmadd(az, bw, pmul(aw, bz))));
+    const Packet w = pnmadd(az, bz, pnmadd(ay, by, pnmadd(ax, bx, pmul(aw, bw))));
+
+    Lanes::store(dst, dstStride, 0, b, x);
+    Lanes::store(dst, dstStride, 1, b, y);
+    Lanes::store(dst, dstStride, 2, b, z);
+    Lanes::store(dst, dstStride, 3, b, w);
+  }
+};
+
+}  // end namespace internal
+
+/** \geometry_module \ingroup Geometry_Module
+ *
+ * Computes the batch of quaternion products <tt>dst_b = lhs_b * rhs_b</tt>.
+ *
+ * The quaternions are stored as a structure of arrays: each of \a lhs, \a rhs and \a dst is a
+ * column-major batchSize x 4 matrix whose columns hold the x, y, z and w coefficients, in the
+ * order of Quaternion::coeffs(). Each SIMD lane composes a different pair of quaternions.
+ * \a dst may be the same matrix as \a lhs or \a rhs.
+ *
+ * Example:
+ * \code
+ * Matrix<double, Dynamic, 4> orientations(n, 4), increments(n, 4);
+ * // ... orientations.row(b) = q_b.coeffs().transpose() ...
+ * batchedQuaternionProduct(orientations, increments, orientations);
+ * \endcode
+ *
+ * \sa Quaternion::operator*()
+ */
+template <typename LhsDerived, typename RhsDerived, typename DstDerived>
+void batchedQuaternionProduct(const MatrixBase<LhsDerived>& lhs, const MatrixBase<RhsDerived>& rhs,
+                              const MatrixBase<DstDerived>& dst) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename LhsDerived::Scalar, typename RhsDerived::Scalar>::value &&
+                       std::is_same<typename LhsDerived::Scalar, typename DstDerived::Scalar>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  internal::check_soa_batch(lhs, 4);
+  internal::check_soa_batch(rhs, 4);
+  internal::check_soa_batch(dst, 4);
+  eigen_assert(lhs.rows() == rhs.rows() && lhs.rows() == dst.rows() && "the batches of quaternions differ in size");
+  using Scalar = typename DstDerived::Scalar;
+  DstDerived& d = dst.const_cast_derived();
+  internal::batched_quaternion_product_kernel<Scalar> kernel{lhs.derived().data(), lhs.derived().outerStride(),
+                                                             rhs.derived().data(), rhs.derived().outerStride(),
+                                                             d.data(),             d.outerStride()};
+  internal::soa_batch_for_each<Scalar, true>(d.rows(), kernel);
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_QUATERNION_BATCHED_H
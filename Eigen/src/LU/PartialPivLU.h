@@ -127,6 +127,13 @@ class PartialPivLU : public SolverBase<PartialPivLU<MatrixType_, PermutationInde
   template <typename InputType>
   explicit PartialPivLU(EigenBase<InputType>& matrix);
 
+  /** Constructor computing the LU decomposition of \a matrix on the threads of \a device.
+   *
+   * \sa compute(const EigenBase&, CoreThreadPoolDevice&)
+   */
+  template <typename InputType>
+  PartialPivLU(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device);
+
   template <typename InputType>
   PartialPivLU& compute(const EigenBase<InputType>& matrix) {
     m_lu = matrix.derived();
@@ -134,6 +141,26 @@ class PartialPivLU : public SolverBase<PartialPivLU<MatrixType_, PermutationInde
     return *this;
   }
 
+  /** Computes the LU decomposition of \a matrix on the threads of \a device.
+   *
+   * The panels are factored recursively and the row interchanges, triangular solves and updates of the trailing
+   * matrix are split by blocks of columns, which run as a graph of tasks on the pool of \a device. The next panel is
+   * factored as soon as its columns are up to date, while the rest of the trailing matrix is still being updated.
+   * Small matrices are factored sequentially. This requires the ThreadPool module:
+   * \code
+   * #include <Eigen/ThreadPool>
+   * Eigen::ThreadPool pool(8);
+   * Eigen::CoreThreadPoolDevice device(pool);
+   * Eigen::PartialPivLU<Eigen::MatrixXd> lu(A, device);
+   * \endcode
+   */
+  template <typename InputType>
+  PartialPivLU& compute(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device) {
+    m_lu = matrix.derived();
+    computeInPlace(device);
+    return *this;
+  }
+
   /** \returns the LU decomposition matrix: the upper-triangular part is U, the
    * unit-lower-triangular part is L (at least for square matrices; in the non-square
    * case, special care is needed, see the documentation of class FullPivLU).
@@ -257,7 +284,11 @@ class PartialPivLU : public SolverBase<PartialPivLU<MatrixType_, PermutationInde
  protected:
   EIGEN_STATIC_ASSERT_NON_INTEGER(Scalar)
 
-  void compute();
+  void compute() { computeInPlace(); }
+
+  // Factors m_lu in place, on the threads of a CoreThreadPoolDevice if one is given.
+  template <typename... Device>
+  void computeInPlace(Device&... device);
 
   MatrixType m_lu;
   PermutationType m_p;
@@ -287,6 +318,19 @@ PartialPivLU<MatrixType, PermutationIndex>::PartialPivLU(const EigenBase<InputTy
   compute(matrix.derived());
 }
 
+template <typename MatrixType, typename PermutationIndex>
+template <typename InputType>
+PartialPivLU<MatrixType, PermutationIndex>::PartialPivLU(const EigenBase<InputType>& matrix,
+                                                         CoreThreadPoolDevice& device)
+    : m_lu(matrix.rows(), matrix.cols()),
+      m_p(matrix.rows()),
+      m_rowsTranspositions(matrix.rows()),
+      m_l1_norm(0),
+      m_det_p(0),
+      m_isInitialized(false) {
+  compute(matrix.derived(), device);
+}
+
 template <typename MatrixType, typename PermutationIndex>
 template <typename InputType>
 PartialPivLU<MatrixType, PermutationIndex>::PartialPivLU(EigenBase<InputType>& matrix)
@@ -464,6 +508,134 @@ struct generic_partial_lu_impl {
 template <typename Scalar, int StorageOrder, typename PivIndex, int SizeAtCompileTime = Dynamic>
 struct partial_lu_impl : generic_partial_lu_impl<Scalar, StorageOrder, PivIndex, SizeAtCompileTime> {};
 
+/* Right-looking LU decomposition of a square matrix split into blocks of columns, as a graph of tasks for
+ * CoreThreadPoolDevice::runTaskGraph. Block column j goes through j update stages followed by a final stage:
+ *  - stage k < j: the row interchanges of panel k, the triangular solve by its unit lower diagonal block, and the
+ *    update of the rows below it,
+ *  - stage j: the factorization of its panel (its diagonal block and the rows below), with a recursive algorithm.
+ * The stages of one block column run in order, and stage k waits for the factorization of panel k. Since the next
+ * block column is listed first among the successors of a panel, it is factored as soon as it is up to date.
+ * The row interchanges of the later panels are applied to the L part of each block column by finish().
+ */
+template <typename Scalar, int StorageOrder, typename PivIndex>
+class partial_lu_task_graph {
+  using Impl = generic_partial_lu_impl<Scalar, StorageOrder, PivIndex>;
+  using MatrixType = typename Impl::MatrixType;
+  using MatrixTypeRef = typename Impl::MatrixTypeRef;
+  using MapType = Map<MatrixType, 0, OuterStride<>>;
+
+ public:
+  partial_lu_task_graph(Index size, Scalar* lu_data, Index luStride, PivIndex* row_transpositions, Index blockSize)
+      : m_lu(lu_data, size, size, OuterStride<>(luStride)),
+        m_transpositions(row_transpositions),
+        m_blockSize(blockSize),
+        m_numBlocks(numext::div_ceil(size, blockSize)),
+        m_nbTranspositions(m_numBlocks, 0) {}
+
+  Index size() const { return m_numBlocks * (m_numBlocks + 1) / 2; }
+
+  int dependencies(Index task) const {
+    Index j, k;
+    decode(task, j, k);
+    return int(k > 0) + int(k < j);
+  }
+
+  void run(Index task) {
+    Index j, k;
+    decode(task, j, k);
+    const Index size = m_lu.rows();
+    const Index r0 = k * m_blockSize;
+    const Index bs = numext::mini(m_blockSize, size - r0);
+    if (k == j) {
+      PivIndex* transpositions = m_transpositions + r0;
+      recursive_lu(size - r0, bs, &m_lu.coeffRef(r0, r0), m_lu.outerStride(), transpositions, m_nbTranspositions[k]);
+      for (Index i = 0; i < bs; ++i) transpositions[i] += internal::convert_index<PivIndex>(r0);
+      return;
+    }
+    const Index c0 = j * m_blockSize;
+    auto cols = m_lu.middleCols(c0, numext::mini(m_blockSize, size - c0));
+    for (Index i = r0; i < r0 + bs; ++i) cols.row(i).swap(cols.row(m_transpositions[i]));
+    m_lu.block(r0, r0, bs, bs).template triangularView<UnitLower>().solveInPlace(cols.middleRows(r0, bs));
+    const Index trows = size - r0 - bs;
+    if (trows > 0) cols.bottomRows(trows).noalias() -= m_lu.block(r0 + bs, r0, trows, bs) * cols.middleRows(r0, bs);
+  }
+
+  template <typename Func>
+  void forEachSuccessor(Index task, Func&& f) const {
+    Index j, k;
+    decode(task, j, k);
+    if (k < j) {
+      f(id(j, k + 1));
+    } else {
+      for (Index c = j + 1; c < m_numBlocks; ++c) f(id(c, j));
+    }
+  }
+
+  // Applies the row interchanges of each panel to the block columns on its left, and counts the transpositions.
+  template <typename Device>
+  void finish(Device& device, PivIndex& nb_transpositions) {
+    const Index size = m_lu.rows();
+    auto swapLeft = [&](Index begin, Index end) {
+      for (Index c0 = begin; c0 < end; c0 += m_blockSize) {
+        auto cols = m_lu.middleCols(c0, numext::mini(m_blockSize, end - c0));
+        for (Index i = c0 + m_blockSize; i < size; ++i) cols.row(i).swap(cols.row(m_transpositions[i]));
+      }
+    };
+    device.parallelForBlocks(size, m_blockSize, static_cast<float>(size) * static_cast<float>(size), swapLeft);
+
+    nb_transpositions = 0;
+    for (Index k = 0; k < m_numBlocks; ++k) nb_transpositions += m_nbTranspositions[k];
+  }
+
+ private:
+  // The stages of block column j are the tasks j(j+1)/2, ..., j(j+1)/2 + j.
+  static Index id(Index j, Index k) { return j * (j + 1) / 2 + k; }
+
+  static void decode(Index task, Index& j, Index& k) {
+    j = static_cast<Index>((std::sqrt(8.0 * static_cast<double>(task) + 1.0) - 1.0) / 2.0);
+    while (id(j, 0) > task) --j;
+    while (id(j + 1, 0) <= task) ++j;
+    k = task - id(j, 0);
+  }
+
+  // Recursive LU decomposition of a rows x cols panel, with rows >= cols (Toledo): the left half of the panel is
+  // factored, the right half is updated by a triangular solve and a product, and then factored in turn.
+  static Index recursive_lu(Index rows, Index cols, Scalar* lu_data, Index luStride, PivIndex* row_transpositions,
+                            PivIndex& nb_transpositions) {
+    MapType lu(lu_data, rows, cols, OuterStride<>(luStride));
+    if (cols <= Impl::UnBlockedBound) {
+      MatrixTypeRef luRef(lu);
+      return Impl::unblocked_lu(luRef, row_transpositions, nb_transpositions);
+    }
+    const Index n1 = cols / 2;
+    const Index n2 = cols - n1;
+    PivIndex nb1, nb2;
+    Index first_zero_pivot = recursive_lu(rows, n1, lu_data, luStride, row_transpositions, nb1);
+
+    auto right = lu.rightCols(n2);
+    for (Index i = 0; i < n1; ++i) right.row(i).swap(right.row(row_transpositions[i]));
+    lu.topLeftCorner(n1, n1).template triangularView<UnitLower>().solveInPlace(right.topRows(n1));
+    right.bottomRows(rows - n1).noalias() -= lu.bottomLeftCorner(rows - n1, n1) * right.topRows(n1);
+
+    const Index ret = recursive_lu(rows - n1, n2, &lu.coeffRef(n1, n1), luStride, row_transpositions + n1, nb2);
+    if (ret >= 0 && first_zero_pivot == -1) first_zero_pivot = n1 + ret;
+
+    auto left = lu.leftCols(n1);
+    for (Index i = n1; i < cols; ++i) {
+      const Index piv = (row_transpositions[i] += internal::convert_index<PivIndex>(n1));
+      left.row(i).swap(left.row(piv));
+    }
+    nb_transpositions = nb1 + nb2;
+    return first_zero_pivot;
+  }
+
+  MapType m_lu;
+  PivIndex* m_transpositions;
+  const Index m_blockSize;
+  const Index m_numBlocks;
+  std::vector<PivIndex> m_nbTranspositions;
+};
+
 /** \internal performs the LU decomposition with partial pivoting in-place.
  */
 template <typename MatrixType, typename TranspositionType>
@@ -485,6 +657,26 @@ void partial_lu_inplace(MatrixType& lu, TranspositionType& row_transpositions,
                  nb_transpositions);
 }
 
+/** \internal performs the LU decomposition with partial pivoting in-place on the threads of \a device. */
+template <typename MatrixType, typename TranspositionType, typename Device>
+void partial_lu_inplace(MatrixType& lu, TranspositionType& row_transpositions,
+                        typename TranspositionType::StorageIndex& nb_transpositions, Device& device) {
+  const Index blockSize = 256;
+  // Too few block columns to keep several threads busy. The factorization then runs on the calling thread only, like
+  // the tasks of the graph, rather than on the threads of parallelize_gemm.
+  internal::sequential_products_scope sequential;
+  if (MatrixType::MaxColsAtCompileTime != Dynamic || lu.cols() <= 2 * blockSize) {
+    partial_lu_inplace(lu, row_transpositions, nb_transpositions);
+    return;
+  }
+  eigen_assert(lu.rows() == lu.cols());
+  partial_lu_task_graph<typename MatrixType::Scalar, MatrixType::Flags & RowMajorBit ? RowMajor : ColMajor,
+                        typename TranspositionType::StorageIndex>
+      graph(lu.rows(), &lu.coeffRef(0, 0), lu.outerStride(), &row_transpositions.coeffRef(0), blockSize);
+  device.runTaskGraph(graph);
+  graph.finish(device, nb_transpositions);
+}
+
 /** \internal returns the determinant computed from an in-place partial-pivoting
  * LU decomposition of \a m without constructing a PartialPivLU object.
  */
@@ -511,7 +703,8 @@ typename traits<Derived>::Scalar partial_lu_determinant(const Derived& m) {
 }  // end namespace internal
 
 template <typename MatrixType, typename PermutationIndex>
-void PartialPivLU<MatrixType, PermutationIndex>::compute() {
+template <typename... Device>
+void PartialPivLU<MatrixType, PermutationIndex>::computeInPlace(Device&... device) {
   eigen_assert(m_lu.rows() < NumTraits<PermutationIndex>::highest());
 
   if (m_lu.cols() > 0)
@@ -525,7 +718,7 @@ void PartialPivLU<MatrixType, PermutationIndex>::compute() {
   m_rowsTranspositions.resize(size);
 
   typename TranspositionType::StorageIndex nb_transpositions;
-  internal::partial_lu_inplace(m_lu, m_rowsTranspositions, nb_transpositions);
+  internal::partial_lu_inplace(m_lu, m_rowsTranspositions, nb_transpositions, device...);
   m_det_p = (nb_transpositions % 2) ? -1 : 1;
 
   m_p = m_rowsTranspositions;
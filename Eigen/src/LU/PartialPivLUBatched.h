@@ -0,0 +1,188 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_PARTIALPIVLU_BATCHED_H
+#define EIGEN_PARTIALPIVLU_BATCHED_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+// LU factorization with partial pivoting of the lanes [b, b + PacketSize) of a SoA batch of Size x Size matrices,
+// in place. The row interchanges differ from lane to lane, so they are carried out by selects.
+template <typename Scalar, typename PivScalar, int Size>
+struct batched_partial_lu_kernel {
+  Scalar* data;
+  Index stride;
+  PivScalar* pivots;
+  Index pivotStride;
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void run(Index b) {
+    using Lanes = soa_lanes<Packet>;
+    Packet a[Size * Size];
+    for (int i = 0; i < Size * Size; ++i) a[i] = Lanes::load(data, stride, i, b);
+
+    const Packet zero = pzero(a[0]);
+    const Packet one = pset1<Packet>(Scalar(1));
+    for (int k = 0; k < Size; ++k) {
+      // Pivot search: the row indices are carried as scalars, which is exact for such small sizes.
+      Packet best = pabs(a[k + k * Size]);
+      Packet piv = pset1<Packet>(Scalar(k));
+      for (int i = k + 1; i < Size; ++i) {
+        const Packet v = pabs(a[i + k * Size]);
+        const Packet larger = pcmp_lt(best, v);
+        best = pselect(larger, v, best);
+        piv = pselect(larger, pset1<Packet>(Scalar(i)), piv);
+      }
+      store_pivots(piv, k, b);
+
+      for (int i = k + 1; i < Size; ++i) {
+        const Packet swap = pcmp_eq(piv, pset1<Packet>(Scalar(i)));
+        for (int j = 0; j < Size; ++j) {
+          const Packet ak = a[k + j * Size], ai = a[i + j * Size];
+          a[k + j * Size] = pselect(swap, ai, ak);
+          a[i + j * Size] = pselect(swap, ak, ai);
+        }
+      }
+
+      // Like PartialPivLU, a zero column is skipped rather than divided by zero.
+      const Packet pivot = pselect(pcmp_eq(best, zero), one, a[k + k * Size]);
+      for (int i = k + 1; i < Size; ++i) {
+        const Packet l = pdiv(a[i + k * Size], pivot);
+        a[i + k * Size] = l;
+        for (int j = k + 1; j < Size; ++j) a[i + j * Size] = pnmadd(l, a[k + j * Size], a[i + j * Size]);
+      }
+    }
+
+    for (int i = 0; i < Size * Size; ++i) Lanes::store(data, stride, i, b, a[i]);
+  }
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void store_pivots(const Packet& piv, int k, Index b) {
+    enum { PacketSize = unpacket_traits<Packet>::size };
+    EIGEN_ALIGN_MAX Scalar buffer[PacketSize];
+    pstore<Scalar, Packet>(buffer, piv);
+    for (int lane = 0; lane < PacketSize; ++lane)
+      pivots[k * pivotStride + b + lane] = static_cast<PivScalar>(buffer[lane]);
+  }
+};
+
+// Solves L U x = P b for the lanes [b, b + PacketSize) of a SoA batch of right-hand sides already permuted by P.
+template <typename Scalar, int Size>
+struct batched_partial_lu_solve_kernel {
+  const Scalar* lu;
+  Index luStride;
+  Scalar* rhs;
+  Index rhsStride;
+
+  template <typename Packet>
+  EIGEN_STRONG_INLINE void run(Index b) {
+    using Lanes = soa_lanes<Packet>;
+    Packet a[Size * Size];
+    Packet x[Size];
+    for (int i = 0; i < Size * Size; ++i) a[i] = Lanes::load(lu, luStride, i, b);
+    for (int i = 0; i < Size; ++i) x[i] = Lanes::load(rhs, rhsStride, i, b);
+
+    for (int i = 1; i < Size; ++i)
+      for (int k = 0; k < i; ++k) x[i] = pnmadd(a[i + k * Size], x[k], x[i]);
+    for (int i = Size - 1; i >= 0; --i) {
+      for (int k = i + 1; k < Size; ++k) x[i] = pnmadd(a[i + k * Size], x[k], x[i]);
+      x[i] = pdiv(x[i], a[i + i * Size]);
+    }
+
+    for (int i = 0; i < Size; ++i) Lanes::store(rhs, rhsStride, i, b, x[i]);
+  }
+};
+
+}  // end namespace internal
+
+/** \ingroup LU_Module
+ *
+ * Computes in place the LU factorizations with partial pivoting \f$ P_b A_b = L_b U_b \f$ of a
+ * batch of Size x Size real matrices.
+ *
+ * The batch is stored as a structure of arrays: \a matrices is a column-major
+ * batchSize x (Size * Size) matrix whose column <tt>i + j * Size</tt> holds the coefficient
+ * (i, j) of every matrix of the batch. Each matrix is overwritten by its factors, with the
+ * same packed storage as PartialPivLU::matrixLU(). \a transpositions is a column-major
+ * batchSize x Size integer matrix receiving the row interchanges: like
+ * PartialPivLU::transpositionsP(), row \a k of matrix \a b was exchanged with row
+ * <tt>transpositions(b, k)</tt> at step \a k.
+ *
+ * Compared to a loop of PartialPivLU<Matrix<Scalar, Size, Size>>, each SIMD lane processes a
+ * different matrix of the batch and the per-matrix pivoting is done by masked selects, so that
+ * all the arithmetic is vectorized whatever the size.
+ *
+ * As with PartialPivLU, singular matrices are not detected: their factor \a U has a zero on
+ * the diagonal.
+ *
+ * \sa batchedPartialPivLUSolve(), class PartialPivLU
+ */
+template <int Size, typename Derived, typename TranspositionsDerived>
+void batchedPartialPivLU(const MatrixBase<Derived>& matrices,
+                         const MatrixBase<TranspositionsDerived>& transpositions) {
+  internal::check_soa_batch(matrices, Size * Size);
+  EIGEN_STATIC_ASSERT(!NumTraits<typename TranspositionsDerived::Scalar>::IsComplex &&
+                          NumTraits<typename TranspositionsDerived::Scalar>::IsInteger,
+                      THE_TRANSPOSITIONS_MUST_BE_STORED_AS_INTEGERS)
+  EIGEN_STATIC_ASSERT(!TranspositionsDerived::IsRowMajor && TranspositionsDerived::InnerStrideAtCompileTime == 1,
+                      THE_BATCH_MUST_BE_A_COLUMN_MAJOR_MATRIX_WITH_CONTIGUOUS_COLUMNS)
+  eigen_assert(transpositions.rows() == matrices.rows() && transpositions.cols() == Size &&
+               "the batch of transpositions does not match the batch of matrices");
+  using Scalar = typename Derived::Scalar;
+  using PivScalar = typename TranspositionsDerived::Scalar;
+  Derived& m = matrices.const_cast_derived();
+  TranspositionsDerived& t = transpositions.const_cast_derived();
+  internal::batched_partial_lu_kernel<Scalar, PivScalar, Size> kernel{m.data(), m.outerStride(), t.data(),
+                                                                      t.outerStride()};
+  internal::soa_batch_for_each<Scalar, true>(m.rows(), kernel);
+}
+
+/** \ingroup LU_Module
+ *
+ * Solves in place the systems \f$ A_b x_b = r_b \f$ for a batch of LU factorizations computed
+ * by batchedPartialPivLU().
+ *
+ * \a rhs is a column-major batchSize x Size matrix whose row \a b holds the right-hand
+ * side of the system \a b; it is overwritten by the solution.
+ *
+ * \sa batchedPartialPivLU()
+ */
+template <int Size, typename LUDerived, typename TranspositionsDerived, typename RhsDerived>
+void batchedPartialPivLUSolve(const MatrixBase<LUDerived>& lu, const MatrixBase<TranspositionsDerived>& transpositions,
+                              const MatrixBase<RhsDerived>& rhs) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename LUDerived::Scalar, typename RhsDerived::Scalar>::value),
+                      YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+  internal::check_soa_batch(lu, Size * Size);
+  internal::check_soa_batch(rhs, Size);
+  eigen_assert(lu.rows() == rhs.rows() && transpositions.rows() == rhs.rows() && transpositions.cols() == Size &&
+               "the batches of factors and right-hand sides differ in size");
+  using Scalar = typename LUDerived::Scalar;
+  RhsDerived& r = rhs.const_cast_derived();
+
+  // The permutations are applied object by object: this is O(Size) per system against O(Size^2) for the solve.
+  for (int k = 0; k < Size; ++k) {
+    for (Index b = 0; b < r.rows(); ++b) {
+      const Index p = static_cast<Index>(transpositions.coeff(b, k));
+      if (p != k) numext::swap(r.coeffRef(b, k), r.coeffRef(b, p));
+    }
+  }
+
+  internal::batched_partial_lu_solve_kernel<Scalar, Size> kernel{lu.derived().data(), lu.derived().outerStride(),
+                                                                 r.data(), r.outerStride()};
+  internal::soa_batch_for_each<Scalar, true>(r.rows(), kernel);
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_PARTIALPIVLU_BATCHED_H
@@ -0,0 +1,216 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_UPDATABLE_LU_H
+#define EIGEN_UPDATABLE_LU_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+template <typename MatrixType_, typename PermutationIndex_>
+struct traits<UpdatableLU<MatrixType_, PermutationIndex_> > : traits<MatrixType_> {
+  using XprKind = MatrixXpr;
+  using StorageKind = SolverStorage;
+  using StorageIndex = PermutationIndex_;
+  using BaseTraits = traits<MatrixType_>;
+  enum { Flags = BaseTraits::Flags & RowMajorBit, CoeffReadCost = Dynamic };
+};
+
+}  // end namespace internal
+
+/** \ingroup LU_Module
+ *
+ * \class UpdatableLU
+ *
+ * \brief LU decomposition of a square matrix supporting column replacements
+ *
+ * \tparam MatrixType_ the type of the matrix of which we are computing the LU decomposition. Its sizes must be
+ * dynamic.
+ *
+ * This class starts from the PartialPivLU decomposition \f$ P A = L U \f$ of a square invertible matrix \b A, and
+ * maintains a factorization
+ * \f[
+ *  \mathbf{G} \, \mathbf{A} \, \mathbf{Q} = \mathbf{U}
+ * \f]
+ * while columns of \b A are replaced, where \b U is upper triangular, \b Q is a permutation of the columns and
+ * \b G, initially \f$ L^{-1} P \f$, accumulates the row operations of the updates.
+ *
+ * replaceColumn() follows Bartels and Golub: the modified column of \b U is moved to the last position, which leaves
+ * an upper Hessenberg matrix, whose subdiagonal is then eliminated by Gaussian elimination with interchanges of
+ * adjacent rows. An update and a solve both cost O(n^2), instead of the O(n^3) of a new factorization, which makes
+ * this class suited to simplex-like methods and online systems in which one column changes at a time.
+ *
+ * The row operations are applied to a dense \b G rather than kept as a list of elementary factors, so the cost of
+ * an update does not grow with the number of updates. Growth of the entries of \b U is limited by the row
+ * interchanges, as for partial pivoting, but it is still wise to call compute() again after many updates.
+ *
+ * \sa class PartialPivLU
+ */
+template <typename MatrixType_, typename PermutationIndex_>
+class UpdatableLU : public SolverBase<UpdatableLU<MatrixType_, PermutationIndex_> > {
+ public:
+  using MatrixType = MatrixType_;
+  using Base = SolverBase<UpdatableLU>;
+  friend class SolverBase<UpdatableLU>;
+
+  EIGEN_GENERIC_PUBLIC_INTERFACE(UpdatableLU)
+  EIGEN_STATIC_ASSERT(RowsAtCompileTime == Dynamic && ColsAtCompileTime == Dynamic,
+                      UpdatableLU_REQUIRES_A_MATRIX_TYPE_OF_DYNAMIC_SIZE)
+  using PermutationIndex = PermutationIndex_;
+  using PermutationType = PermutationMatrix<Dynamic, Dynamic, PermutationIndex>;
+  using PlainObject = typename MatrixType::PlainObject;
+  // The updates operate on rows of U and G, and shift the columns of U within each row.
+  using FactorType = Matrix<Scalar, Dynamic, Dynamic, RowMajor>;
+
+  /** \brief Reports whether the LU factorization was successful.
+   *
+   * \note This function always returns \c Success. It is provided for compatibility
+   * with other factorization routines.
+   * \returns \c Success
+   */
+  ComputationInfo info() const {
+    eigen_assert(m_isInitialized && "UpdatableLU is not initialized.");
+    return Success;
+  }
+
+  /** \brief Default Constructor.
+   *
+   * The default constructor is useful in cases in which the user intends to
+   * perform decompositions via UpdatableLU::compute(const MatrixType&).
+   */
+  UpdatableLU() : m_detSign(1), m_isInitialized(false) {}
+
+  /** Constructor.
+   *
+   * \param matrix the square invertible matrix of which to compute the LU decomposition.
+   */
+  template <typename InputType>
+  explicit UpdatableLU(const EigenBase<InputType>& matrix) : m_detSign(1), m_isInitialized(false) {
+    compute(matrix.derived());
+  }
+
+  /** Computes the LU decomposition of \a matrix by PartialPivLU, and forms \f$ G = L^{-1} P \f$. */
+  template <typename InputType>
+  UpdatableLU& compute(const EigenBase<InputType>& matrix) {
+    eigen_assert(matrix.rows() == matrix.cols() && "UpdatableLU is only for square matrices");
+    PartialPivLU<PlainObject, PermutationIndex> lu(matrix.derived());
+    m_u = lu.matrixLU().template triangularView<Upper>();
+    m_g = lu.permutationP().toDenseMatrix().template cast<Scalar>();
+    lu.matrixLU().template triangularView<UnitLower>().solveInPlace(m_g);
+    m_columns.resize(matrix.cols());
+    for (Index k = 0; k < matrix.cols(); ++k) m_columns(k) = internal::convert_index<PermutationIndex>(k);
+    m_detSign = int(lu.permutationP().determinant());
+    m_isInitialized = true;
+    return *this;
+  }
+
+  /** Replaces the column \a j of \b A by \a column.
+   *
+   * The new matrix should be invertible, like for PartialPivLU.
+   */
+  template <typename ColumnType>
+  UpdatableLU& replaceColumn(Index j, const MatrixBase<ColumnType>& column);
+
+  /** \returns the upper triangular factor \b U */
+  const FactorType& matrixU() const {
+    eigen_assert(m_isInitialized && "UpdatableLU is not initialized.");
+    return m_u;
+  }
+
+  /** \returns the matrix \b G of the row operations, such that \f$ G A Q = U \f$ */
+  const FactorType& matrixG() const {
+    eigen_assert(m_isInitialized && "UpdatableLU is not initialized.");
+    return m_g;
+  }
+
+  /** \returns the permutation \b Q of the columns, such that \f$ G A Q = U \f$ */
+  PermutationType permutationQ() const {
+    eigen_assert(m_isInitialized && "UpdatableLU is not initialized.");
+    return PermutationType(m_columns);
+  }
+
+  /** \returns the determinant of the matrix \b A. It has only linear complexity. */
+  Scalar determinant() const {
+    eigen_assert(m_isInitialized && "UpdatableLU is not initialized.");
+    // G is a product of a permutation, of unit lower triangular factors and of row interchanges, and Q a permutation.
+    return Scalar(m_detSign) * m_u.diagonal().prod();
+  }
+
+  inline Index rows() const { return m_u.rows(); }
+  inline Index cols() const { return m_u.cols(); }
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+  template <typename RhsType, typename DstType>
+  void _solve_impl(const RhsType& rhs, DstType& dst) const {
+    // A x = b  <=>  U (Q^T x) = G b.
+    typename RhsType::PlainObject c = m_g * rhs;
+    m_u.template triangularView<Upper>().solveInPlace(c);
+    for (Index k = 0; k < cols(); ++k) dst.row(m_columns.coeff(k)) = c.row(k);
+  }
+#endif
+
+ protected:
+  EIGEN_STATIC_ASSERT_NON_INTEGER(Scalar)
+
+  FactorType m_u;
+  FactorType m_g;
+  // The column k of U corresponds to the column m_columns(k) of A.
+  Matrix<PermutationIndex, Dynamic, 1> m_columns;
+  // The determinant of G^-1 Q^-1, which is +1 or -1.
+  int m_detSign;
+  bool m_isInitialized;
+};
+
+template <typename MatrixType, typename PermutationIndex>
+template <typename ColumnType>
+UpdatableLU<MatrixType, PermutationIndex>& UpdatableLU<MatrixType, PermutationIndex>::replaceColumn(
+    Index j, const MatrixBase<ColumnType>& column) {
+  eigen_assert(m_isInitialized && "UpdatableLU is not initialized.");
+  eigen_assert(j >= 0 && j < cols() && column.size() == rows() && "invalid column replacement");
+  const Index n = cols();
+
+  Index k = 0;
+  while (m_columns.coeff(k) != j) ++k;
+
+  // Move the column k of U to the last position and replace it by the spike G a. Rows k, ..., n-1 of U are then upper
+  // Hessenberg.
+  for (Index r = 0; r < n; ++r) {
+    // The row r of the shifted U starts at the column r - 1.
+    const Index start = numext::maxi(k, r - 1);
+    Scalar* row = &m_u.coeffRef(r, 0);
+    if (start + 1 < n) internal::smart_memmove(row + start + 1, row + n, row + start);
+  }
+  for (Index c = k; c + 1 < n; ++c) m_columns.coeffRef(c) = m_columns.coeff(c + 1);
+  m_u.col(n - 1).noalias() = m_g * column;
+  m_columns.coeffRef(n - 1) = internal::convert_index<PermutationIndex>(j);
+  // This cyclic shift of n - k columns has the sign of a product of n - k - 1 transpositions.
+  if ((n - k - 1) % 2 == 1) m_detSign = -m_detSign;
+
+  for (Index i = k; i + 1 < n; ++i) {
+    if (numext::abs(m_u.coeff(i + 1, i)) > numext::abs(m_u.coeff(i, i))) {
+      m_u.row(i).tail(n - i).swap(m_u.row(i + 1).tail(n - i));
+      m_g.row(i).swap(m_g.row(i + 1));
+      m_detSign = -m_detSign;
+    }
+    if (m_u.coeff(i + 1, i) != Scalar(0)) {
+      const Scalar l = m_u.coeff(i + 1, i) / m_u.coeff(i, i);
+      m_u.row(i + 1).tail(n - i - 1) -= l * m_u.row(i).tail(n - i - 1);
+      m_g.row(i + 1) -= l * m_g.row(i);
+    }
+    m_u.coeffRef(i + 1, i) = Scalar(0);
+  }
+  return *this;
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_UPDATABLE_LU_H
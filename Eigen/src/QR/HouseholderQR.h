@@ -141,6 +141,19 @@ class HouseholderQR : public SolverBase<HouseholderQR<MatrixType_>> {
     computeInPlace();
   }
 
+  /** \brief Constructs a QR factorization of \a matrix on the threads of \a device
+   *
+   * \sa compute(const EigenBase&, CoreThreadPoolDevice&)
+   */
+  template <typename InputType>
+  HouseholderQR(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device)
+      : m_qr(matrix.rows(), matrix.cols()),
+        m_hCoeffs((std::min)(matrix.rows(), matrix.cols())),
+        m_temp(matrix.cols()),
+        m_isInitialized(false) {
+    compute(matrix.derived(), device);
+  }
+
 #ifdef EIGEN_PARSED_BY_DOXYGEN
   /** This method finds a solution x to the equation Ax=b, where A is the matrix of which
    * *this is the QR decomposition, if any exists.
@@ -189,6 +202,29 @@ class HouseholderQR : public SolverBase<HouseholderQR<MatrixType_>> {
     return *this;
   }
 
+  /** Computes the QR factorization of \a matrix on the threads of \a device.
+   *
+   * Tall and skinny matrices, with several times more rows than columns per thread, are factored by TSQR: the rows
+   * are split into one chunk per thread, each chunk is factored independently, and the R factors of the chunks are
+   * reduced pairwise in a binary tree. The Householder vectors of the whole matrix are then reconstructed from the
+   * tree, so that matrixQR(), householderQ() and solve() are the same as for compute(const EigenBase&), up to the
+   * signs of the rows of R and of the columns of Q. Other matrices are factored sequentially. This requires the
+   * ThreadPool module:
+   * \code
+   * #include <Eigen/ThreadPool>
+   * Eigen::ThreadPool pool(8);
+   * Eigen::CoreThreadPoolDevice device(pool);
+   * Eigen::HouseholderQR<Eigen::MatrixXd> qr(A, device);
+   * Eigen::VectorXd x = qr.solve(b);
+   * \endcode
+   */
+  template <typename InputType>
+  HouseholderQR& compute(const EigenBase<InputType>& matrix, CoreThreadPoolDevice& device) {
+    m_qr = matrix.derived();
+    computeInPlace(device);
+    return *this;
+  }
+
   /** \returns the determinant of the matrix of which
    * *this is the QR decomposition. It has only linear complexity
    * (that is, O(n) where n is the dimension of the square matrix)
@@ -278,6 +314,8 @@ class HouseholderQR : public SolverBase<HouseholderQR<MatrixType_>> {
   EIGEN_STATIC_ASSERT_NON_INTEGER(Scalar)
 
   void computeInPlace();
+  template <typename Device>
+  void computeInPlace(Device& device);
 
   MatrixType m_qr;
   HCoeffsType m_hCoeffs;
@@ -475,6 +513,137 @@ struct householder_qr_inplace_blocked {
   }
 };
 
+/** \internal
+ * Householder QR of a tall and skinny matrix by TSQR on the threads of \a device.
+ *
+ * The rows of \a mat are split into one chunk per thread. Each chunk is factored in place, and the R factors of the
+ * chunks are reduced pairwise in a binary tree: each node factors the two R factors of its children stacked on top of
+ * each other. The tree is then applied to the first columns of the identity, from the root to the chunks, which gives
+ * the thin factor Q explicitly. Finally, the Householder vectors Y and the coefficients of the compact WY form
+ * I - Y T Y^* of Q are reconstructed by an LU decomposition of Q - S, where S is a diagonal of signs chosen during the
+ * elimination so that no pivoting is needed. See G. Ballard et al., "Reconstructing Householder vectors from
+ * tall-skinny QR", IPDPS 2014.
+ *
+ * On exit, \a mat and \a hCoeffs hold the same representation as householder_qr_inplace_blocked. Matrices too small
+ * to give each thread a chunk of several times more rows than columns are factored sequentially.
+ */
+template <typename MatrixQR, typename HCoeffs, typename Device>
+void householder_qr_inplace_tsqr(MatrixQR& mat, HCoeffs& hCoeffs, typename MatrixQR::Scalar* tempData,
+                                 Device& device) {
+  using Scalar = typename MatrixQR::Scalar;
+  using RealScalar = typename MatrixQR::RealScalar;
+  using PlainMatrix = Matrix<Scalar, Dynamic, Dynamic>;
+  using PlainVector = Matrix<Scalar, Dynamic, 1>;
+
+  const Index rows = mat.rows();
+  const Index cols = mat.cols();
+  const Index minChunkRows = numext::maxi<Index>(4 * cols, 1024);
+  const Index numChunks = numext::mini<Index>(device.m_pool.NumThreads(), rows / minChunkRows);
+  if (MatrixQR::MaxRowsAtCompileTime != Dynamic || cols == 0 || numChunks < 2) {
+    householder_qr_inplace_blocked<MatrixQR, HCoeffs>::run(mat, hCoeffs, 48, tempData);
+    return;
+  }
+
+  const auto chunkBegin = [&](Index c) { return c * rows / numChunks; };
+  const float chunkCost = static_cast<float>(rows) * static_cast<float>(cols) * static_cast<float>(cols);
+
+  // 1 - factor the chunks and extract their R factors
+  std::vector<PlainVector> chunkCoeffs(numChunks, PlainVector(cols));
+  std::vector<PlainMatrix> factors(numChunks);
+  auto factorChunks = [&](Index begin, Index end) {
+    for (Index c = begin; c < end; ++c) {
+      auto chunk = mat.middleRows(chunkBegin(c), chunkBegin(c + 1) - chunkBegin(c));
+      householder_qr_inplace_blocked<decltype(chunk), PlainVector>::run(chunk, chunkCoeffs[c], 48);
+      factors[c] = chunk.topRows(cols).template triangularView<Upper>();
+    }
+  };
+  device.parallelForBlocks(numChunks, 1, 2.0f * chunkCost, factorChunks);
+
+  // 2 - reduce the R factors pairwise; tree[l] holds the factorizations of the stacked pairs of level l, and an odd
+  // factor at the end of a level is carried over to the next one.
+  std::vector<std::vector<PlainMatrix>> tree;
+  std::vector<std::vector<PlainVector>> treeCoeffs;
+  while (factors.size() > 1) {
+    const Index pairs = static_cast<Index>(factors.size() / 2);
+    std::vector<PlainMatrix> nodes(pairs, PlainMatrix(2 * cols, cols));
+    std::vector<PlainVector> nodeCoeffs(pairs, PlainVector(cols));
+    std::vector<PlainMatrix> next((factors.size() + 1) / 2);
+    auto reducePairs = [&](Index begin, Index end) {
+      for (Index i = begin; i < end; ++i) {
+        nodes[i] << factors[2 * i], factors[2 * i + 1];
+        householder_qr_inplace_blocked<PlainMatrix, PlainVector>::run(nodes[i], nodeCoeffs[i], 48);
+        next[i] = nodes[i].topRows(cols).template triangularView<Upper>();
+      }
+    };
+    const float nodeCost = 4.0f * static_cast<float>(cols) * static_cast<float>(cols) * static_cast<float>(cols);
+    device.parallelForBlocks(pairs, 1, static_cast<float>(pairs) * nodeCost, reducePairs);
+    if (factors.size() % 2) next.back() = std::move(factors.back());
+    tree.push_back(std::move(nodes));
+    treeCoeffs.push_back(std::move(nodeCoeffs));
+    factors = std::move(next);
+  }
+  const PlainMatrix R = std::move(factors.front());
+
+  // 3 - apply the tree to the first columns of the identity, from the root down to the chunks
+  std::vector<PlainMatrix> blocks(1, PlainMatrix::Identity(cols, cols));
+  for (Index l = static_cast<Index>(tree.size()) - 1; l >= 0; --l) {
+    const std::vector<PlainMatrix>& nodes = tree[l];
+    const Index pairs = static_cast<Index>(nodes.size());
+    std::vector<PlainMatrix> children(2 * pairs + (static_cast<Index>(blocks.size()) - pairs));
+    for (Index i = 0; i < pairs; ++i) {
+      PlainMatrix q = PlainMatrix::Zero(2 * cols, cols);
+      q.topRows(cols) = blocks[i];
+      q.applyOnTheLeft(householderSequence(nodes[i], treeCoeffs[l][i].conjugate()));
+      children[2 * i] = q.topRows(cols);
+      children[2 * i + 1] = q.bottomRows(cols);
+    }
+    if (static_cast<Index>(blocks.size()) > pairs) children.back() = std::move(blocks.back());
+    blocks = std::move(children);
+  }
+
+  // 4 - form the thin Q of each chunk. It cannot overwrite the chunk in place, since its Householder vectors are read
+  // until the last column is formed, and all chunks are formed at the same time, so the temporary has the size of
+  // mat: the extra memory of the factorization is that of one copy of the tall and skinny input. Its rows below the
+  // first block become the Householder vectors of mat in step 6.
+  PlainMatrix Q(rows, cols);
+  auto formQ = [&](Index begin, Index end) {
+    for (Index c = begin; c < end; ++c) {
+      const Index chunkRows = chunkBegin(c + 1) - chunkBegin(c);
+      auto q = Q.middleRows(chunkBegin(c), chunkRows);
+      q.setZero();
+      q.topRows(cols) = blocks[c];
+      q.applyOnTheLeft(householderSequence(mat.middleRows(chunkBegin(c), chunkRows), chunkCoeffs[c].conjugate()));
+    }
+  };
+  device.parallelForBlocks(numChunks, 1, 2.0f * chunkCost, formQ);
+
+  // 5 - LU decomposition of Q1 - S without pivoting. Each diagonal entry of S has the opposite sign of the current
+  // pivot, so that the pivots are at least one in magnitude.
+  auto Q1 = Q.topRows(cols);
+  PlainVector signs(cols);
+  for (Index k = 0; k < cols; ++k) {
+    const Scalar pivot = Q1(k, k);
+    const RealScalar absPivot = numext::abs(pivot);
+    signs(k) = absPivot == RealScalar(0) ? Scalar(-1) : Scalar(-pivot / absPivot);
+    Q1(k, k) -= signs(k);
+    const Index rs = cols - k - 1;
+    Q1.col(k).tail(rs) /= Q1(k, k);
+    Q1.bottomRightCorner(rs, rs).noalias() -= Q1.col(k).tail(rs) * Q1.row(k).tail(rs);
+  }
+  // Y2 = Q2 * U^-1
+  auto solveRows = [&](Index begin, Index end) {
+    auto Q2 = Q.middleRows(cols + begin, end - begin);
+    Q1.template triangularView<Upper>().template solveInPlace<OnTheRight>(Q2);
+  };
+  device.parallelForBlocks(rows - cols, 64, chunkCost, solveRows);
+
+  // 6 - with Q = [I; 0] - Y T Y^* S^*, the diagonal of T is -U_kk conj(S_kk), and R becomes S R.
+  for (Index k = 0; k < cols; ++k) hCoeffs.coeffRef(k) = -numext::conj(Q1(k, k)) * signs(k);
+  mat.topRows(cols).template triangularView<Upper>() = signs.asDiagonal() * R;
+  mat.topRows(cols).template triangularView<StrictlyLower>() = Q1;
+  mat.bottomRows(rows - cols) = Q.bottomRows(rows - cols);
+}
+
 }  // end namespace internal
 
 #ifndef EIGEN_PARSED_BY_DOXYGEN
@@ -534,6 +703,20 @@ void HouseholderQR<MatrixType>::computeInPlace() {
   m_isInitialized = true;
 }
 
+template <typename MatrixType>
+template <typename Device>
+void HouseholderQR<MatrixType>::computeInPlace(Device& device) {
+  m_hCoeffs.resize((std::min)(m_qr.rows(), m_qr.cols()));
+  m_temp.resize(m_qr.cols());
+
+  // The chunks of the factorization are shared among the threads of the device, and the products evaluated on the
+  // calling thread, or by the sequential fallback of small matrices, do not start the threads of parallelize_gemm.
+  internal::sequential_products_scope sequential;
+  internal::householder_qr_inplace_tsqr(m_qr, m_hCoeffs, m_temp.data(), device);
+
+  m_isInitialized = true;
+}
+
 /** \return the Householder QR decomposition of \c *this.
  *
  * \sa class HouseholderQR
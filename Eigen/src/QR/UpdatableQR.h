@@ -0,0 +1,299 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_UPDATABLE_QR_H
+#define EIGEN_UPDATABLE_QR_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+template <typename MatrixType_>
+struct traits<UpdatableQR<MatrixType_>> : traits<MatrixType_> {
+  using XprKind = MatrixXpr;
+  using StorageKind = SolverStorage;
+  using StorageIndex = int;
+  enum { Flags = 0 };
+};
+
+}  // end namespace internal
+
+/** \ingroup QR_Module
+ *
+ *
+ * \class UpdatableQR
+ *
+ * \brief QR decomposition of a matrix supporting row and column insertions and deletions, and rank-one updates
+ *
+ * \tparam MatrixType_ the type of the matrix of which we are computing the QR decomposition. Its sizes must be
+ * dynamic.
+ *
+ * This class computes a QR decomposition \f$ \mathbf{A} = \mathbf{Q} \, \mathbf{R} \f$ like HouseholderQR, and then
+ * maintains it while \b A is modified, with Givens rotations (Golub & Van Loan, Matrix Computations, section 6.5):
+ *  - insertRow() and removeRow() cost O(m^2),
+ *  - insertColumn() costs O(m^2), and removeColumn() O(m n),
+ *  - rankUpdate() replaces \b A by \f$ \mathbf{A} + u v^* \f$ in O(m^2),
+ * where \b A is m-by-n, instead of the O(m n^2) of a new factorization. This suits online least-squares problems
+ * whose observations or unknowns come and go.
+ *
+ * Unlike HouseholderQR, which stores \b Q compactly as a product of Householder reflectors, the m-by-m factor \b Q
+ * is stored explicitly, since the rotations of the updates do not preserve the structure of the reflectors. The
+ * memory cost is thus O(m^2), which makes this class best suited to matrices that are not too tall.
+ *
+ * Like HouseholderQR, no pivoting is performed: solve() assumes that \b A has full column rank.
+ *
+ * \sa class HouseholderQR
+ */
+template <typename MatrixType_>
+class UpdatableQR : public SolverBase<UpdatableQR<MatrixType_>> {
+ public:
+  using MatrixType = MatrixType_;
+  using Base = SolverBase<UpdatableQR>;
+  friend class SolverBase<UpdatableQR>;
+
+  EIGEN_GENERIC_PUBLIC_INTERFACE(UpdatableQR)
+  EIGEN_STATIC_ASSERT(RowsAtCompileTime == Dynamic && ColsAtCompileTime == Dynamic,
+                      UpdatableQR_REQUIRES_A_MATRIX_TYPE_OF_DYNAMIC_SIZE)
+
+  using PlainMatrixType = Matrix<Scalar, Dynamic, Dynamic, (MatrixType::Flags & RowMajorBit) ? RowMajor : ColMajor>;
+  // The rotations of the updates combine columns of Q and rows of R.
+  using MatrixQType = Matrix<Scalar, Dynamic, Dynamic, ColMajor>;
+  using MatrixRType = Matrix<Scalar, Dynamic, Dynamic, RowMajor>;
+
+  /** \brief Reports whether the QR factorization was successful.
+   *
+   * \note This function always returns \c Success. It is provided for compatibility
+   * with other factorization routines.
+   * \returns \c Success
+   */
+  ComputationInfo info() const {
+    eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+    return Success;
+  }
+
+  /** \brief Default Constructor.
+   *
+   * The default constructor is useful in cases in which the user intends to
+   * perform decompositions via UpdatableQR::compute(const MatrixType&).
+   */
+  UpdatableQR() : m_isInitialized(false) {}
+
+  /** \brief Constructs a QR factorization from a given matrix
+   *
+   * \sa compute()
+   */
+  template <typename InputType>
+  explicit UpdatableQR(const EigenBase<InputType>& matrix) : m_isInitialized(false) {
+    compute(matrix.derived());
+  }
+
+  /** Computes the QR factorization of \a matrix by HouseholderQR, and forms its factor \b Q. */
+  template <typename InputType>
+  UpdatableQR& compute(const EigenBase<InputType>& matrix) {
+    HouseholderQR<PlainMatrixType> qr(matrix.derived());
+    m_q = qr.householderQ();
+    m_r = qr.matrixQR().template triangularView<Upper>();
+    m_isInitialized = true;
+    return *this;
+  }
+
+  /** \returns the m-by-m unitary factor \b Q */
+  const MatrixQType& matrixQ() const {
+    eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+    return m_q;
+  }
+
+  /** \returns the m-by-n upper triangular factor \b R */
+  const MatrixRType& matrixR() const {
+    eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+    return m_r;
+  }
+
+  /** Inserts \a row as the row \a i of \b A, shifting the former rows i, i+1, ... down.
+   * \sa removeRow() */
+  template <typename RowType>
+  UpdatableQR& insertRow(Index i, const MatrixBase<RowType>& row);
+
+  /** Removes the row \a i of \b A.
+   * \sa insertRow() */
+  UpdatableQR& removeRow(Index i);
+
+  /** Inserts \a column as the column \a j of \b A, shifting the former columns j, j+1, ... to the right.
+   * \sa removeColumn() */
+  template <typename ColumnType>
+  UpdatableQR& insertColumn(Index j, const MatrixBase<ColumnType>& column);
+
+  /** Removes the column \a j of \b A.
+   * \sa insertColumn() */
+  UpdatableQR& removeColumn(Index j);
+
+  /** Replaces \b A by \f$ \mathbf{A} + u v^* \f$, where \a u and \a v are column vectors. */
+  template <typename UType, typename VType>
+  UpdatableQR& rankUpdate(const MatrixBase<UType>& u, const MatrixBase<VType>& v);
+
+  /** \returns the matrix \b A, as represented by the current factorization */
+  PlainMatrixType reconstructedMatrix() const {
+    eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+    return m_q * m_r;
+  }
+
+  inline Index rows() const { return m_r.rows(); }
+  inline Index cols() const { return m_r.cols(); }
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+  template <typename RhsType, typename DstType>
+  void _solve_impl(const RhsType& rhs, DstType& dst) const;
+#endif
+
+ protected:
+  EIGEN_STATIC_ASSERT_NON_INTEGER(Scalar)
+
+  // Rotates the rows k and k+1 of R so that R(k + 1, col) becomes zero, and Q accordingly.
+  void eliminate(Index k, Index col) {
+    JacobiRotation<Scalar> g;
+    g.makeGivens(m_r.coeff(k, col), m_r.coeff(k + 1, col));
+    m_r.rightCols(m_r.cols() - col).applyOnTheLeft(k, k + 1, g.adjoint());
+    m_r.coeffRef(k + 1, col) = Scalar(0);
+    m_q.applyOnTheRight(k, k + 1, g);
+  }
+
+  MatrixQType m_q;
+  MatrixRType m_r;
+  bool m_isInitialized;
+};
+
+template <typename MatrixType>
+template <typename RowType>
+UpdatableQR<MatrixType>& UpdatableQR<MatrixType>::insertRow(Index i, const MatrixBase<RowType>& row) {
+  eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+  eigen_assert(i >= 0 && i <= rows() && row.size() == cols() && "invalid row insertion");
+  const Index m = rows(), n = cols();
+
+  // [A_top; a; A_bottom] = P [a; A] = P diag(1, Q) [a; R], with P moving the first row to the position i.
+  MatrixQType q(m + 1, m + 1);
+  q.row(i).setZero();
+  q.coeffRef(i, 0) = Scalar(1);
+  q.col(0).head(i).setZero();
+  q.col(0).tail(m - i).setZero();
+  q.topRightCorner(i, m) = m_q.topRows(i);
+  q.bottomRightCorner(m - i, m) = m_q.bottomRows(m - i);
+  m_q.swap(q);
+
+  MatrixRType r(m + 1, n);
+  r.row(0) = row;
+  r.bottomRows(m) = m_r;
+  m_r.swap(r);
+
+  // [a; R] is upper Hessenberg.
+  for (Index k = 0; k < numext::mini(m, n); ++k) eliminate(k, k);
+  return *this;
+}
+
+template <typename MatrixType>
+UpdatableQR<MatrixType>& UpdatableQR<MatrixType>::removeRow(Index i) {
+  eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+  eigen_assert(i >= 0 && i < rows() && "invalid row removal");
+  const Index m = rows(), n = cols();
+
+  // Rotate the row i of Q to a multiple of e_0. The rotations of R from the bottom leave R(1:m, :) upper triangular.
+  for (Index k = m - 1; k > 0; --k) {
+    JacobiRotation<Scalar> g;
+    g.makeGivens(numext::conj(m_q.coeff(i, k - 1)), numext::conj(m_q.coeff(i, k)));
+    m_q.applyOnTheRight(k - 1, k, g);
+    m_q.coeffRef(i, k) = Scalar(0);
+    if (k - 1 < n) m_r.rightCols(n - (k - 1)).applyOnTheLeft(k - 1, k, g.adjoint());
+  }
+
+  // Q is now unitary with Q(i, 0) of modulus one, hence Q(:, 0) = Q(i, 0) e_i and Q(i, :) = Q(i, 0) e_0^T.
+  MatrixQType q(m - 1, m - 1);
+  q.topRows(i) = m_q.block(0, 1, i, m - 1);
+  q.bottomRows(m - 1 - i) = m_q.block(i + 1, 1, m - 1 - i, m - 1);
+  m_q.swap(q);
+
+  MatrixRType r = m_r.bottomRows(m - 1);
+  m_r.swap(r);
+  return *this;
+}
+
+template <typename MatrixType>
+template <typename ColumnType>
+UpdatableQR<MatrixType>& UpdatableQR<MatrixType>::insertColumn(Index j, const MatrixBase<ColumnType>& column) {
+  eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+  eigen_assert(j >= 0 && j <= cols() && column.size() == rows() && "invalid column insertion");
+  const Index m = rows(), n = cols();
+
+  MatrixRType r(m, n + 1);
+  r.leftCols(j) = m_r.leftCols(j);
+  r.col(j).noalias() = m_q.adjoint() * column;
+  r.rightCols(n - j) = m_r.rightCols(n - j);
+  m_r.swap(r);
+
+  // Zero the new column from the bottom; each rotation fills in a diagonal entry of the shifted columns.
+  for (Index k = m - 2; k >= j; --k) eliminate(k, j);
+  return *this;
+}
+
+template <typename MatrixType>
+UpdatableQR<MatrixType>& UpdatableQR<MatrixType>::removeColumn(Index j) {
+  eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+  eigen_assert(j >= 0 && j < cols() && "invalid column removal");
+  const Index m = rows(), n = cols();
+
+  MatrixRType r(m, n - 1);
+  r.leftCols(j) = m_r.leftCols(j);
+  r.rightCols(n - 1 - j) = m_r.rightCols(n - 1 - j);
+  m_r.swap(r);
+
+  // The columns j, j+1, ... are upper Hessenberg.
+  for (Index k = j; k < numext::mini(m - 1, n - 1); ++k) eliminate(k, k);
+  return *this;
+}
+
+template <typename MatrixType>
+template <typename UType, typename VType>
+UpdatableQR<MatrixType>& UpdatableQR<MatrixType>::rankUpdate(const MatrixBase<UType>& u, const MatrixBase<VType>& v) {
+  eigen_assert(m_isInitialized && "UpdatableQR is not initialized.");
+  eigen_assert(u.size() == rows() && v.size() == cols() && "invalid rank update");
+  const Index m = rows(), n = cols();
+
+  // A + u v^* = Q (R + w v^*) with w = Q^* u. Rotating w to a multiple of e_0 from the bottom makes R upper
+  // Hessenberg, the update then only touches its first row, and a second sweep restores the triangular shape.
+  Matrix<Scalar, Dynamic, 1> w = m_q.adjoint() * u;
+  for (Index k = m - 1; k > 0; --k) {
+    JacobiRotation<Scalar> g;
+    g.makeGivens(w.coeff(k - 1), w.coeff(k));
+    w.applyOnTheLeft(k - 1, k, g.adjoint());
+    if (k - 1 < n) m_r.rightCols(n - (k - 1)).applyOnTheLeft(k - 1, k, g.adjoint());
+    m_q.applyOnTheRight(k - 1, k, g);
+  }
+  m_r.row(0) += w.coeff(0) * v.adjoint();
+  for (Index k = 0; k < numext::mini(m - 1, n); ++k) eliminate(k, k);
+  return *this;
+}
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+template <typename MatrixType_>
+template <typename RhsType, typename DstType>
+void UpdatableQR<MatrixType_>::_solve_impl(const RhsType& rhs, DstType& dst) const {
+  const Index rank = (std::min)(rows(), cols());
+
+  typename RhsType::PlainObject c = m_q.adjoint() * rhs;
+
+  m_r.topLeftCorner(rank, rank).template triangularView<Upper>().solveInPlace(c.topRows(rank));
+
+  dst.topRows(rank) = c.topRows(rank);
+  dst.bottomRows(cols() - rank).setZero();
+}
+#endif
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_UPDATABLE_QR_H
@@ -158,6 +158,15 @@ class BDCSVD : public SVDBase<BDCSVD<MatrixType_, Options_> > {
     compute_impl(matrix, internal::get_computation_options(Options));
   }
 
+  /** \brief Constructor performing the decomposition of given matrix on the threads of \a device.
+   *
+   * \sa compute(const MatrixBase<Derived>&, CoreThreadPoolDevice&)
+   */
+  template <typename Derived>
+  BDCSVD(const MatrixBase<Derived>& matrix, CoreThreadPoolDevice& device) : m_numIters(0) {
+    compute_impl(matrix, internal::get_computation_options(Options), device);
+  }
+
   /** \brief Constructor performing the SVD of an upper bidiagonal matrix given its diagonal and superdiagonal.
    *
    * This skips the bidiagonalization step and directly runs the divide-and-conquer algorithm.
@@ -201,6 +210,30 @@ class BDCSVD : public SVDBase<BDCSVD<MatrixType_, Options_> > {
     return compute_impl(matrix, m_computationOptions);
   }
 
+  /** \brief Method performing the decomposition of given matrix on the threads of \a device.
+   *
+   * This is a variant of compute(const MatrixBase<Derived>&) whose bidiagonalization and divide-and-conquer phases run
+   * on the threads of \a device. The matrix-vector products of the bidiagonalization panels and the updates of the
+   * trailing matrix are split across the threads. The independent subproblems of the lower levels of the recursion are
+   * shared among the threads, and the large merges of the upper levels solve their secular equations and update the
+   * singular vectors in parallel. The results match those of compute(const MatrixBase<Derived>&) up to rounding in the
+   * matrix products. The QR preconditioning of very rectangular matrices is not affected. This requires the ThreadPool
+   * module:
+   * \code
+   * #include <Eigen/ThreadPool>
+   * Eigen::ThreadPool pool(8);
+   * Eigen::CoreThreadPoolDevice device(pool);
+   * Eigen::BDCSVD<Eigen::MatrixXd, Eigen::ComputeThinU | Eigen::ComputeThinV> svd(A, device);
+   * \endcode
+   *
+   * \param matrix the matrix to decompose
+   * \param device the device on whose threads the divide-and-conquer phase runs
+   */
+  template <typename Derived>
+  BDCSVD& compute(const MatrixBase<Derived>& matrix, CoreThreadPoolDevice& device) {
+    return compute_impl(matrix, m_computationOptions, device);
+  }
+
   /** \brief Method performing the decomposition of given matrix, as specified by
    *         the `computationOptions` parameter.
    *
@@ -240,9 +273,14 @@ class BDCSVD : public SVDBase<BDCSVD<MatrixType_, Options_> > {
   template <typename Derived>
   BDCSVD& compute_impl(const MatrixBase<Derived>& matrix, unsigned int computationOptions);
   template <typename Derived>
-  BDCSVD& compute_impl(const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::true_type);
-  template <typename Derived>
-  BDCSVD& compute_impl(const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::false_type);
+  BDCSVD& compute_impl(const MatrixBase<Derived>& matrix, unsigned int computationOptions,
+                       CoreThreadPoolDevice& device);
+  template <typename Derived, typename... Device>
+  BDCSVD& compute_impl(const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::true_type,
+                       Device&... device);
+  template <typename Derived, typename... Device>
+  BDCSVD& compute_impl(const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::false_type,
+                       Device&... device);
   template <typename DerivedD, typename DerivedE>
   BDCSVD& compute_bidiagonal_impl(const MatrixBase<DerivedD>& diagonal, const MatrixBase<DerivedE>& superdiagonal,
                                   unsigned int computationOptions);
@@ -334,8 +372,25 @@ BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::compute_impl(const Mat
 
 template <typename MatrixType, int Options>
 template <typename Derived>
+BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::compute_impl(const MatrixBase<Derived>& matrix,
+                                                                       unsigned int computationOptions,
+                                                                       CoreThreadPoolDevice& device) {
+  EIGEN_STATIC_ASSERT_SAME_MATRIX_SIZE(Derived, MatrixType);
+  EIGEN_STATIC_ASSERT((std::is_same<typename Derived::Scalar, typename MatrixType::Scalar>::value),
+                      Input matrix must have the same Scalar type as the BDCSVD object.);
+
+  typedef internal::bool_constant<(MaxColsAtCompileTime != Dynamic && MaxColsAtCompileTime < 3)> AlwaysUseSmallSvd;
+  // The work is shared among the threads of the device: the matrix products of the merges, of the bidiagonalization
+  // and of the extraction of U and V, whether in the tasks of the device or on the calling thread, do not start the
+  // threads of parallelize_gemm.
+  internal::sequential_products_scope sequential;
+  return compute_impl(matrix, computationOptions, AlwaysUseSmallSvd(), device);
+}
+
+template <typename MatrixType, int Options>
+template <typename Derived, typename... Device>
 EIGEN_DONT_INLINE BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::compute_impl(
-    const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::true_type) {
+    const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::true_type, Device&...) {
   allocate_small(matrix.rows(), matrix.cols(), computationOptions);
 
   smallSvd.compute(matrix);
@@ -351,9 +406,9 @@ EIGEN_DONT_INLINE BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::comp
 }
 
 template <typename MatrixType, int Options>
-template <typename Derived>
+template <typename Derived, typename... Device>
 EIGEN_DONT_INLINE BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::compute_impl(
-    const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::false_type) {
+    const MatrixBase<Derived>& matrix, unsigned int computationOptions, internal::false_type, Device&... device) {
   using std::abs;
 
   allocate(matrix.rows(), matrix.cols(), computationOptions);
@@ -397,9 +452,9 @@ EIGEN_DONT_INLINE BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::comp
     qrDecomp.compute(copyWorkspace);
     reducedTriangle = qrDecomp.matrixQR().topRows(diagSize());
     reducedTriangle.template triangularView<StrictlyLower>().setZero();
-    bid.compute(reducedTriangle);
+    bid.compute(reducedTriangle, device...);
   } else {
-    bid.compute(copyWorkspace);
+    bid.compute(copyWorkspace, device...);
   }
 
   //**** step 2 - Divide & Conquer
@@ -414,7 +469,7 @@ EIGEN_DONT_INLINE BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::comp
   m_impl.computed().topRows(diagSize()).diagonal() = bid.bidiagonal().diagonal();
   m_impl.computed().topRows(diagSize()).template diagonal<-1>() = bid.bidiagonal().diagonal(1);
   m_impl.splitNegligibleSuperdiagonal(diagSize());
-  m_impl.divide(0, diagSize() - 1, 0, 0, 0);
+  m_impl.divide(diagSize(), device...);
   m_info = m_impl.info();
   m_numIters = m_impl.numIters();
   if (m_info != Success && m_info != NoConvergence) {
@@ -560,7 +615,7 @@ EIGEN_DONT_INLINE BDCSVD<MatrixType, Options>& BDCSVD<MatrixType, Options>::comp
 
   //**** Run D&C.
   m_impl.splitNegligibleSuperdiagonal(n);
-  m_impl.divide(0, n - 1, 0, 0, 0);
+  m_impl.divide(n);
   m_info = m_impl.info();
   m_numIters = m_impl.numIters();
   if (m_info != Success && m_info != NoConvergence) {
@@ -52,8 +52,11 @@ class bdcsvd_impl {
 
   void allocate(Index diagSize, bool compU, bool compV);
 
-  /** Entry point for the divide-and-conquer phase. */
-  void divide(Index firstCol, Index lastCol, Index firstRowW, Index firstColW, Index shift);
+  /** Entry point for the divide-and-conquer phase on the n x n bidiagonal stored in computed(). If a
+   * CoreThreadPoolDevice is given, independent subproblems and the secular equations of the merges run on its
+   * threads. */
+  template <typename... Device>
+  void divide(Index n, Device&... device);
 
   /** Zeroes sub-diagonal entries of the stored bidiagonal that are negligible for the matrix as a whole. */
   void splitNegligibleSuperdiagonal(Index n);
@@ -70,30 +73,102 @@ class bdcsvd_impl {
   void setAlgoSwap(int s) { m_algoswap = s; }
 
  private:
-  void computeSVDofM(Index firstCol, Index n, MatrixXr& U, VectorType& singVals, MatrixXr& V);
+  // Scratch memory of one sequential run of divide(). The threaded path gives one to each concurrent task.
+  struct Workspace {
+    ArrayXr real;
+    ArrayXi index;
+    // Reused base-case JacobiSVDs (one per option set) so that recursive divide()
+    // calls don't reallocate JacobiSVD's internal U/V/sigma buffers each time.
+    JacobiSVD<MatrixXr, ComputeFullU> svdU;
+    JacobiSVD<MatrixXr, ComputeFullU | ComputeFullV> svdUV;
+    MatrixXr base;
+    int numIters = 0;
+    ComputationInfo info = Success;
+
+    void allocate(Index size, bool vectors, Index chunks, Index algoswap) {
+      // Vector updates need the three matrix-sized packing buffers used by
+      // structured_update(). Values-only decompositions only need five vectors:
+      // diag, shifts, mus, zhat, and diagShifted, the last one once per chunk
+      // of secular equations solved concurrently.
+      Index realSize = (4 + chunks) * size;
+      if (vectors) realSize = numext::maxi(realSize, (size + 1) * (size + 1) * 3);
+      if (real.size() < realSize) real.resize(realSize);
+      if (index.size() < 3 * size) index.resize(3 * size);
+      base.resize(algoswap + 1, algoswap);
+    }
+  };
+
+  // A node of the recursion tree of divide(): the arguments of one recursive call.
+  struct Node {
+    Index firstCol, lastCol, firstRowW, firstColW, shift;
+  };
+
+  // Runs the chunks of a merge one after the other.
+  struct SequentialFor {
+    Index concurrency() const { return 1; }
+    template <typename BinaryFunctor>
+    void operator()(Index size, Index, float, BinaryFunctor& f) const {
+      f(0, size);
+    }
+  };
+
+  // Runs the chunks of a merge on the threads of a CoreThreadPoolDevice.
+  template <typename Device>
+  struct DeviceFor {
+    Device& device;
+    Index concurrency() const { return device.m_pool.NumThreads(); }
+    template <typename BinaryFunctor>
+    void operator()(Index size, Index granularity, float cost, BinaryFunctor& f) const {
+      device.parallelForBlocks(size, granularity, cost, f);
+    }
+  };
+
+  static Node leftChild(const Node& node) {
+    const Index k = (node.lastCol - node.firstCol + 1) / 2;
+    return Node{node.firstCol, node.firstCol + k - 1, node.firstRowW, node.firstColW + 1, node.shift + 1};
+  }
+  static Node rightChild(const Node& node) {
+    const Index k = (node.lastCol - node.firstCol + 1) / 2;
+    return Node{node.firstCol + k + 1, node.lastCol, node.firstRowW + k + 1, node.firstColW + k + 1, node.shift};
+  }
+  static void combineInfo(ComputationInfo& info, ComputationInfo other) {
+    if (info == Success || (info == NoConvergence && other != Success)) info = other;
+  }
+
+  void divideRoot(Index n);
+  template <typename Device>
+  void divideRoot(Index n, Device& device);
+  void divide(Workspace& ws, const Node& node);
+  template <typename ParallelFor>
+  void merge(Workspace& ws, const Node& node, const ParallelFor& parallelFor);
+  template <typename ParallelFor>
+  void computeSVDofM(Workspace& ws, Index firstCol, Index n, MatrixXr& U, VectorType& singVals, MatrixXr& V,
+                     const ParallelFor& parallelFor);
   void computeSingVals(const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm, VectorType& singVals,
-                       ArrayRef shifts, ArrayRef mus);
-  void perturbCol0(const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm, const VectorType& singVals,
-                   const ArrayRef& shifts, const ArrayRef& mus, ArrayRef zhat);
+                       ArrayRef shifts, ArrayRef mus, Index kBegin, Index kEnd, ArrayRef diagShifted,
+                       Index& numIters) const;
+  bool perturbCol0(const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm, const VectorType& singVals,
+                   const ArrayRef& shifts, const ArrayRef& mus, ArrayRef zhat, Index kBegin, Index kEnd) const;
   void computeSingVecs(const ArrayRef& zhat, const ArrayRef& diag, const IndicesRef& perm, const VectorType& singVals,
-                       const ArrayRef& shifts, const ArrayRef& mus, MatrixXr& U, MatrixXr& V);
+                       const ArrayRef& shifts, const ArrayRef& mus, MatrixXr& U, MatrixXr& V, Index kBegin,
+                       Index kEnd) const;
   void deflation43(Index firstCol, Index shift, Index i, Index size);
   void deflation44(Index firstColu, Index firstColm, Index firstRowW, Index firstColW, Index i, Index j, Index size);
-  void deflation(Index firstCol, Index lastCol, Index k, Index firstRowW, Index firstColW, Index shift);
-  void structured_update(Block<MatrixXr, Dynamic, Dynamic> A, const MatrixXr& B, Index n1);
+  void deflation(Workspace& ws, Index firstCol, Index lastCol, Index k, Index firstRowW, Index firstColW, Index shift);
+  template <typename ParallelFor>
+  void structured_update(Workspace& ws, Block<MatrixXr, Dynamic, Dynamic> A, const MatrixXr& B, Index n1,
+                         const ParallelFor& parallelFor);
   static RealScalar secularEq(RealScalar x, const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm,
                               const ArrayRef& diagShifted, RealScalar shift);
   template <typename SVDType>
-  void computeBaseCase(SVDType& svd, Index n, Index firstCol, Index firstRowW, Index firstColW, Index shift);
+  void computeBaseCase(Workspace& ws, SVDType& svd, const Node& node);
 
   MatrixXr m_naiveU, m_naiveV;
   MatrixXr m_computed;
-  ArrayXr m_workspace;
-  ArrayXi m_workspaceI;
-  // Reused base-case JacobiSVDs (one per option set) so that recursive divide()
-  // calls don't reallocate JacobiSVD's internal U/V/sigma buffers each time.
-  JacobiSVD<MatrixXr, ComputeFullU> m_baseSvdU;
-  JacobiSVD<MatrixXr, ComputeFullU | ComputeFullV> m_baseSvdUV;
+  // The bidiagonal given to divide(). Subproblems read their input from here rather than from m_computed, in which
+  // the results of their siblings may already be written.
+  VectorType m_inputDiag, m_inputSubdiag;
+  Workspace m_workspace;
   int m_algoswap;
   bool m_compU, m_compV;
   int m_numIters;
@@ -116,14 +191,11 @@ void bdcsvd_impl<RealScalar_>::allocate(Index diagSize, bool compU, bool compV)
 
   if (m_compV) m_naiveV = MatrixXr::Zero(diagSize, diagSize);
 
-  // Vector updates need the three matrix-sized packing buffers used by
-  // structured_update(). Values-only decompositions only need five vectors:
-  // diag, shifts, mus, zhat, and diagShifted.
-  if (m_compU || m_compV)
-    m_workspace.resize((diagSize + 1) * (diagSize + 1) * 3);
-  else
-    m_workspace.resize(5 * diagSize);
-  m_workspaceI.resize(3 * diagSize);
+  m_inputDiag.resize(diagSize);
+  m_inputSubdiag.resize(diagSize);
+  m_workspace.allocate(diagSize, m_compU || m_compV, 1, m_algoswap);
+  m_workspace.numIters = 0;
+  m_workspace.info = Success;
 }
 
 // LAPACK's xBDSDC normalizes the bidiagonal by its largest entry and splits wherever a superdiagonal entry falls
@@ -153,16 +225,18 @@ void bdcsvd_impl<RealScalar_>::splitNegligibleSuperdiagonal(Index n) {
  * enough.
  */
 template <typename RealScalar_>
-void bdcsvd_impl<RealScalar_>::structured_update(Block<MatrixXr, Dynamic, Dynamic> A, const MatrixXr& B, Index n1) {
+template <typename ParallelFor>
+void bdcsvd_impl<RealScalar_>::structured_update(Workspace& ws, Block<MatrixXr, Dynamic, Dynamic> A, const MatrixXr& B,
+                                                 Index n1, const ParallelFor& parallelFor) {
   Index n = A.rows();
   if (n > 100) {
     // If the matrices are large enough, let's exploit the sparse structure of A by
     // splitting it in half (wrt n1), and packing the non-zero columns.
     Index n2 = n - n1;
-    Map<MatrixXr> A1(m_workspace.data(), n1, n);
-    Map<MatrixXr> A2(m_workspace.data() + n1 * n, n2, n);
-    Map<MatrixXr> B1(m_workspace.data() + n * n, n, n);
-    Map<MatrixXr> B2(m_workspace.data() + 2 * n * n, n, n);
+    Map<MatrixXr> A1(ws.real.data(), n1, n);
+    Map<MatrixXr> A2(ws.real.data() + n1 * n, n2, n);
+    Map<MatrixXr> B1(ws.real.data() + n * n, n, n);
+    Map<MatrixXr> B2(ws.real.data() + 2 * n * n, n, n);
     Index k1 = 0, k2 = 0;
     for (Index j = 0; j < n; ++j) {
       if ((A.col(j).head(n1).array() != Literal(0)).any()) {
@@ -177,10 +251,17 @@ void bdcsvd_impl<RealScalar_>::structured_update(Block<MatrixXr, Dynamic, Dynami
       }
     }
 
-    A.topRows(n1).noalias() = A1.leftCols(k1) * B1.topRows(k1);
-    A.bottomRows(n2).noalias() = A2.leftCols(k2) * B2.topRows(k2);
+    // The products only read the packed copies, so the columns of A can be written by independent slabs.
+    auto update = [&](Index begin, Index end) {
+      A.topRows(n1).middleCols(begin, end - begin).noalias() =
+          A1.leftCols(k1) * B1.topRows(k1).middleCols(begin, end - begin);
+      A.bottomRows(n2).middleCols(begin, end - begin).noalias() =
+          A2.leftCols(k2) * B2.topRows(k2).middleCols(begin, end - begin);
+    };
+    const float cost = 2.0f * static_cast<float>(n) * static_cast<float>(n1 * k1 + n2 * k2);
+    parallelFor(n, 32, cost, update);
   } else {
-    Map<MatrixXr, Aligned> tmp(m_workspace.data(), n, n);
+    Map<MatrixXr, Aligned> tmp(ws.real.data(), n, n);
     tmp.noalias() = A * B;
     A = tmp;
   }
@@ -188,24 +269,31 @@ void bdcsvd_impl<RealScalar_>::structured_update(Block<MatrixXr, Dynamic, Dynami
 
 template <typename RealScalar_>
 template <typename SVDType>
-void bdcsvd_impl<RealScalar_>::computeBaseCase(SVDType& svd, Index n, Index firstCol, Index firstRowW, Index firstColW,
-                                               Index shift) {
-  svd.compute(m_computed.block(firstCol, firstCol, n + 1, n));
-  m_info = svd.info();
-  if (m_info != Success && m_info != NoConvergence) return;
+void bdcsvd_impl<RealScalar_>::computeBaseCase(Workspace& ws, SVDType& svd, const Node& node) {
+  const Index n = node.lastCol - node.firstCol + 1;
+  const Index firstCol = node.firstCol, shift = node.shift;
+  // setSwitchSize() may have been called after allocate().
+  if (ws.base.rows() <= n) ws.base.resize(n + 1, n);
+  auto input = ws.base.topLeftCorner(n + 1, n);
+  input.setZero();
+  input.diagonal() = m_inputDiag.segment(firstCol, n);
+  input.template diagonal<-1>() = m_inputSubdiag.segment(firstCol, n);
+  svd.compute(input);
+  ws.info = svd.info();
+  if (ws.info != Success && ws.info != NoConvergence) return;
   if (m_compU)
     m_naiveU.block(firstCol, firstCol, n + 1, n + 1) = svd.matrixU();
   else {
     m_naiveU.row(0).segment(firstCol, n + 1) = svd.matrixU().row(0);
     m_naiveU.row(1).segment(firstCol, n + 1) = svd.matrixU().row(n);
   }
-  if (m_compV) m_naiveV.block(firstRowW, firstColW, n, n) = svd.matrixV();
+  if (m_compV) m_naiveV.block(node.firstRowW, node.firstColW, n, n) = svd.matrixV();
   m_computed.block(firstCol + shift, firstCol + shift, n + 1, n).setZero();
   m_computed.diagonal().segment(firstCol + shift, n) = svd.singularValues().head(n);
 }
 
 // The divide algorithm is done "in place", we are always working on subsets of the same matrix. The divide methods
-// takes as argument the place of the submatrix we are currently working on.
+// takes as argument (a Node) the place of the submatrix we are currently working on.
 
 //@param firstCol : The Index of the first column of the submatrix of m_computed and for m_naiveU;
 //@param lastCol : The Index of the last column of the submatrix of m_computed and for m_naiveU;
@@ -218,35 +306,136 @@ void bdcsvd_impl<RealScalar_>::computeBaseCase(SVDType& svd, Index n, Index firs
 // to become the first column (*coeff) and to shift all the other columns to the right. There are more details on the
 // reference paper.
 template <typename RealScalar_>
-void bdcsvd_impl<RealScalar_>::divide(Index firstCol, Index lastCol, Index firstRowW, Index firstColW, Index shift) {
+template <typename... Device>
+void bdcsvd_impl<RealScalar_>::divide(Index n, Device&... device) {
+  m_inputDiag.head(n) = m_computed.diagonal().head(n);
+  m_inputSubdiag.head(n) = m_computed.template diagonal<-1>().head(n);
+  divideRoot(n, device...);
+  m_info = m_workspace.info;
+  m_numIters = m_workspace.numIters;
+}
+
+template <typename RealScalar_>
+void bdcsvd_impl<RealScalar_>::divideRoot(Index n) {
+  divide(m_workspace, Node{0, n - 1, 0, 0, 0});
+}
+
+template <typename RealScalar_>
+void bdcsvd_impl<RealScalar_>::divide(Workspace& ws, const Node& node) {
   // requires rows = cols + 1;
-  const Index n = lastCol - firstCol + 1;
-  const Index k = n / 2;
-  const RealScalar considerZero = (std::numeric_limits<RealScalar>::min)();
-  RealScalar alphaK;
-  RealScalar betaK;
-  RealScalar r0;
-  RealScalar lambda, phi, c0, s0;
+  const Index n = node.lastCol - node.firstCol + 1;
   // We use the other algorithm which is more efficient for small
   // matrices.
   if (n < m_algoswap) {
     if (m_compV) {
-      computeBaseCase(m_baseSvdUV, n, firstCol, firstRowW, firstColW, shift);
+      computeBaseCase(ws, ws.svdUV, node);
     } else {
-      computeBaseCase(m_baseSvdU, n, firstCol, firstRowW, firstColW, shift);
+      computeBaseCase(ws, ws.svdU, node);
     }
     return;
   }
-  // We use the divide and conquer algorithm
-  alphaK = m_computed(firstCol + k, firstCol + k);
-  betaK = m_computed(firstCol + k + 1, firstCol + k);
-  // The divide must be done in that order in order to have good results. Divide change the data inside the submatrices
-  // and the divide of the right submatrice reads one column of the left submatrice. That's why we need to treat the
-  // right submatrix before the left one.
-  divide(k + 1 + firstCol, lastCol, k + 1 + firstRowW, k + 1 + firstColW, shift);
-  if (m_info != Success && m_info != NoConvergence) return;
-  divide(firstCol, k - 1 + firstCol, firstRowW, firstColW + 1, shift + 1);
-  if (m_info != Success && m_info != NoConvergence) return;
+  // We use the divide and conquer algorithm. The subproblems read their input from m_inputDiag and m_inputSubdiag,
+  // and write their results to disjoint parts of m_computed, m_naiveU and m_naiveV, so they can be processed in any
+  // order.
+  divide(ws, rightChild(node));
+  if (ws.info != Success && ws.info != NoConvergence) return;
+  divide(ws, leftChild(node));
+  if (ws.info != Success && ws.info != NoConvergence) return;
+  merge(ws, node, SequentialFor());
+}  // end divide
+
+// The subtrees rooted at depth cutDepth, and the leaves above them, are independent tasks shared among the threads of
+// the device. The merges above them are then processed level by level: a level with at least as many nodes as threads
+// is shared among the threads as well, while the merges of the upper levels, which are the largest, each split their
+// secular equations and matrix products across the threads.
+template <typename RealScalar_>
+template <typename Device>
+void bdcsvd_impl<RealScalar_>::divideRoot(Index n, Device& device) {
+  const Index threads = device.m_pool.NumThreads();
+  if (threads <= 1 || n < 16 * m_algoswap) {
+    divideRoot(n);
+    return;
+  }
+
+  int cutDepth = 0;
+  while ((Index(1) << cutDepth) < 4 * threads) ++cutDepth;
+  std::vector<std::vector<Node>> levels(cutDepth);
+  std::vector<Node> subtrees;
+  std::vector<std::pair<Node, int>> stack(1, std::make_pair(Node{0, n - 1, 0, 0, 0}, 0));
+  while (!stack.empty()) {
+    const Node node = stack.back().first;
+    const int depth = stack.back().second;
+    stack.pop_back();
+    if (depth == cutDepth || node.lastCol - node.firstCol + 1 < m_algoswap) {
+      subtrees.push_back(node);
+    } else {
+      levels[depth].push_back(node);
+      stack.emplace_back(leftChild(node), depth + 1);
+      stack.emplace_back(rightChild(node), depth + 1);
+    }
+  }
+
+  // Runs divide() (recurse == true) or merge() on each node of a list, with one workspace per chunk of nodes, and
+  // returns false if one of them failed.
+  const bool vectors = m_compU || m_compV;
+  std::vector<ComputationInfo> infos;
+  std::vector<int> iters;
+  const auto runNodes = [&](const std::vector<Node>& nodes, bool recurse) {
+    const Index count = static_cast<Index>(nodes.size());
+    infos.assign(nodes.size(), Success);
+    iters.assign(nodes.size(), 0);
+    auto task = [&](Index begin, Index end) {
+      Workspace ws;
+      for (Index i = begin; i < end; ++i) {
+        ws.allocate(nodes[i].lastCol - nodes[i].firstCol + 1, vectors, 1, m_algoswap);
+        ws.info = Success;
+        ws.numIters = 0;
+        if (recurse)
+          divide(ws, nodes[i]);
+        else
+          merge(ws, nodes[i], SequentialFor());
+        infos[i] = ws.info;
+        iters[i] = ws.numIters;
+      }
+    };
+    const float m = static_cast<float>(nodes.front().lastCol - nodes.front().firstCol + 1);
+    device.parallelForBlocks(count, 1, static_cast<float>(count) * m * m * m, task);
+    for (Index i = 0; i < count; ++i) {
+      combineInfo(m_workspace.info, infos[i]);
+      m_workspace.numIters += iters[i];
+    }
+    return m_workspace.info == Success || m_workspace.info == NoConvergence;
+  };
+
+  m_workspace.info = Success;
+  if (!runNodes(subtrees, true)) return;
+  m_workspace.allocate(n, vectors, threads, m_algoswap);
+  for (int depth = cutDepth - 1; depth >= 0; --depth) {
+    if (static_cast<Index>(levels[depth].size()) >= threads) {
+      if (!runNodes(levels[depth], false)) return;
+      continue;
+    }
+    for (const Node& node : levels[depth]) {
+      merge(m_workspace, node, DeviceFor<Device>{device});
+      if (m_workspace.info != Success && m_workspace.info != NoConvergence) return;
+    }
+  }
+}
+
+// Merges the solved subproblems of node: the combined problem is rotated into a broken arrow matrix, deflated, and
+// diagonalized by solving its secular equation.
+template <typename RealScalar_>
+template <typename ParallelFor>
+void bdcsvd_impl<RealScalar_>::merge(Workspace& ws, const Node& node, const ParallelFor& parallelFor) {
+  const Index firstCol = node.firstCol, lastCol = node.lastCol;
+  const Index firstRowW = node.firstRowW, firstColW = node.firstColW, shift = node.shift;
+  const Index n = lastCol - firstCol + 1;
+  const Index k = n / 2;
+  const RealScalar considerZero = (std::numeric_limits<RealScalar>::min)();
+  const RealScalar alphaK = m_inputDiag(firstCol + k);
+  const RealScalar betaK = m_inputSubdiag(firstCol + k);
+  RealScalar r0;
+  RealScalar lambda, phi, c0, s0;
 
   if (m_compU) {
     lambda = m_naiveU(firstCol + k, firstCol + k);
@@ -282,7 +471,7 @@ void bdcsvd_impl<RealScalar_>::divide(Index firstCol, Index lastCol, Index first
   }
 
   if (m_compU) {
-    Map<VectorType, Aligned> q1(m_workspace.data(), k + 1);
+    Map<VectorType, Aligned> q1(ws.real.data(), k + 1);
     q1 = m_naiveU.col(firstCol + k).segment(firstCol, k + 1);
     // we shift Q1 to the right
     for (Index i = firstCol + k - 1; i >= firstCol; i--)
@@ -313,40 +502,43 @@ void bdcsvd_impl<RealScalar_>::divide(Index firstCol, Index lastCol, Index first
   }
 
   // Second part: try to deflate singular values in combined matrix
-  deflation(firstCol, lastCol, k, firstRowW, firstColW, shift);
+  deflation(ws, firstCol, lastCol, k, firstRowW, firstColW, shift);
 
   // Third part: compute SVD of combined matrix
   MatrixXr UofSVD, VofSVD;
   VectorType singVals;
-  computeSVDofM(firstCol + shift, n, UofSVD, singVals, VofSVD);
+  computeSVDofM(ws, firstCol + shift, n, UofSVD, singVals, VofSVD, parallelFor);
 
   if (m_compU)
-    structured_update(m_naiveU.block(firstCol, firstCol, n + 1, n + 1), UofSVD, (n + 2) / 2);
+    structured_update(ws, m_naiveU.block(firstCol, firstCol, n + 1, n + 1), UofSVD, (n + 2) / 2, parallelFor);
   else {
-    Map<Matrix<RealScalar, 2, Dynamic>, Aligned> tmp(m_workspace.data(), 2, n + 1);
+    Map<Matrix<RealScalar, 2, Dynamic>, Aligned> tmp(ws.real.data(), 2, n + 1);
     tmp.noalias() = m_naiveU.middleCols(firstCol, n + 1) * UofSVD;
     m_naiveU.middleCols(firstCol, n + 1) = tmp;
   }
 
-  if (m_compV) structured_update(m_naiveV.block(firstRowW, firstColW, n, n), VofSVD, (n + 1) / 2);
+  if (m_compV)
+    structured_update(ws, m_naiveV.block(firstRowW, firstColW, n, n), VofSVD, (n + 1) / 2, parallelFor);
 
   // Recursive children leave this block diagonal; this merge only adds its
   // first column. Clear that column instead of rewriting the full n-by-n block.
   m_computed.col(firstCol + shift).segment(firstCol + shift, n).setZero();
   m_computed.diagonal().segment(firstCol + shift, n) = singVals;
-}  // end divide
+}  // end merge
 
 // Compute SVD of m_computed.block(firstCol, firstCol, n + 1, n); this block only has non-zeros in
 // the first column and on the diagonal and has undergone deflation, so diagonal is in increasing
 // order except for possibly the (0,0) entry. The computed SVD is stored U, singVals and V, except
 // that if m_compV is false, then V is not computed. Singular values are sorted in decreasing order.
 template <typename RealScalar_>
-void bdcsvd_impl<RealScalar_>::computeSVDofM(Index firstCol, Index n, MatrixXr& U, VectorType& singVals, MatrixXr& V) {
+template <typename ParallelFor>
+void bdcsvd_impl<RealScalar_>::computeSVDofM(Workspace& ws, Index firstCol, Index n, MatrixXr& U, VectorType& singVals,
+                                             MatrixXr& V, const ParallelFor& parallelFor) {
   const RealScalar considerZero = (std::numeric_limits<RealScalar>::min)();
   using std::abs;
   ArrayRef col0 = m_computed.col(firstCol).segment(firstCol, n);
-  m_workspace.head(n) = m_computed.block(firstCol, firstCol, n, n).diagonal();
-  ArrayRef diag = m_workspace.head(n);
+  ws.real.head(n) = m_computed.block(firstCol, firstCol, n, n).diagonal();
+  ArrayRef diag = ws.real.head(n);
   diag(0) = Literal(0);
 
   // Allocate space for singular values and vectors
@@ -364,20 +556,46 @@ void bdcsvd_impl<RealScalar_>::computeSVDofM(Index firstCol, Index n, MatrixXr&
   }
   Index m = 0;  // size of the deflated problem
   for (Index k = 0; k < actual_n; ++k)
-    if (abs(col0(k)) > considerZero) m_workspaceI(m++) = k;
-  Map<ArrayXi> perm(m_workspaceI.data(), m);
+    if (abs(col0(k)) > considerZero) ws.index(m++) = k;
+  Map<ArrayXi> perm(ws.index.data(), m);
+
+  Map<ArrayXr> shifts(ws.real.data() + 1 * n, n);
+  Map<ArrayXr> mus(ws.real.data() + 2 * n, n);
+  Map<ArrayXr> zhat(ws.real.data() + 3 * n, n);
 
-  Map<ArrayXr> shifts(m_workspace.data() + 1 * n, n);
-  Map<ArrayXr> mus(m_workspace.data() + 2 * n, n);
-  Map<ArrayXr> zhat(m_workspace.data() + 3 * n, n);
+  // The singular values are independent of each other, and so are the entries of zhat and the singular vectors once
+  // all singular values are known. Each of these loops is cut into chunks, which have their own diagShifted buffer
+  // and their own counters in the index workspace after perm.
+  const Index chunks = numext::mini(parallelFor.concurrency(), n);
+  const auto chunkBegin = [&](Index c) { return c * n / chunks; };
+  Index* chunkCounts = ws.index.data() + n;
+  const float work = static_cast<float>(n) * static_cast<float>(m);
 
   // Compute singVals, shifts, and mus
-  computeSingVals(col0, diag, perm, singVals, shifts, mus);
+  auto singValsTask = [&](Index begin, Index end) {
+    for (Index c = begin; c < end; ++c) {
+      chunkCounts[c] = 0;
+      computeSingVals(col0, diag, perm, singVals, shifts, mus, chunkBegin(c), chunkBegin(c + 1),
+                      ws.real.segment((4 + c) * n, n), chunkCounts[c]);
+    }
+  };
+  parallelFor(chunks, 1, 50.0f * work, singValsTask);
+  for (Index c = 0; c < chunks; ++c) ws.numIters += static_cast<int>(chunkCounts[c]);
 
   // Compute zhat
-  perturbCol0(col0, diag, perm, singVals, shifts, mus, zhat);
-
-  computeSingVecs(zhat, diag, perm, singVals, shifts, mus, U, V);
+  auto zhatTask = [&](Index begin, Index end) {
+    for (Index c = begin; c < end; ++c)
+      chunkCounts[c] = perturbCol0(col0, diag, perm, singVals, shifts, mus, zhat, chunkBegin(c), chunkBegin(c + 1));
+  };
+  parallelFor(chunks, 1, 10.0f * work, zhatTask);
+  for (Index c = 0; c < chunks; ++c)
+    if (!chunkCounts[c]) ws.info = NumericalIssue;
+
+  auto singVecsTask = [&](Index begin, Index end) {
+    computeSingVecs(zhat, diag, perm, singVals, shifts, mus, U, V, chunkBegin(begin), chunkBegin(end));
+  };
+  parallelFor(chunks, 1, 10.0f * work, singVecsTask);
+  U.col(n) = VectorType::Unit(n + 1, n);
 
   // Because of deflation, the singular values might not be completely sorted.
   // Fortunately, reordering them is a O(n) problem
@@ -416,7 +634,8 @@ typename bdcsvd_impl<RealScalar_>::RealScalar bdcsvd_impl<RealScalar_>::secularE
 
 template <typename RealScalar_>
 void bdcsvd_impl<RealScalar_>::computeSingVals(const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm,
-                                               VectorType& singVals, ArrayRef shifts, ArrayRef mus) {
+                                               VectorType& singVals, ArrayRef shifts, ArrayRef mus, Index kBegin,
+                                               Index kEnd, ArrayRef diagShifted, Index& numIters) const {
   // See Ren-Cang Li, "Solving Secular Equations Stably and Efficiently",
   // LAPACK Working Note 89 (1994), and LAPACK's xLASD4/xLASD5 for the
   // stability rationale behind pole-relative shifts and safeguarded steps.
@@ -429,7 +648,7 @@ void bdcsvd_impl<RealScalar_>::computeSingVals(const ArrayRef& col0, const Array
   // because 1) we have diag(i)==0 => col0(i)==0 and 2) if col0(i)==0, then diag(i) is already a singular value.
   while (actual_n > 1 && numext::is_exactly_zero(col0(actual_n - 1))) --actual_n;
 
-  for (Index k = 0; k < n; ++k) {
+  for (Index k = kBegin; k < kEnd; ++k) {
     if (numext::is_exactly_zero(col0(k)) || actual_n == 1) {
       // if col0(k) == 0, then entry is deflated, so singular value is on diagonal
       // if actual_n==1, then the deflated problem is already diagonalized
@@ -462,7 +681,6 @@ void bdcsvd_impl<RealScalar_>::computeSingVals(const ArrayRef& col0, const Array
     RealScalar shift = (k == actual_n - 1 || fMid > Literal(0)) ? left : right;
 
     // measure everything relative to shift
-    Map<ArrayXr> diagShifted(m_workspace.data() + 4 * n, n);
     diagShifted = diag - shift;
 
     if (k != actual_n - 1) {
@@ -506,7 +724,7 @@ void bdcsvd_impl<RealScalar_>::computeSingVals(const ArrayRef& col0, const Array
            abs(muCur - muPrev) >
                Literal(8) * NumTraits<RealScalar>::epsilon() * numext::maxi<RealScalar>(abs(muCur), abs(muPrev)) &&
            abs(fCur - fPrev) > NumTraits<RealScalar>::epsilon() && !useBisection) {
-      ++m_numIters;
+      ++numIters;
 
       // Find a and b such that the function f(mu) = a / mu + b matches the current and previous samples.
       RealScalar a = (fCur - fPrev) / (Literal(1) / muCur - Literal(1) / muPrev);
@@ -587,21 +805,22 @@ void bdcsvd_impl<RealScalar_>::computeSingVals(const ArrayRef& col0, const Array
   }
 }
 
-// zhat is perturbation of col0 for which singular vectors can be computed stably (see Section 3.1)
+// zhat is perturbation of col0 for which singular vectors can be computed stably (see Section 3.1).
+// Computes the entries [kBegin, kEnd) of zhat, and returns false on a numerical issue.
 template <typename RealScalar_>
-void bdcsvd_impl<RealScalar_>::perturbCol0(const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm,
+bool bdcsvd_impl<RealScalar_>::perturbCol0(const ArrayRef& col0, const ArrayRef& diag, const IndicesRef& perm,
                                            const VectorType& singVals, const ArrayRef& shifts, const ArrayRef& mus,
-                                           ArrayRef zhat) {
+                                           ArrayRef zhat, Index kBegin, Index kEnd) const {
   using std::abs;
-  Index n = col0.size();
   Index m = perm.size();
   if (m == 0) {
-    zhat.setZero();
-    return;
+    zhat.segment(kBegin, kEnd - kBegin).setZero();
+    return true;
   }
+  bool ok = true;
   Index lastIdx = perm(m - 1);
   // The offset permits to skip deflated entries while computing zhat
-  for (Index k = 0; k < n; ++k) {
+  for (Index k = kBegin; k < kEnd; ++k) {
     if (numext::is_exactly_zero(col0(k)))  // deflated
       zhat(k) = Literal(0);
     else {
@@ -620,7 +839,7 @@ void bdcsvd_impl<RealScalar_>::perturbCol0(const ArrayRef& col0, const ArrayRef&
           // There is no valid predecessor when the first active index is already on the
           // right of k. Treat this as a numerical issue and zero the product.
           if (i >= k && l == 0) {
-            m_info = NumericalIssue;
+            ok = false;
             prod = Literal(0);
             break;
           }
@@ -636,17 +855,18 @@ void bdcsvd_impl<RealScalar_>::perturbCol0(const ArrayRef& col0, const ArrayRef&
       zhat(k) = col0(k) > Literal(0) ? RealScalar(tmp) : RealScalar(-tmp);
     }
   }
+  return ok;
 }
 
-// compute singular vectors
+// compute the singular vectors [kBegin, kEnd); the last column of U is set by the caller
 template <typename RealScalar_>
 void bdcsvd_impl<RealScalar_>::computeSingVecs(const ArrayRef& zhat, const ArrayRef& diag, const IndicesRef& perm,
                                                const VectorType& singVals, const ArrayRef& shifts, const ArrayRef& mus,
-                                               MatrixXr& U, MatrixXr& V) {
+                                               MatrixXr& U, MatrixXr& V, Index kBegin, Index kEnd) const {
   Index n = zhat.size();
   Index m = perm.size();
 
-  for (Index k = 0; k < n; ++k) {
+  for (Index k = kBegin; k < kEnd; ++k) {
     if (numext::is_exactly_zero(zhat(k))) {
       U.col(k) = VectorType::Unit(n + 1, k);
       if (m_compV) V.col(k) = VectorType::Unit(n, k);
@@ -675,7 +895,6 @@ void bdcsvd_impl<RealScalar_>::computeSingVecs(const ArrayRef& zhat, const Array
       }
     }
   }
-  U.col(n) = VectorType::Unit(n + 1, n);
 }
 
 // page 12_13
@@ -731,8 +950,8 @@ void bdcsvd_impl<RealScalar_>::deflation44(Index firstColu, Index firstColm, Ind
 
 // acts on block from (firstCol+shift, firstCol+shift) to (lastCol+shift, lastCol+shift) [inclusive]
 template <typename RealScalar_>
-void bdcsvd_impl<RealScalar_>::deflation(Index firstCol, Index lastCol, Index k, Index firstRowW, Index firstColW,
-                                         Index shift) {
+void bdcsvd_impl<RealScalar_>::deflation(Workspace& ws, Index firstCol, Index lastCol, Index k, Index firstRowW,
+                                         Index firstColW, Index shift) {
   using std::abs;
   const Index length = lastCol + 1 - firstCol;
 
@@ -770,7 +989,7 @@ void bdcsvd_impl<RealScalar_>::deflation(Index firstCol, Index lastCol, Index k,
 
     // Sort the diagonal entries, since diag(1:k-1) and diag(k:length) are already sorted, let's do a sorted merge.
     // First, compute the respective permutation.
-    Index* permutation = m_workspaceI.data();
+    Index* permutation = ws.index.data();
     {
       permutation[0] = 0;
       Index p = 1;
@@ -806,8 +1025,8 @@ void bdcsvd_impl<RealScalar_>::deflation(Index firstCol, Index lastCol, Index k,
     }
 
     // Current index of each col, and current column of each index
-    Index* realInd = m_workspaceI.data() + length;
-    Index* realCol = m_workspaceI.data() + 2 * length;
+    Index* realInd = ws.index.data() + length;
+    Index* realCol = ws.index.data() + 2 * length;
 
     for (int pos = 0; pos < length; pos++) {
       realCol[pos] = pos;
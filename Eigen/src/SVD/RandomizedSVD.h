@@ -0,0 +1,244 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_RANDOMIZEDSVD_H
+#define EIGEN_RANDOMIZEDSVD_H
+
+#include <random>
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+template <typename MatrixType_, int Options>
+struct traits<RandomizedSVD<MatrixType_, Options> > : svd_traits<MatrixType_, Options> {
+  using MatrixType = MatrixType_;
+};
+
+}  // end namespace internal
+
+/** \ingroup SVD_Module
+ *
+ *
+ * \class RandomizedSVD
+ *
+ * \brief Truncated SVD computed by a randomized range finder
+ *
+ * \tparam MatrixType_ the type of the matrix of which we are computing the SVD decomposition
+ *
+ * \tparam Options_ this optional parameter allows one to specify options for computing unitaries \a U and \a V.
+ *                  Possible values are #ComputeThinU and #ComputeThinV. By default, unitaries are not computed.
+ *
+ * This class computes the \a k largest singular values of a n-by-p matrix \a A, and optionally the corresponding
+ * singular vectors, using the randomized algorithm of Halko, Martinsson and Tropp, "Finding structure with randomness:
+ * Probabilistic algorithms for constructing approximate matrix decompositions", SIAM Review 53(2), 2011:
+ *  -# the range of \a A is sampled by the product \f$ Y = A \Omega \f$ with a p-by-l Gaussian matrix \f$ \Omega \f$,
+ *     where l = k + oversampling();
+ *  -# powerIterations() steps of subspace iteration \f$ Y \leftarrow A A^* Y \f$ sharpen the decay of the spectrum,
+ *     each product being orthonormalized by a HouseholderQR;
+ *  -# with \a Q an orthonormal basis of the range of \a Y, the l-by-p matrix \f$ B = Q^* A \f$ is decomposed by
+ *     BDCSVD, and \f$ U = Q U_B \f$.
+ *
+ * All the work on \a A is done by matrix products, so for \a k much smaller than min(n,p) this is much faster than
+ * BDCSVD or JacobiSVD. The result is an approximation: its accuracy depends on the decay of the singular values past
+ * the \a k-th one, and improves quickly with the number of power iterations. singularValues() has size \a k, and
+ * matrixU() and matrixV() have \a k columns. solve() returns the least-squares solution of the rank-\a k
+ * approximation. The default threshold of rank() and solve() scales with \a k rather than with min(n,p), so when
+ * \a A may have rank less than \a k, prescribe one with setThreshold().
+ *
+ * \code
+ * Eigen::RandomizedSVD<Eigen::MatrixXd, Eigen::ComputeThinU | Eigen::ComputeThinV> svd(A, 50);
+ * Eigen::MatrixXd scores = svd.matrixU() * svd.singularValues().asDiagonal();
+ * \endcode
+ *
+ * The random matrix \f$ \Omega \f$ is drawn from a fresh seed on each call to compute(), unless setSeed() is called.
+ *
+ * \sa class BDCSVD, class JacobiSVD
+ */
+template <typename MatrixType_, int Options_>
+class RandomizedSVD : public SVDBase<RandomizedSVD<MatrixType_, Options_> > {
+  using Base = SVDBase<RandomizedSVD>;
+
+ public:
+  using Base::cols;
+  using Base::computeU;
+  using Base::computeV;
+  using Base::rows;
+
+  using MatrixType = MatrixType_;
+  using Scalar = typename Base::Scalar;
+  using RealScalar = typename Base::RealScalar;
+  using Index = typename Base::Index;
+  enum {
+    Options = Options_,
+    ComputationOptions = internal::get_computation_options(Options),
+    RowsAtCompileTime = Base::RowsAtCompileTime,
+    ColsAtCompileTime = Base::ColsAtCompileTime,
+    DiagSizeAtCompileTime = Base::DiagSizeAtCompileTime
+  };
+
+  using MatrixUType = typename Base::MatrixUType;
+  using MatrixVType = typename Base::MatrixVType;
+  using SingularValuesType = typename Base::SingularValuesType;
+
+  using MatrixX = Matrix<Scalar, Dynamic, Dynamic, ColMajor>;
+
+  EIGEN_STATIC_ASSERT(!Base::ShouldComputeFullU && !Base::ShouldComputeFullV,
+                      "RandomizedSVD: only thin unitaries U and V can be computed")
+  EIGEN_STATIC_ASSERT(DiagSizeAtCompileTime == Dynamic, "RandomizedSVD: the matrix must have a dynamic size")
+
+  /** \brief Default Constructor.
+   *
+   * The target rank must be set by setTargetRank() before calling compute().
+   */
+  RandomizedSVD() : m_targetRank(0) {}
+
+  /** \brief Constructor setting the number \a targetRank of singular values to compute. */
+  explicit RandomizedSVD(Index targetRank) : m_targetRank(targetRank) {}
+
+  /** \brief Constructor computing the \a targetRank largest singular values of \a matrix, and the corresponding
+   * singular vectors requested by the \a Options template parameter.
+   */
+  template <typename Derived>
+  RandomizedSVD(const MatrixBase<Derived>& matrix, Index targetRank) : m_targetRank(targetRank) {
+    compute(matrix);
+  }
+
+  /** \brief Method computing the truncated SVD of \a matrix.
+   *
+   * \param matrix the matrix to decompose
+   */
+  template <typename Derived>
+  RandomizedSVD& compute(const MatrixBase<Derived>& matrix);
+
+  /** Sets the number of singular values to compute. It is clamped to the size of the matrix. */
+  RandomizedSVD& setTargetRank(Index targetRank) {
+    eigen_assert(targetRank > 0);
+    m_targetRank = targetRank;
+    return *this;
+  }
+  /** \returns the number of singular values to compute */
+  Index targetRank() const { return m_targetRank; }
+
+  /** Sets the number of extra samples of the range of the matrix, 10 by default. */
+  RandomizedSVD& setOversampling(Index oversampling) {
+    eigen_assert(oversampling >= 0);
+    m_oversampling = oversampling;
+    return *this;
+  }
+  /** \returns the number of extra samples of the range of the matrix */
+  Index oversampling() const { return m_oversampling; }
+
+  /** Sets the number of power (subspace) iterations, 2 by default. Each one costs two more products with the matrix.
+   */
+  RandomizedSVD& setPowerIterations(Index iterations) {
+    eigen_assert(iterations >= 0);
+    m_powerIterations = iterations;
+    return *this;
+  }
+  /** \returns the number of power iterations */
+  Index powerIterations() const { return m_powerIterations; }
+
+  /** \brief Fixes the seed of the internal RNG for reproducible decompositions.
+   *
+   * If never called, each call to compute() draws a fresh seed from
+   * \c std::random_device.
+   */
+  RandomizedSVD& setSeed(uint64_t seed) {
+    m_seed = seed;
+    m_seedSet = true;
+    return *this;
+  }
+
+ private:
+  // Replaces X by the first columns of the Q factor of its QR decomposition.
+  void orthonormalize(MatrixX& X) {
+    m_qr.compute(X);
+    X.setIdentity();
+    X.applyOnTheLeft(m_qr.householderQ());
+  }
+
+  Index m_targetRank;
+  Index m_oversampling = 10;
+  Index m_powerIterations = 2;
+  uint64_t m_seed = 0;
+  bool m_seedSet = false;
+  HouseholderQR<MatrixX> m_qr;
+  MatrixX m_range, m_coRange;
+
+ protected:
+  using Base::m_diagSize;
+  using Base::m_info;
+  using Base::m_isInitialized;
+  using Base::m_matrixU;
+  using Base::m_matrixV;
+  using Base::m_nonzeroSingularValues;
+  using Base::m_singularValues;
+};
+
+template <typename MatrixType, int Options>
+template <typename Derived>
+RandomizedSVD<MatrixType, Options>& RandomizedSVD<MatrixType, Options>::compute(const MatrixBase<Derived>& matrix) {
+  EIGEN_STATIC_ASSERT((std::is_same<typename Derived::Scalar, Scalar>::value),
+                      Input matrix must have the same Scalar type as the RandomizedSVD object.);
+  eigen_assert(m_targetRank > 0 && "RandomizedSVD: the target rank must be set before calling compute().");
+
+  // The matrix is read by several products, so expressions are evaluated once.
+  typename internal::nested_eval<Derived, Dynamic>::type a(matrix.derived());
+  const Index diagSize = numext::mini(a.rows(), a.cols());
+  const Index k = numext::mini(m_targetRank, diagSize);
+  const Index l = numext::mini(k + m_oversampling, diagSize);
+
+  Base::allocate(a.rows(), a.cols(), ComputationOptions);
+  m_diagSize.setValue(k);
+
+  // Sample the range of the matrix.
+  {
+    MatrixX omega(a.cols(), l);
+    uint64_t seed = m_seed;
+    if (!m_seedSet) {
+      std::random_device rd;
+      seed = (uint64_t(rd()) << 32) | uint64_t(rd());
+    }
+    std::mt19937_64 engine(seed);
+    internal::fill_gaussian(omega, engine);
+    m_range.resize(a.rows(), l);
+    m_range.noalias() = a * omega;
+  }
+  orthonormalize(m_range);
+
+  for (Index i = 0; i < m_powerIterations; ++i) {
+    m_coRange.resize(a.cols(), l);
+    m_coRange.noalias() = a.adjoint() * m_range;
+    orthonormalize(m_coRange);
+    m_range.noalias() = a * m_coRange;
+    orthonormalize(m_range);
+  }
+
+  // Decompose the projection B = Q^* A of the matrix on the sampled range.
+  m_coRange.resize(l, a.cols());
+  m_coRange.noalias() = m_range.adjoint() * a;
+  BDCSVD<MatrixX, ComputeThinU | ComputeThinV> svd(m_coRange);
+  m_info = svd.info();
+  m_isInitialized = true;
+  if (m_info != Success && m_info != NoConvergence) return *this;
+
+  m_singularValues = svd.singularValues().head(k);
+  m_nonzeroSingularValues = numext::mini(svd.nonzeroSingularValues(), k);
+  if (computeU()) m_matrixU.noalias() = m_range * svd.matrixU().leftCols(k);
+  if (computeV()) m_matrixV = svd.matrixV().leftCols(k);
+  return *this;
+}
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_RANDOMIZEDSVD_H
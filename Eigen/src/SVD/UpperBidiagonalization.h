@@ -65,6 +65,9 @@ class UpperBidiagonalization {
       : m_householder(rows, cols), m_bidiagonal(cols, cols), m_isInitialized(false) {}
 
   UpperBidiagonalization& compute(const MatrixType& matrix);
+  // Same as compute(const MatrixType&), with the matrix products of the blocked reduction split across the threads of
+  // device.
+  UpperBidiagonalization& compute(const MatrixType& matrix, CoreThreadPoolDevice& device);
   UpperBidiagonalization& computeUnblocked(const MatrixType& matrix);
 
   const MatrixType& householder() const { return m_householder; }
@@ -127,6 +130,17 @@ void upperbidiagonalization_inplace_unblocked(MatrixType& mat, typename MatrixTy
   }
 }
 
+// Destination of the large products of the blocked reduction: the expression itself, or the expression assigned on the
+// threads of a device.
+template <typename Xpr>
+Xpr& upperbidiagonalization_dst(Xpr& xpr) {
+  return xpr;
+}
+template <typename Xpr, typename Device>
+DeviceWrapper<Xpr, Device> upperbidiagonalization_dst(Xpr& xpr, Device& device) {
+  return xpr.device(device);
+}
+
 /** \internal
  * Helper routine for the block reduction to upper bidiagonal form.
  *
@@ -143,12 +157,15 @@ void upperbidiagonalization_inplace_unblocked(MatrixType& mat, typename MatrixTy
  * where V and U contains the left and right Householder vectors. U and V are stored in A10, and A01
  * respectively, and the update matrices X and Y are computed during the reduction.
  *
+ * If a \a device is given, the two matrix-vector products with the trailing matrix of each step, which account for
+ * about half of the flops, and the final update of A22 are split across its threads.
  */
-template <typename MatrixType>
+template <typename MatrixType, typename... Device>
 void upperbidiagonalization_blocked_helper(
     MatrixType& A, typename MatrixType::RealScalar* diagonal, typename MatrixType::RealScalar* upper_diagonal, Index bs,
     Ref<Matrix<typename MatrixType::Scalar, Dynamic, Dynamic, traits<MatrixType>::Flags & RowMajorBit> > X,
-    Ref<Matrix<typename MatrixType::Scalar, Dynamic, Dynamic, traits<MatrixType>::Flags & RowMajorBit> > Y) {
+    Ref<Matrix<typename MatrixType::Scalar, Dynamic, Dynamic, traits<MatrixType>::Flags & RowMajorBit> > Y,
+    Device&... device) {
   using Scalar = typename MatrixType::Scalar;
   using RealScalar = typename MatrixType::RealScalar;
   using Literal = typename NumTraits<RealScalar>::Literal;
@@ -195,7 +212,8 @@ void upperbidiagonalization_blocked_helper(
 
         // let's use the beginning of column k of Y as a temporary vector
         SubColumnType tmp(Y.col(k).head(k));
-        y_k.noalias() = A.block(k, k + 1, remainingRows, remainingCols).adjoint() * v_k;  // bottleneck
+        upperbidiagonalization_dst(y_k, device...).noalias() =
+            A.block(k, k + 1, remainingRows, remainingCols).adjoint() * v_k;  // bottleneck
         tmp.noalias() = V_k1.adjoint() * v_k;
         y_k.noalias() -= Y_k.leftCols(k) * tmp;
         tmp.noalias() = X_k1.adjoint() * v_k;
@@ -226,7 +244,8 @@ void upperbidiagonalization_blocked_helper(
         // note that tmp0 and tmp1 overlaps
         SubColumnType tmp0(X.col(k).head(k)), tmp1(X.col(k).head(k + 1));
 
-        x_k.noalias() = A.block(k + 1, k + 1, remainingRows - 1, remainingCols) * u_k.transpose();  // bottleneck
+        upperbidiagonalization_dst(x_k, device...).noalias() =
+            A.block(k + 1, k + 1, remainingRows - 1, remainingCols) * u_k.transpose();  // bottleneck
         tmp0.noalias() = U_k1 * u_k.transpose();
         x_k.noalias() -= X_k1.bottomRows(remainingRows - 1) * tmp0;
         tmp1.noalias() = Y_k.adjoint() * u_k.transpose();
@@ -253,8 +272,9 @@ void upperbidiagonalization_blocked_helper(
     SubMatType A01(A.block(0, bs, bs, bcols - bs));
     Scalar tmp = A01(bs - 1, 0);
     A01(bs - 1, 0) = Literal(1);
-    A11.noalias() -= A10 * Y.topLeftCorner(bcols, bs).bottomRows(bcols - bs).adjoint();
-    A11.noalias() -= X.topLeftCorner(brows, bs).bottomRows(brows - bs) * A01;
+    upperbidiagonalization_dst(A11, device...).noalias() -=
+        A10 * Y.topLeftCorner(bcols, bs).bottomRows(bcols - bs).adjoint();
+    upperbidiagonalization_dst(A11, device...).noalias() -= X.topLeftCorner(brows, bs).bottomRows(brows - bs) * A01;
     A01(bs - 1, 0) = tmp;
   }
 }
@@ -266,9 +286,9 @@ void upperbidiagonalization_blocked_helper(
  *   The Design of a Parallel Dense Linear Algebra Software Library: Reduction to Hessenberg, Tridiagonal, and
  * Bidiagonal Form. by Jaeyoung Choi, Jack J. Dongarra, David W. Walker. (1995) section 3.3
  */
-template <typename MatrixType, typename BidiagType>
-void upperbidiagonalization_inplace_blocked(MatrixType& A, BidiagType& bidiagonal, Index maxBlockSize = 16,
-                                            typename MatrixType::Scalar* /*tempData*/ = 0) {
+template <typename MatrixType, typename BidiagType, typename... Device>
+void upperbidiagonalization_inplace_blocked_impl(MatrixType& A, BidiagType& bidiagonal, Index maxBlockSize,
+                                                 Device&... device) {
   using Scalar = typename MatrixType::Scalar;
   using BlockType = Block<MatrixType, Dynamic, Dynamic>;
 
@@ -323,11 +343,27 @@ void upperbidiagonalization_inplace_blocked(MatrixType& A, BidiagType& bidiagona
     } else {
       upperbidiagonalization_blocked_helper<BlockType>(B, &(bidiagonal.template diagonal<0>().coeffRef(k)),
                                                        upper_diagonal_ptr, bs, X.topLeftCorner(brows, bs),
-                                                       Y.topLeftCorner(bcols, bs));
+                                                       Y.topLeftCorner(bcols, bs), device...);
     }
   }
 }
 
+template <typename MatrixType, typename BidiagType>
+void upperbidiagonalization_inplace_blocked(MatrixType& A, BidiagType& bidiagonal, Index maxBlockSize = 16,
+                                            typename MatrixType::Scalar* /*tempData*/ = 0) {
+  upperbidiagonalization_inplace_blocked_impl(A, bidiagonal, maxBlockSize);
+}
+
+/** \internal
+ * Same as upperbidiagonalization_inplace_blocked(MatrixType&, BidiagType&, Index, Scalar*), with the matrix-vector
+ * products of the panels and the updates of the trailing matrix split across the threads of \a device.
+ */
+template <typename MatrixType, typename BidiagType>
+void upperbidiagonalization_inplace_blocked(MatrixType& A, BidiagType& bidiagonal, CoreThreadPoolDevice& device,
+                                            Index maxBlockSize = 16) {
+  upperbidiagonalization_inplace_blocked_impl(A, bidiagonal, maxBlockSize, device);
+}
+
 template <typename MatrixType_>
 UpperBidiagonalization<MatrixType_>& UpperBidiagonalization<MatrixType_>::computeUnblocked(const MatrixType_& matrix) {
   Index rows = matrix.rows();
@@ -363,6 +399,19 @@ UpperBidiagonalization<MatrixType_>& UpperBidiagonalization<MatrixType_>::comput
   return *this;
 }
 
+template <typename MatrixType_>
+UpperBidiagonalization<MatrixType_>& UpperBidiagonalization<MatrixType_>::compute(const MatrixType_& matrix,
+                                                                                  CoreThreadPoolDevice& device) {
+  eigen_assert(matrix.rows() >= matrix.cols() &&
+               "UpperBidiagonalization is only for matrices satisfying rows>=cols.");
+
+  m_householder = matrix;
+  upperbidiagonalization_inplace_blocked(m_householder, m_bidiagonal, device);
+
+  m_isInitialized = true;
+  return *this;
+}
+
 }  // end namespace internal
 
 }  // end namespace Eigen
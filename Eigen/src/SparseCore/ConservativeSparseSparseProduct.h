@@ -18,6 +18,97 @@ namespace Eigen {
 
 namespace internal {
 
+// Computes res = lhs * rhs with the outer vectors of res shared among threads. A symbolic pass counts the nonzeros of
+// each outer vector of res, which gives its outer index array, then a numeric pass computes each outer vector with a
+// dense accumulator, directly at its final position in the compressed arrays of res and sorted by inner index.
+// In both passes, the threads take chunks of consecutive outer vectors from an atomic counter, which balances
+// irregular sparsity patterns. parallel_run(threads, f) must call f(t) for t = 0, ..., threads-1, concurrently.
+// res must already be resized to rows x cols, which leaves it compressed and empty.
+template <typename LhsEval, typename RhsEval, typename ResultType, typename ParallelRun>
+void parallel_conservative_sparse_sparse_product_impl(const LhsEval& lhsEval, const RhsEval& rhsEval, Index rows,
+                                                      Index cols, ResultType& res, int threads,
+                                                      const ParallelRun& parallel_run) {
+  using ResScalar = typename ResultType::Scalar;
+  using StorageIndex = typename ResultType::StorageIndex;
+  eigen_assert(res.innerSize() == rows && res.outerSize() == cols);
+
+  // Several chunks per thread, so that the threads which get cheap outer vectors take more of them.
+  const Index chunkSize = numext::maxi<Index>(1, cols / (Index(threads) * 16));
+  const Index numChunks = (cols + chunkSize - 1) / chunkSize;
+  std::atomic<Index> nextChunk(0);
+
+  // resize() left res compressed with a zero outer index array, whose other entries are all written below.
+  eigen_assert(res.isCompressed() && res.nonZeros() == 0);
+  StorageIndex* outer = res.outerIndexPtr();
+
+  // Symbolic pass: marker[i] == j iff the row i already appears in the column j.
+  auto count = [&](int) {
+    std::vector<Index> marker(rows, Index(-1));
+    for (Index c = nextChunk++; c < numChunks; c = nextChunk++) {
+      for (Index j = c * chunkSize; j < numext::mini(cols, (c + 1) * chunkSize); ++j) {
+        Index nnz = 0;
+        for (typename RhsEval::InnerIterator rhsIt(rhsEval, j); rhsIt; ++rhsIt) {
+          for (typename LhsEval::InnerIterator lhsIt(lhsEval, rhsIt.index()); lhsIt; ++lhsIt) {
+            const Index i = lhsIt.index();
+            if (marker[i] != j) {
+              marker[i] = j;
+              ++nnz;
+            }
+          }
+        }
+        outer[j + 1] = StorageIndex(nnz);
+      }
+    }
+  };
+  parallel_run(threads, count);
+
+  Index nnz = 0;
+  for (Index j = 0; j < cols; ++j) {
+    nnz += outer[j + 1];
+    eigen_assert(nnz <= Index(NumTraits<StorageIndex>::highest()) && "the product overflows the StorageIndex");
+    outer[j + 1] = StorageIndex(nnz);
+  }
+  res.resizeNonZeros(nnz);
+  StorageIndex* innerIndices = res.innerIndexPtr();
+  ResScalar* values = res.valuePtr();
+
+  // Numeric pass.
+  nextChunk = 0;
+  auto fill = [&](int) {
+    std::vector<Index> marker(rows, Index(-1));
+    std::vector<ResScalar> accumulator(rows);
+    for (Index c = nextChunk++; c < numChunks; c = nextChunk++) {
+      for (Index j = c * chunkSize; j < numext::mini(cols, (c + 1) * chunkSize); ++j) {
+        StorageIndex* inner = innerIndices + outer[j];
+        Index k = 0;
+        for (typename RhsEval::InnerIterator rhsIt(rhsEval, j); rhsIt; ++rhsIt) {
+          const auto y = rhsIt.value();
+          for (typename LhsEval::InnerIterator lhsIt(lhsEval, rhsIt.index()); lhsIt; ++lhsIt) {
+            const Index i = lhsIt.index();
+            if (marker[i] != j) {
+              marker[i] = j;
+              accumulator[i] = lhsIt.value() * y;
+              inner[k++] = StorageIndex(i);
+            } else {
+              accumulator[i] += lhsIt.value() * y;
+            }
+          }
+        }
+        // As in the serial product, sort a sparse column but scan the marker of a dense one.
+        if (k * numext::log2(int(k) + 1) < rows) {
+          std::sort(inner, inner + k);
+        } else {
+          k = 0;
+          for (Index i = 0; i < rows; ++i)
+            if (marker[i] == j) inner[k++] = StorageIndex(i);
+        }
+        for (Index p = 0; p < k; ++p) values[outer[j] + p] = accumulator[inner[p]];
+      }
+    }
+  };
+  parallel_run(threads, fill);
+}
+
 template <typename Lhs, typename Rhs, typename ResultType>
 static void conservative_sparse_sparse_product_impl(const Lhs& lhs, const Rhs& rhs, ResultType& res,
                                                     bool sortedInsertion = false) {
@@ -30,12 +121,6 @@ static void conservative_sparse_sparse_product_impl(const Lhs& lhs, const Rhs& r
   Index cols = rhs.outerSize();
   eigen_assert(lhs.outerSize() == rhs.innerSize());
 
-  ei_declare_aligned_stack_constructed_variable(bool, mask, rows, 0);
-  ei_declare_aligned_stack_constructed_variable(ResScalar, values, rows, 0);
-  ei_declare_aligned_stack_constructed_variable(Index, indices, rows, 0);
-
-  std::fill_n(mask, rows, false);
-
   evaluator<Lhs> lhsEval(lhs);
   evaluator<Rhs> rhsEval(rhs);
 
@@ -47,6 +132,23 @@ static void conservative_sparse_sparse_product_impl(const Lhs& lhs, const Rhs& r
   // Therefore, we have nnz(lhs*rhs) = nnz(lhs) + nnz(rhs)
   Index estimated_nnz_prod = lhsEval.nonZerosEstimate() + rhsEval.nonZerosEstimate();
 
+#ifdef EIGEN_HAS_OPENMP
+  // Like the sparse * dense product, use the OpenMP threads for large products, unless already in a parallel region.
+  // The outer vectors of the result are then always sorted.
+  const int threads = Eigen::nbThreads();
+  if (threads > 1 && omp_get_num_threads() == 1 && estimated_nnz_prod > kSparseThreadingThreshold) {
+    parallel_conservative_sparse_sparse_product_impl(lhsEval, rhsEval, rows, cols, res, threads,
+                                                     openmp_parallel_run());
+    return;
+  }
+#endif
+
+  ei_declare_aligned_stack_constructed_variable(bool, mask, rows, 0);
+  ei_declare_aligned_stack_constructed_variable(ResScalar, values, rows, 0);
+  ei_declare_aligned_stack_constructed_variable(Index, indices, rows, 0);
+
+  std::fill_n(mask, rows, false);
+
   res.setZero();
   res.reserve(Index(estimated_nnz_prod));
   // we compute each column of the result, one after the other
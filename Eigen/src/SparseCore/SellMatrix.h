@@ -0,0 +1,483 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_SELL_MATRIX_H
+#define EIGEN_SELL_MATRIX_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+template <typename Scalar_, int SliceHeight_, typename StorageIndex_>
+class SellMatrix;
+
+/** Storage-kind tag for SellMatrix. */
+struct Sell {};
+
+/** Evaluator shape tag for SellMatrix product dispatch. */
+struct SellShape {
+  static std::string debugName() { return "SellShape"; }
+};
+
+namespace internal {
+
+template <>
+struct storage_kind_to_evaluator_kind<Sell> {
+  using Kind = IndexBased;
+};
+
+template <>
+struct storage_kind_to_shape<Sell> {
+  using Shape = SellShape;
+};
+
+template <typename Scalar_, int SliceHeight_, typename StorageIndex_>
+struct traits<SellMatrix<Scalar_, SliceHeight_, StorageIndex_>> {
+  using Scalar = Scalar_;
+  using StorageIndex = StorageIndex_;
+  using StorageKind = Sell;
+  using XprKind = MatrixXpr;
+
+  static constexpr Index RowsAtCompileTime = Dynamic;
+  static constexpr Index ColsAtCompileTime = Dynamic;
+  static constexpr Index MaxRowsAtCompileTime = Dynamic;
+  static constexpr Index MaxColsAtCompileTime = Dynamic;
+  static constexpr int Options = RowMajor;
+  static constexpr unsigned int Flags = RowMajorBit | NestByRefBit;
+};
+
+// Loads the packet of x[idx[0]], ..., x[idx[size-1]]. HasGather tells whether this is a gather instruction, which
+// AVX2 and AVX-512 have for int indices. On the other targets, such as NEON which has no gather instruction, the
+// products load x coefficient by coefficient instead.
+template <typename Packet, typename StorageIndex>
+struct sell_gather {
+  enum { HasGather = 0 };
+  using Scalar = typename unpacket_traits<Packet>::type;
+  static EIGEN_STRONG_INLINE Packet run(const Scalar* x, const StorageIndex* idx) {
+    EIGEN_ALIGN_MAX Scalar lanes[unpacket_traits<Packet>::size];
+    for (int r = 0; r < unpacket_traits<Packet>::size; ++r) lanes[r] = x[idx[r]];
+    return pload<Packet>(lanes);
+  }
+};
+
+#ifdef EIGEN_VECTORIZE_AVX2
+template <>
+struct sell_gather<Packet4d, int> {
+  enum { HasGather = 1 };
+  static EIGEN_STRONG_INLINE Packet4d run(const double* x, const int* idx) {
+    return _mm256_i32gather_pd(x, _mm_loadu_si128(reinterpret_cast<const __m128i*>(idx)), 8);
+  }
+};
+template <>
+struct sell_gather<Packet8f, int> {
+  enum { HasGather = 1 };
+  static EIGEN_STRONG_INLINE Packet8f run(const float* x, const int* idx) {
+    return _mm256_i32gather_ps(x, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), 4);
+  }
+};
+#endif
+
+#ifdef EIGEN_VECTORIZE_AVX512
+template <>
+struct sell_gather<Packet8d, int> {
+  enum { HasGather = 1 };
+  static EIGEN_STRONG_INLINE Packet8d run(const double* x, const int* idx) {
+    return _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(idx)), x, 8);
+  }
+};
+template <>
+struct sell_gather<Packet16f, int> {
+  enum { HasGather = 1 };
+  static EIGEN_STRONG_INLINE Packet16f run(const float* x, const int* idx) {
+    return _mm512_i32gather_ps(_mm512_loadu_si512(idx), x, 4);
+  }
+};
+#endif
+
+}  // namespace internal
+
+/** \class SellMatrix
+ * \ingroup SparseCore_Module
+ *
+ * \brief Sparse matrix in the SELL-C-\f$\sigma\f$ (sliced ELLPACK) format, for SIMD sparse matrix * dense vector
+ * products.
+ *
+ * The compressed row storage of SparseMatrix does not vectorize the products by short rows of irregular lengths.
+ * This format groups the rows by slices of \c C rows, and stores each slice as a dense block of \c C rows padded to
+ * the length of its longest row, column after column, so that the product processes the \c C rows of a slice at
+ * once: each step loads the \c C values of a column of the slice as packets, gathers the matching coefficients of
+ * the vector through their column indices, and accumulates them with one multiply-add per packet (Kreutzer et al.,
+ * A unified sparse matrix data format for efficient general sparse matrix-vector multiplication on modern
+ * processors with wide SIMD units, SIAM J. Sci. Comput., 2014). The gathers use the AVX2 and AVX-512 instructions
+ * for \c float and \c double with \c int indices, for the slices whose columns span more than the L2 cache. Where
+ * the columns are close, as in banded matrices, and on the other targets, the coefficients of the vector are loaded
+ * one by one, which is faster, and the \c C rows are still accumulated independently.
+ *
+ * To limit the padding, the rows are sorted by decreasing length within windows of \f$\sigma\f$ consecutive rows
+ * before being sliced. The products scatter the results back through this permutation, so that the matrix keeps
+ * the row order of the SparseMatrix it was built from. A larger \f$\sigma\f$ pads less but moves the rows further
+ * apart, which costs locality; \f$\sigma = C\f$ does not reorder the rows. The default of \c 32*C suits most
+ * matrices, and a few thousand rows suit those with power-law row lengths, such as graphs.
+ *
+ * The matrix is built from a SparseMatrix, and supports the products by dense vectors and matrices,
+ * \c y \c = \c A*x, \c y \c += \c A*x and \c y \c -= \c A*x, as well as the iteration over the nonzeros of a row
+ * with InnerIterator. With OpenMP, the products share the slices among Eigen::nbThreads() threads by the
+ * nnz-balanced partition of ThreadedSparseProduct, and with EIGEN_USE_THREADS, threadedSellProduct() runs them on
+ * a ThreadPool. The matrix can be used as the operator of the iterative solvers, through their matrix-free
+ * interface:
+ * \code
+ * SparseMatrix<double> A = ...;  // symmetric positive definite
+ * SellMatrix<double> S(A);
+ * ConjugateGradient<SellMatrix<double>, Lower | Upper> cg(S);
+ * VectorXd x = cg.solve(b);
+ * \endcode
+ *
+ * \tparam Scalar_ the scalar type of the coefficients.
+ * \tparam SliceHeight_ the number of rows \c C of a slice. The products are vectorized with the widest packets
+ * dividing \c C, so \c C should be a multiple of the packet size of \c Scalar_. The default of 8 fills one AVX-512
+ * packet of doubles, or two AVX packets.
+ * \tparam StorageIndex_ the signed integer type of the column indices, which must hold the number of stored
+ * coefficients, padding included. The gather instructions are used with \c int.
+ *
+ * Like the other products, \c x \c = \c A*x is evaluated into a temporary, which \c noalias() avoids when the
+ * destination does not alias the right hand side.
+ *
+ * \sa SparseMatrix, ThreadedSparseProduct
+ */
+template <typename Scalar_, int SliceHeight_ = 8, typename StorageIndex_ = int>
+class SellMatrix : public EigenBase<SellMatrix<Scalar_, SliceHeight_, StorageIndex_>> {
+ public:
+  typedef Scalar_ Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef StorageIndex_ StorageIndex;
+  typedef Matrix<Scalar, Dynamic, 1> DenseVector;
+
+  enum {
+    SliceHeight = SliceHeight_,
+    RowsAtCompileTime = Dynamic,
+    ColsAtCompileTime = Dynamic,
+    MaxRowsAtCompileTime = Dynamic,
+    MaxColsAtCompileTime = Dynamic,
+    IsRowMajor = 1
+  };
+
+  EIGEN_STATIC_ASSERT(SliceHeight_ > 0, THE_SLICE_HEIGHT_MUST_BE_POSITIVE)
+
+  SellMatrix() = default;
+
+  /** Builds the SELL-C-\f$\sigma\f$ storage of \a mat, sorting the rows within windows of \a sigma rows. */
+  template <typename Derived>
+  explicit SellMatrix(const SparseMatrixBase<Derived>& mat, Index sigma = DefaultSigma) {
+    compute(mat, sigma);
+  }
+
+  /** Builds the SELL-C-\f$\sigma\f$ storage of \a mat, sorting the rows by decreasing number of nonzeros within
+   * windows of \a sigma consecutive rows. \a sigma is rounded up to a multiple of \c C. The explicit zeros of
+   * \a mat are kept. */
+  template <typename Derived>
+  SellMatrix& compute(const SparseMatrixBase<Derived>& mat, Index sigma = DefaultSigma);
+
+  Index rows() const { return m_rows; }
+  Index cols() const { return m_cols; }
+  /** \returns the number of rows, the outer vectors of InnerIterator */
+  Index outerSize() const { return m_rows; }
+  Index innerSize() const { return m_cols; }
+  /** \returns the number of nonzeros, without the padding */
+  Index nonZeros() const { return m_nonZeros; }
+  /** \returns the number of stored coefficients, padding included, which is the work of a product */
+  Index paddedNonZeros() const { return Index(m_values.size()); }
+  /** \returns the number of slices */
+  Index slices() const { return Index(m_sliceStart.size()) - 1; }
+  /** \returns the sorting window, a multiple of the slice height */
+  Index sigma() const { return m_sigma; }
+
+  /** \returns the lazy product of \c *this by the dense \a rhs. */
+  template <typename OtherDerived>
+  Product<SellMatrix, OtherDerived> operator*(const MatrixBase<OtherDerived>& rhs) const {
+    EIGEN_STATIC_ASSERT((std::is_same<Scalar, typename OtherDerived::Scalar>::value),
+                        YOU_MIXED_DIFFERENT_NUMERIC_TYPES__YOU_NEED_TO_USE_THE_CAST_METHOD_OF_MATRIXBASE_TO_CAST_NUMERIC_TYPES_EXPLICITLY)
+    eigen_assert(cols() == rhs.rows() && "invalid matrix product");
+    return Product<SellMatrix, OtherDerived>(*this, rhs.derived());
+  }
+
+  /** \brief Iterator over the nonzeros of a row, by increasing column, without the padding. */
+  class InnerIterator {
+   public:
+    InnerIterator(const SellMatrix& mat, Index row)
+        : m_values(mat.m_values.data()), m_inner(mat.m_inner.data()), m_row(row) {
+      const Index p = mat.m_rowPosition[row];
+      m_id = mat.m_sliceStart[p / SliceHeight] + p % SliceHeight;
+      m_end = m_id + Index(mat.m_rowLength[p]) * SliceHeight;
+    }
+
+    InnerIterator& operator++() {
+      m_id += SliceHeight;
+      return *this;
+    }
+    const Scalar& value() const { return m_values[m_id]; }
+    StorageIndex index() const { return m_inner[m_id]; }
+    Index row() const { return m_row; }
+    Index col() const { return index(); }
+    Index outer() const { return m_row; }
+    explicit operator bool() const { return m_id < m_end; }
+
+   private:
+    const Scalar* m_values;
+    const StorageIndex* m_inner;
+    Index m_row;
+    Index m_id;
+    Index m_end;
+  };
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+  // dst += alpha * (*this) * x, with the slices shared among threads by an nnz-balanced partition.
+  template <typename ParallelRun>
+  void _apply_impl(const Scalar* x, Scalar* dst, const Scalar& alpha, int threads,
+                   const ParallelRun& parallel_run) const;
+  void _apply_impl(const Scalar* x, Scalar* dst, const Scalar& alpha) const;
+#endif
+
+ private:
+  // The default sorting window, which reorders the rows of a few slices at a time.
+  static constexpr Index DefaultSigma = 32 * SliceHeight;
+  void applySlices(const Scalar* x, Scalar* dst, const Scalar& alpha, Index begin, Index end) const;
+
+  Index m_rows = 0;
+  Index m_cols = 0;
+  Index m_nonZeros = 0;
+  Index m_sigma = SliceHeight;
+  // The slice s holds the rows m_rowOfPosition[s*C], ..., m_rowOfPosition[s*C + C-1], whose k-th coefficients are
+  // stored at m_sliceStart[s] + k*C + 0, ..., m_sliceStart[s] + k*C + C-1. The padding is made of zeros, whose
+  // column index repeats the previous one of the row, so that the gathers stay in bounds and in cache.
+  std::vector<Index> m_sliceStart{0};
+  Matrix<Scalar, Dynamic, 1> m_values;
+  Matrix<StorageIndex, Dynamic, 1> m_inner;
+  std::vector<StorageIndex> m_rowOfPosition;
+  std::vector<StorageIndex> m_rowPosition;
+  std::vector<StorageIndex> m_rowLength;
+  // Whether the product of the slice gathers x in packets, or loads it coefficient by coefficient.
+  std::vector<bool> m_gatherSlice;
+};
+
+template <typename Scalar, int SliceHeight, typename StorageIndex>
+template <typename Derived>
+SellMatrix<Scalar, SliceHeight, StorageIndex>& SellMatrix<Scalar, SliceHeight, StorageIndex>::compute(
+    const SparseMatrixBase<Derived>& mat, Index sigma) {
+  typedef SparseMatrix<Scalar, RowMajor, StorageIndex> RowMajorMatrix;
+  // Binds without a copy when mat is already a compressed row major matrix.
+  const Ref<const RowMajorMatrix> a(mat.derived());
+  const StorageIndex* outer = a.outerIndexPtr();
+  const StorageIndex* inner = a.innerIndexPtr();
+  const Scalar* values = a.valuePtr();
+  const Index C = SliceHeight;
+  m_rows = a.rows();
+  m_cols = a.cols();
+  m_nonZeros = a.nonZeros();
+  m_sigma = numext::maxi<Index>(C, (sigma + C - 1) / C * C);
+
+  // Sorts the rows by decreasing length within each window, keeping the order of the rows of the same length.
+  m_rowOfPosition.resize(m_rows);
+  m_rowPosition.resize(m_rows);
+  m_rowLength.resize(m_rows);
+  const auto length = [&](StorageIndex i) { return outer[i + 1] - outer[i]; };
+  for (Index i = 0; i < m_rows; ++i) m_rowOfPosition[i] = StorageIndex(i);
+  for (Index w = 0; w < m_rows; w += m_sigma) {
+    std::stable_sort(m_rowOfPosition.begin() + w, m_rowOfPosition.begin() + numext::mini(w + m_sigma, m_rows),
+                     [&](StorageIndex i, StorageIndex j) { return length(i) > length(j); });
+  }
+  for (Index p = 0; p < m_rows; ++p) {
+    m_rowPosition[m_rowOfPosition[p]] = StorageIndex(p);
+    m_rowLength[p] = StorageIndex(length(m_rowOfPosition[p]));
+  }
+
+  // Each slice is as wide as its longest row, the first one after the sort.
+  const Index slices = (m_rows + C - 1) / C;
+  m_sliceStart.resize(slices + 1);
+  m_sliceStart[0] = 0;
+  for (Index s = 0; s < slices; ++s) {
+    const Index width = *std::max_element(m_rowLength.begin() + s * C,
+                                          m_rowLength.begin() + numext::mini(s * C + C, m_rows));
+    m_sliceStart[s + 1] = m_sliceStart[s] + width * C;
+  }
+  eigen_assert(m_sliceStart[slices] <= Index(NumTraits<StorageIndex>::highest()) &&
+               "the padded matrix overflows the StorageIndex");
+
+  m_values.setZero(m_sliceStart[slices]);
+  m_inner.resize(m_sliceStart[slices]);
+  for (Index s = 0; s < slices; ++s) {
+    const Index width = (m_sliceStart[s + 1] - m_sliceStart[s]) / C;
+    for (Index r = 0; r < C; ++r) {
+      StorageIndex* dstInner = m_inner.data() + m_sliceStart[s] + r;
+      Scalar* dstValues = m_values.data() + m_sliceStart[s] + r;
+      Index k = 0;
+      StorageIndex col = 0;
+      if (s * C + r < m_rows) {
+        const Index i = m_rowOfPosition[s * C + r];
+        for (Index q = outer[i]; q < outer[i + 1]; ++q, ++k) {
+          col = inner[q];
+          dstInner[k * C] = col;
+          dstValues[k * C] = values[q];
+        }
+      }
+      for (; k < width; ++k) dstInner[k * C] = col;
+    }
+  }
+
+  // The gathers pay off when the coefficients of x come from beyond the L2 cache; scalar loads are faster when the
+  // columns of a slice are close, as in banded matrices.
+  const Index cacheSpan = Index(l2CacheSize()) / Index(sizeof(Scalar));
+  m_gatherSlice.resize(slices);
+  for (Index s = 0; s < slices; ++s) {
+    const auto span = std::minmax_element(m_inner.data() + m_sliceStart[s], m_inner.data() + m_sliceStart[s + 1]);
+    m_gatherSlice[s] = span.first != span.second && *span.second - *span.first >= cacheSpan;
+  }
+  return *this;
+}
+
+template <typename Scalar, int SliceHeight, typename StorageIndex>
+void SellMatrix<Scalar, SliceHeight, StorageIndex>::applySlices(const Scalar* x, Scalar* dst, const Scalar& alpha,
+                                                                Index begin, Index end) const {
+  // The widest packet dividing the slice height, if it has a gather instruction.
+  typedef typename internal::find_best_packet<Scalar, SliceHeight>::type Packet;
+  constexpr int PacketSize = internal::unpacket_traits<Packet>::size;
+  constexpr bool UseGather =
+      int(SliceHeight) % PacketSize == 0 && internal::sell_gather<Packet, StorageIndex>::HasGather;
+  const Scalar* values = m_values.data();
+  const StorageIndex* inner = m_inner.data();
+  for (Index s = begin; s < end; ++s) {
+    EIGEN_ALIGN_MAX Scalar sums[SliceHeight];
+    if (UseGather && m_gatherSlice[s]) {
+      Packet acc[UseGather ? int(SliceHeight) / PacketSize : 1];
+      for (Packet& a : acc) a = internal::pset1<Packet>(Scalar(0));
+      for (Index k = m_sliceStart[s]; k < m_sliceStart[s + 1]; k += SliceHeight) {
+        for (int q = 0; q < int(SliceHeight) / PacketSize; ++q) {
+          acc[q] = internal::pmadd(internal::ploadu<Packet>(values + k + q * PacketSize),
+                                   internal::sell_gather<Packet, StorageIndex>::run(x, inner + k + q * PacketSize),
+                                   acc[q]);
+        }
+      }
+      for (int q = 0; q < int(SliceHeight) / PacketSize; ++q)
+        internal::pstoreu(sums + q * PacketSize, internal::pmul(internal::pset1<Packet>(alpha), acc[q]));
+    } else {
+      // One independent accumulator per row, which the compilers vectorize but for the loads of x.
+      for (Scalar& sum : sums) sum = Scalar(0);
+      for (Index k = m_sliceStart[s]; k < m_sliceStart[s + 1]; k += SliceHeight) {
+        for (int r = 0; r < SliceHeight; ++r) sums[r] += values[k + r] * x[inner[k + r]];
+      }
+      for (Scalar& sum : sums) sum *= alpha;
+    }
+    const Index first = s * SliceHeight;
+    const Index count = numext::mini<Index>(SliceHeight, m_rows - first);
+    for (Index r = 0; r < count; ++r) dst[m_rowOfPosition[first + r]] += sums[r];
+  }
+}
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+template <typename Scalar, int SliceHeight, typename StorageIndex>
+template <typename ParallelRun>
+void SellMatrix<Scalar, SliceHeight, StorageIndex>::_apply_impl(const Scalar* x, Scalar* dst, const Scalar& alpha,
+                                                                int threads, const ParallelRun& parallel_run) const {
+  if (threads <= 1 || paddedNonZeros() < internal::kSparseThreadingThreshold) {
+    applySlices(x, dst, alpha, 0, slices());
+    return;
+  }
+  // The slices write disjoint rows, so each thread takes a contiguous range of slices with about the same number of
+  // stored coefficients.
+  std::vector<Index> part;
+  internal::compute_nnz_balanced_partition(m_sliceStart.data(), slices(), paddedNonZeros(), threads, part);
+  auto task = [&](int t) { applySlices(x, dst, alpha, part[t], part[t + 1]); };
+  parallel_run(threads, task);
+}
+
+template <typename Scalar, int SliceHeight, typename StorageIndex>
+void SellMatrix<Scalar, SliceHeight, StorageIndex>::_apply_impl(const Scalar* x, Scalar* dst,
+                                                                const Scalar& alpha) const {
+#ifdef EIGEN_HAS_OPENMP
+  const int threads = Eigen::nbThreads();
+  if (threads > 1 && omp_get_num_threads() == 1) {
+    _apply_impl(x, dst, alpha, threads, internal::openmp_parallel_run());
+    return;
+  }
+#endif
+  applySlices(x, dst, alpha, 0, slices());
+}
+#endif
+
+namespace internal {
+
+// SellMatrix * dense, column by column of the dense operands.
+template <typename Lhs, typename Rhs, int ProductType>
+struct generic_product_impl<Lhs, Rhs, SellShape, DenseShape, ProductType>
+    : generic_product_impl_base<Lhs, Rhs, generic_product_impl<Lhs, Rhs, SellShape, DenseShape, ProductType>> {
+  typedef typename Product<Lhs, Rhs>::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, 1> VectorType;
+
+  template <typename Dst>
+  static void scaleAndAddTo(Dst& dst, const Lhs& lhs, const Rhs& rhs, const Scalar& alpha) {
+    if (dst.rows() == 0) return;
+    for (Index j = 0; j < rhs.cols(); ++j) {
+      // Binds without a copy to a column of unit inner stride.
+      const Ref<const VectorType> x(rhs.col(j));
+      if (dst.col(j).innerStride() == 1) {
+        lhs._apply_impl(x.data(), &dst.coeffRef(0, j), alpha);
+      } else {
+        VectorType y = dst.col(j);
+        lhs._apply_impl(x.data(), y.data(), alpha);
+        dst.col(j) = y;
+      }
+    }
+  }
+};
+
+// The generic rules of ProductEvaluators.h rewrite "scalar * (A * B)" as "(scalar * A) * B", but a SellMatrix has no
+// scalar multiple: the scalar is rather applied by the kernel when the expression is assigned, or to the evaluated
+// product when it is nested in another expression.
+template <typename Scalar1, typename Scalar2, typename Plain1, typename SellType, typename Rhs>
+using scaled_sell_product = CwiseBinaryOp<scalar_product_op<Scalar1, Scalar2>,
+                                          const CwiseNullaryOp<scalar_constant_op<Scalar1>, Plain1>,
+                                          const Product<SellType, Rhs, DefaultProduct>>;
+
+template <typename Scalar1, typename Scalar2, typename Plain1, typename Scalar_, int SliceHeight_,
+          typename StorageIndex_, typename Rhs>
+struct evaluator<scaled_sell_product<Scalar1, Scalar2, Plain1, SellMatrix<Scalar_, SliceHeight_, StorageIndex_>, Rhs>>
+    : public binary_evaluator<
+          scaled_sell_product<Scalar1, Scalar2, Plain1, SellMatrix<Scalar_, SliceHeight_, StorageIndex_>, Rhs>> {
+  using XprType = scaled_sell_product<Scalar1, Scalar2, Plain1, SellMatrix<Scalar_, SliceHeight_, StorageIndex_>, Rhs>;
+  explicit evaluator(const XprType& xpr) : binary_evaluator<XprType>(xpr) {}
+};
+
+template <typename DstXprType, typename Scalar1, typename Scalar2, typename Plain1, typename Scalar_, int SliceHeight_,
+          typename StorageIndex_, typename Rhs, typename AssignFunc>
+struct Assignment<DstXprType,
+                  scaled_sell_product<Scalar1, Scalar2, Plain1, SellMatrix<Scalar_, SliceHeight_, StorageIndex_>, Rhs>,
+                  AssignFunc, Dense2Dense> {
+  using SellType = SellMatrix<Scalar_, SliceHeight_, StorageIndex_>;
+  using SrcXprType = scaled_sell_product<Scalar1, Scalar2, Plain1, SellType, Rhs>;
+  using DstScalar = typename DstXprType::Scalar;
+  using ProductImpl = generic_product_impl<SellType, Rhs>;
+
+  static void run(DstXprType& dst, const SrcXprType& src, const assign_op<DstScalar, Scalar2>&) {
+    if (dst.rows() != src.rows() || dst.cols() != src.cols()) dst.resize(src.rows(), src.cols());
+    dst.setZero();
+    ProductImpl::scaleAndAddTo(dst, src.rhs().lhs(), src.rhs().rhs(), src.lhs().functor().m_other);
+  }
+  static void run(DstXprType& dst, const SrcXprType& src, const add_assign_op<DstScalar, Scalar2>&) {
+    ProductImpl::scaleAndAddTo(dst, src.rhs().lhs(), src.rhs().rhs(), src.lhs().functor().m_other);
+  }
+  static void run(DstXprType& dst, const SrcXprType& src, const sub_assign_op<DstScalar, Scalar2>&) {
+    ProductImpl::scaleAndAddTo(dst, src.rhs().lhs(), src.rhs().rhs(), -src.lhs().functor().m_other);
+  }
+};
+
+}  // namespace internal
+
+}  // namespace Eigen
+
+#endif  // EIGEN_SELL_MATRIX_H
@@ -0,0 +1,218 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_SPARSE_ASSEMBLY_MAP_H
+#define EIGEN_SPARSE_ASSEMBLY_MAP_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+/** \class SparseAssemblyMap
+ * \ingroup SparseCore_Module
+ *
+ * \brief Map from a list of triplet positions to the nonzeros of a compressed sparse matrix, for repeated assembly.
+ *
+ * Designed for finite element and Newton codes which assemble the same sparsity pattern many times, from a stream
+ * of element contributions produced in the same order each time. analyzePattern() takes the positions (i,j) of
+ * the triplets once, and finds the nonzero of the matrix at each position, so that later assemble() calls only
+ * stream the values: the value of each nonzero becomes the sum of the values of its triplets, summed in the order
+ * of the triplets as by SparseMatrix::setFromTriplets(), and zero if it has no triplet. This neither searches,
+ * sorts nor allocates, and leaves the pattern of the matrix unchanged.
+ *
+ * The map is stored by nonzero: the triplets of each nonzero are listed contiguously, so that assemble() gathers
+ * the values of each nonzero and writes it once, and the nonzeros can be assembled concurrently without conflicts.
+ * With OpenMP, assemble() shares them among Eigen::nbThreads() threads for large assemblies, and with
+ * EIGEN_USE_THREADS, threadedAssemble() runs it on a ThreadPool.
+ *
+ * \tparam SparseMatrixType_ a SparseMatrix<Scalar, Order, StorageIndex>. The number of triplets must fit in its
+ * StorageIndex.
+ *
+ * Example:
+ * \code
+ * std::vector<Triplet<double> > triplets = ...;  // first assembly
+ * SparseMatrix<double> K(n, n);
+ * K.setFromTriplets(triplets.begin(), triplets.end());
+ * SparseAssemblyMap<SparseMatrix<double> > map(K, triplets.begin(), triplets.end());
+ * std::vector<double> values(triplets.size());
+ * for (int iter = 0; iter < iters; ++iter) {
+ *   compute_element_values(values);  // in the order of the triplets
+ *   map.assemble(values.begin(), K);
+ * }
+ * \endcode
+ *
+ * \sa SparseMatrix::setFromTriplets(), threadedSetValuesFromTriplets()
+ */
+template <typename SparseMatrixType_>
+class SparseAssemblyMap {
+ public:
+  typedef SparseMatrixType_ SparseMatrixType;
+  typedef typename SparseMatrixType::Scalar Scalar;
+  typedef typename SparseMatrixType::StorageIndex StorageIndex;
+
+  enum { IsRowMajor = static_cast<int>(SparseMatrixType::IsRowMajor) };
+
+  SparseAssemblyMap() = default;
+
+  template <typename InputIterator>
+  SparseAssemblyMap(const SparseMatrixType& mat, const InputIterator& begin, const InputIterator& end) {
+    analyzePattern(mat, begin, end);
+  }
+
+  /** Computes the map from the triplet positions in the range from \a begin to \a end to the nonzeros of the
+   * compressed matrix \a mat, whose pattern must contain all these positions.
+   *
+   * The \a InputIterator value_type must provide row() and col(), like Triplet. The values of the triplets are not
+   * read. */
+  template <typename InputIterator>
+  SparseAssemblyMap& analyzePattern(const SparseMatrixType& mat, const InputIterator& begin,
+                                    const InputIterator& end);
+
+  /** Sets the values of \a mat from the values of the triplets, given in the order of the triplets by the random
+   * access iterator (or pointer) \a values. \a mat must have the pattern given to analyzePattern(). */
+  template <typename ValueIterator>
+  void assemble(const ValueIterator& values, SparseMatrixType& mat) const;
+
+  /** \returns the number of triplets */
+  Index size() const { return Index(m_triplets.size()); }
+  /** \returns the number of nonzeros of the pattern */
+  Index nonZeros() const { return m_nonZeros; }
+  Index rows() const { return m_rows; }
+  Index cols() const { return m_cols; }
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+  template <typename ValueIterator, typename ParallelRun>
+  void _assemble_impl(const ValueIterator& values, SparseMatrixType& mat, int threads,
+                      const ParallelRun& parallel_run) const;
+#endif
+
+ private:
+  void checkPattern(const SparseMatrixType& mat) const {
+    EIGEN_ONLY_USED_FOR_DEBUG(mat);
+    eigen_assert(m_isInitialized && "SparseAssemblyMap: call analyzePattern() first");
+    eigen_assert(mat.rows() == m_rows && mat.cols() == m_cols && mat.isCompressed() &&
+                 mat.nonZeros() == m_nonZeros && "SparseAssemblyMap: the matrix does not have the analyzed pattern");
+  }
+
+  template <typename ValueIterator>
+  void assembleRange(const ValueIterator& values, Scalar* dst, Index begin, Index end) const;
+
+  Index m_rows = 0;
+  Index m_cols = 0;
+  Index m_nonZeros = 0;
+  bool m_isInitialized = false;
+  // The triplets of the nonzero p are m_triplets[m_offsets[p]], ..., m_triplets[m_offsets[p + 1] - 1], in
+  // increasing order.
+  std::vector<Index> m_offsets;
+  std::vector<StorageIndex> m_triplets;
+};
+
+template <typename SparseMatrixType>
+template <typename InputIterator>
+SparseAssemblyMap<SparseMatrixType>& SparseAssemblyMap<SparseMatrixType>::analyzePattern(const SparseMatrixType& mat,
+                                                                                         const InputIterator& begin,
+                                                                                         const InputIterator& end) {
+  eigen_assert(mat.isCompressed() && "SparseAssemblyMap requires a compressed SparseMatrix");
+  m_rows = mat.rows();
+  m_cols = mat.cols();
+  m_nonZeros = mat.nonZeros();
+
+  // The pattern in the storage order of mat: its outer vectors are the rows of a row major matrix.
+  internal::SparsityPatternRef<StorageIndex> pattern;
+  pattern.outer = mat.outerIndexPtr();
+  pattern.inner = mat.innerIndexPtr();
+  pattern.outerSize = mat.outerSize();
+  pattern.innerSize = mat.innerSize();
+
+  // Finds the nonzero of each triplet, and counts the triplets of each nonzero.
+  std::vector<StorageIndex> nonZeroOfTriplet;
+  m_offsets.assign(m_nonZeros + 1, 0);
+  for (InputIterator it(begin); it != end; ++it) {
+    eigen_assert(it->row() >= 0 && it->row() < mat.rows() && it->col() >= 0 && it->col() < mat.cols());
+    eigen_assert(nonZeroOfTriplet.size() < std::size_t(NumTraits<StorageIndex>::highest()) &&
+                 "the number of triplets exceeds the StorageIndex range");
+    const Index j = IsRowMajor ? it->row() : it->col();
+    const StorageIndex i = internal::convert_index<StorageIndex>(IsRowMajor ? it->col() : it->row());
+    const StorageIndex* first = pattern.inner + pattern.outer[j];
+    const StorageIndex* last = first + pattern.nonZeros(j);
+    const StorageIndex* p = std::lower_bound(first, last, i);
+    eigen_assert(p != last && *p == i && "a triplet is outside the pattern");
+    nonZeroOfTriplet.push_back(StorageIndex(p - pattern.inner));
+    ++m_offsets[p - pattern.inner + 1];
+  }
+  std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+
+  // Counting sort of the triplets by nonzero, which keeps the order of the triplets of each nonzero.
+  m_triplets.resize(nonZeroOfTriplet.size());
+  std::vector<Index> next(m_offsets.begin(), m_offsets.end() - 1);
+  for (std::size_t k = 0; k < nonZeroOfTriplet.size(); ++k) m_triplets[next[nonZeroOfTriplet[k]]++] = StorageIndex(k);
+  m_isInitialized = true;
+  return *this;
+}
+
+template <typename SparseMatrixType>
+template <typename ValueIterator>
+void SparseAssemblyMap<SparseMatrixType>::assembleRange(const ValueIterator& values, Scalar* dst, Index begin,
+                                                        Index end) const {
+  const StorageIndex* triplets = m_triplets.data();
+  for (Index p = begin; p < end; ++p) {
+    Index k = m_offsets[p];
+    const Index last = m_offsets[p + 1];
+    if (k == last) {
+      dst[p] = Scalar(0);
+      continue;
+    }
+    Scalar sum = values[triplets[k]];
+    for (++k; k < last; ++k) sum += values[triplets[k]];
+    dst[p] = sum;
+  }
+}
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+template <typename SparseMatrixType>
+template <typename ValueIterator, typename ParallelRun>
+void SparseAssemblyMap<SparseMatrixType>::_assemble_impl(const ValueIterator& values, SparseMatrixType& mat,
+                                                         int threads, const ParallelRun& parallel_run) const {
+  checkPattern(mat);
+  Scalar* dst = mat.valuePtr();
+  if (threads <= 1) {
+    assembleRange(values, dst, 0, m_nonZeros);
+    return;
+  }
+  // Each thread assembles a contiguous range of nonzeros with about the same number of triplets.
+  auto task = [&](int t) {
+    const auto rangeStart = [&](int u) {
+      if (u == threads) return m_nonZeros;
+      const Index target = size() * u / threads;
+      return Index(std::lower_bound(m_offsets.begin(), m_offsets.end(), target) - m_offsets.begin());
+    };
+    assembleRange(values, dst, rangeStart(t), rangeStart(t + 1));
+  };
+  parallel_run(threads, task);
+}
+#endif
+
+template <typename SparseMatrixType>
+template <typename ValueIterator>
+void SparseAssemblyMap<SparseMatrixType>::assemble(const ValueIterator& values, SparseMatrixType& mat) const {
+#ifdef EIGEN_HAS_OPENMP
+  const int threads = Eigen::nbThreads();
+  if (threads > 1 && omp_get_num_threads() == 1 && size() > internal::kSparseThreadingThreshold) {
+    _assemble_impl(values, mat, threads, internal::openmp_parallel_run());
+    return;
+  }
+#endif
+  checkPattern(mat);
+  assembleRange(values, mat.valuePtr(), 0, m_nonZeros);
+}
+
+}  // namespace Eigen
+
+#endif  // EIGEN_SPARSE_ASSEMBLY_MAP_H
@@ -1120,6 +1120,191 @@ class SparseMatrix : public SparseCompressedBase<SparseMatrix<Scalar_, Options_,
 
 namespace internal {
 
+// Creates a compressed sparse matrix from a random access range of unsorted triplets, on several threads.
+// parallel_run(threads, f) must call f(t) for t = 0, ..., threads-1, concurrently.
+//  1. each thread counts the triplets of each outer vector in its share of the triplets,
+//  2. the counts give each thread a range of each outer vector of a temporary buffer,
+//  3. each thread scatters its triplets to its ranges, so that each outer vector holds its triplets in their order,
+//  4. the outer vectors are shared among the threads, which collapse the duplicates, in the order of the triplets,
+//     and sort the inner indices,
+//  5. the outer vectors are copied to mat.
+// The result, including the order in which dup_func combines the duplicates, is that of set_from_triplets.
+// If KeepPattern, mat must be compressed with a pattern containing the positions of all the triplets, and only its
+// values are set, to zero at the positions without triplets.
+template <bool KeepPattern, typename InputIterator, typename SparseMatrixType, typename DupFunctor,
+          typename ParallelRun>
+void parallel_set_from_triplets(const InputIterator& begin, const InputIterator& end, SparseMatrixType& mat,
+                                DupFunctor dup_func, int threads, const ParallelRun& parallel_run) {
+  constexpr bool IsRowMajor = SparseMatrixType::IsRowMajor;
+  using Scalar = typename SparseMatrixType::Scalar;
+  using StorageIndex = typename SparseMatrixType::StorageIndex;
+  eigen_assert((!KeepPattern || mat.isCompressed()) && "the pattern to fill must be compressed");
+
+  const Index size = end - begin;
+  const Index outerSize = mat.outerSize();
+  const Index innerSize = mat.innerSize();
+  const auto tripletBegin = [&](int t) { return size * t / threads; };
+  const auto outerBegin = [&](int t) { return outerSize * t / threads; };
+
+  // 1. counts[t * outerSize + j] is the number of triplets of thread t in the outer vector j.
+  std::vector<Index> counts(std::size_t(threads) * std::size_t(outerSize), 0);
+  auto count = [&](int t) {
+    Index* c = counts.data() + t * outerSize;
+    for (InputIterator it = begin + tripletBegin(t), last = begin + tripletBegin(t + 1); it != last; ++it) {
+      eigen_assert(it->row() >= 0 && it->row() < mat.rows() && it->col() >= 0 && it->col() < mat.cols());
+      ++c[IsRowMajor ? it->row() : it->col()];
+    }
+  };
+  parallel_run(threads, count);
+
+  // 2. counts[t * outerSize + j] becomes the start of the range of thread t in the outer vector j, which starts at
+  // vectorStart[j].
+  std::vector<Index> vectorStart(outerSize + 1, 0);
+  auto countsToOffsets = [&](int t) {
+    for (Index j = outerBegin(t); j < outerBegin(t + 1); ++j) {
+      Index sum = 0;
+      for (int u = 0; u < threads; ++u) {
+        const Index c = counts[u * outerSize + j];
+        counts[u * outerSize + j] = sum;
+        sum += c;
+      }
+      vectorStart[j + 1] = sum;
+    }
+  };
+  parallel_run(threads, countsToOffsets);
+  std::partial_sum(vectorStart.begin(), vectorStart.end(), vectorStart.begin());
+  auto addVectorStart = [&](int t) {
+    for (int u = 0; u < threads; ++u)
+      for (Index j = outerBegin(t); j < outerBegin(t + 1); ++j) counts[u * outerSize + j] += vectorStart[j];
+  };
+  parallel_run(threads, addVectorStart);
+
+  // 3.
+  Matrix<StorageIndex, Dynamic, 1> inner(size);
+  Matrix<Scalar, Dynamic, 1> values(size);
+  auto scatter = [&](int t) {
+    Index* position = counts.data() + t * outerSize;
+    for (InputIterator it = begin + tripletBegin(t), last = begin + tripletBegin(t + 1); it != last; ++it) {
+      const Index k = position[IsRowMajor ? it->row() : it->col()]++;
+      inner.coeffRef(k) = convert_index<StorageIndex>(IsRowMajor ? it->col() : it->row());
+      values.coeffRef(k) = it->value();
+    }
+  };
+  parallel_run(threads, scatter);
+  counts.clear();
+  counts.shrink_to_fit();
+
+  // 4. The threads take chunks of consecutive outer vectors, which balances the costs of the sorts. uniqueCount[j]
+  // is the number of distinct inner indices of the outer vector j.
+  std::vector<StorageIndex> uniqueCount(outerSize);
+  const Index chunkSize = numext::maxi<Index>(1, outerSize / (Index(threads) * 16));
+  const Index numChunks = (outerSize + chunkSize - 1) / chunkSize;
+  std::atomic<Index> nextChunk(0);
+  auto collapseAndSort = [&](int) {
+    // As in collapseDuplicates, wi[i] is the position of the entry of inner index i in the current outer vector
+    // if it is at least the start of the vector. The threads take increasing outer vectors, so the positions
+    // recorded for the previous ones are below that start.
+    std::vector<Index> wi(innerSize, Index(-1));
+    std::vector<std::pair<StorageIndex, Scalar>> sorted;
+    for (Index c = nextChunk++; c < numChunks; c = nextChunk++) {
+      for (Index j = c * chunkSize; j < numext::mini(outerSize, (c + 1) * chunkSize); ++j) {
+        const Index start = vectorStart[j];
+        Index back = start;
+        for (Index k = start; k < vectorStart[j + 1]; ++k) {
+          const StorageIndex i = inner.coeff(k);
+          if (wi[i] >= start) {
+            values.coeffRef(wi[i]) = dup_func(values.coeff(wi[i]), values.coeff(k));
+          } else {
+            inner.coeffRef(back) = i;
+            values.coeffRef(back) = values.coeff(k);
+            wi[i] = back;
+            ++back;
+          }
+        }
+        const Index nnz = back - start;
+        uniqueCount[j] = StorageIndex(nnz);
+        sorted.clear();
+        // Sort a sparse vector, but scan the markers of a dense one.
+        if (nnz * numext::log2(int(nnz) + 1) < innerSize) {
+          for (Index k = start; k < back; ++k) sorted.emplace_back(inner.coeff(k), values.coeff(k));
+          std::sort(sorted.begin(), sorted.end(),
+                    [](const std::pair<StorageIndex, Scalar>& a, const std::pair<StorageIndex, Scalar>& b) {
+                      return a.first < b.first;
+                    });
+        } else {
+          for (Index i = 0; i < innerSize; ++i)
+            if (wi[i] >= start) sorted.emplace_back(StorageIndex(i), values.coeff(wi[i]));
+        }
+        for (Index k = 0; k < nnz; ++k) {
+          inner.coeffRef(start + k) = sorted[k].first;
+          values.coeffRef(start + k) = sorted[k].second;
+        }
+      }
+    }
+  };
+  parallel_run(threads, collapseAndSort);
+
+  // 5.
+  if (KeepPattern) {
+    const StorageIndex* outer = mat.outerIndexPtr();
+    const StorageIndex* patternInner = mat.innerIndexPtr();
+    Scalar* patternValues = mat.valuePtr();
+    auto merge = [&](int t) {
+      for (Index j = outerBegin(t); j < outerBegin(t + 1); ++j) {
+        Index p = outer[j];
+        for (Index k = vectorStart[j]; k < vectorStart[j] + uniqueCount[j]; ++k) {
+          for (; p < outer[j + 1] && patternInner[p] < inner.coeff(k); ++p) patternValues[p] = Scalar(0);
+          eigen_assert(p < outer[j + 1] && patternInner[p] == inner.coeff(k) && "a triplet is outside the pattern");
+          patternValues[p++] = values.coeff(k);
+        }
+        for (; p < outer[j + 1]; ++p) patternValues[p] = Scalar(0);
+      }
+    };
+    parallel_run(threads, merge);
+  } else {
+    // deallocate inner nonzeros if present and zero outerIndexPtr
+    mat.resize(mat.rows(), mat.cols());
+    StorageIndex* outer = mat.outerIndexPtr();
+    Index nonZeros = 0;
+    for (Index j = 0; j < outerSize; ++j) {
+      nonZeros += uniqueCount[j];
+      eigen_assert(nonZeros <= NumTraits<StorageIndex>::highest() &&
+                   "non-zero count exceeds StorageIndex range, use a wider StorageIndex (e.g. int64_t)");
+      if (nonZeros > NumTraits<StorageIndex>::highest()) internal::throw_std_bad_alloc();
+      outer[j + 1] = StorageIndex(nonZeros);
+    }
+    mat.resizeNonZeros(nonZeros);
+    auto copy = [&](int t) {
+      for (Index j = outerBegin(t); j < outerBegin(t + 1); ++j) {
+        smart_copy(inner.data() + vectorStart[j], inner.data() + vectorStart[j] + uniqueCount[j],
+                   mat.innerIndexPtr() + outer[j]);
+        smart_copy(values.data() + vectorStart[j], values.data() + vectorStart[j] + uniqueCount[j],
+                   mat.valuePtr() + outer[j]);
+      }
+    };
+    parallel_run(threads, copy);
+  }
+}
+
+#ifdef EIGEN_HAS_OPENMP
+// Like the sparse products, set_from_triplets uses the OpenMP threads for large inputs, unless already in a parallel
+// region. The triplets are then shared among the threads, which requires random access iterators.
+template <typename InputIterator, typename SparseMatrixType, typename DupFunctor>
+bool try_parallel_set_from_triplets(const InputIterator& begin, const InputIterator& end, SparseMatrixType& mat,
+                                    DupFunctor dup_func, std::random_access_iterator_tag) {
+  const int threads = Eigen::nbThreads();
+  if (threads <= 1 || omp_get_num_threads() != 1 || end - begin <= kSparseThreadingThreshold) return false;
+  parallel_set_from_triplets<false>(begin, end, mat, dup_func, threads, openmp_parallel_run());
+  return true;
+}
+#endif
+
+template <typename InputIterator, typename SparseMatrixType, typename DupFunctor, typename IteratorCategory>
+bool try_parallel_set_from_triplets(const InputIterator&, const InputIterator&, SparseMatrixType&, DupFunctor,
+                                    IteratorCategory) {
+  return false;
+}
+
 // Creates a compressed sparse matrix from a range of unsorted triplets
 // Requires temporary storage to handle duplicate entries
 template <typename InputIterator, typename SparseMatrixType, typename DupFunctor>
@@ -1136,6 +1321,9 @@ void set_from_triplets(const InputIterator& begin, const InputIterator& end, Spa
     mat.setZero();
     return;
   }
+  if (try_parallel_set_from_triplets(begin, end, mat, dup_func,
+                                     typename std::iterator_traits<InputIterator>::iterator_category()))
+    return;
 
   // There are two strategies to consider for constructing a matrix from unordered triplets:
   // A) construct the 'mat' in its native storage order and sort in-place (less memory); or,
@@ -0,0 +1,220 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_SPARSE_PRODUCT_PLAN_H
+#define EIGEN_SPARSE_PRODUCT_PLAN_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+/** \class SparseProductPlan
+ * \ingroup SparseCore_Module
+ *
+ * \brief Symbolic analysis of a sparse * sparse product, reusable while the operands keep their sparsity pattern.
+ *
+ * Designed for time-stepping and nonlinear solvers that compute \c C \c = \c A*B many times with \c A and \c B
+ * changing values but not patterns. analyzePattern() runs the symbolic phase once: it builds the pattern of \c C,
+ * with sorted inner indices, and a scatter map giving, for each scalar product \c A(i,k)*B(k,j) of the product, the
+ * position of \c C(i,j) in the value array of \c C. compute() then only does the numeric work: it zeroes the value
+ * array of \c C and accumulates the scalar products into it through the map, without searching, sorting or
+ * allocating. Only the first compute() into a given \c C, or one following a new analyzePattern(), sets up the
+ * pattern of \c C.
+ *
+ * The pattern of \c C is that of the conservative product: entries cancelling numerically are kept, so the pattern
+ * does not depend on the values. The scatter map holds one StorageIndex per scalar product, that is the flop count
+ * of the product.
+ *
+ * The analysis only depends on the patterns of the operands: calling compute() with operands of other patterns, or
+ * modifying the pattern of \c C between two calls, is undefined behavior (asserted in debug builds on the numbers of
+ * nonzeros).
+ *
+ * With OpenMP, compute() shares the outer vectors of \c C among Eigen::nbThreads() threads for large products.
+ *
+ * \tparam SparseMatrixType_ the type of \c A, \c B and \c C, a SparseMatrix<Scalar, Order, StorageIndex>. The
+ * operands must be compressed.
+ *
+ * Example:
+ * \code
+ * SparseProductPlan<SparseMatrix<double> > plan(A, B);
+ * SparseMatrix<double> C;
+ * for (int step = 0; step < steps; ++step) {
+ *   update_values(A, B);
+ *   plan.compute(A, B, C);
+ * }
+ * \endcode
+ *
+ * \sa ThreadedSparseProduct
+ */
+template <typename SparseMatrixType_>
+class SparseProductPlan {
+ public:
+  typedef SparseMatrixType_ SparseMatrixType;
+  typedef typename SparseMatrixType::Scalar Scalar;
+  typedef typename SparseMatrixType::StorageIndex StorageIndex;
+
+  enum { IsRowMajor = static_cast<int>(SparseMatrixType::IsRowMajor) };
+
+  SparseProductPlan() = default;
+
+  SparseProductPlan(const SparseMatrixType& lhs, const SparseMatrixType& rhs) { analyzePattern(lhs, rhs); }
+
+  /** Computes the pattern of \a lhs * \a rhs and the scatter map of the product. */
+  SparseProductPlan& analyzePattern(const SparseMatrixType& lhs, const SparseMatrixType& rhs);
+
+  /** Computes \a res = \a lhs * \a rhs, where \a lhs and \a rhs have the patterns given to analyzePattern().
+   *
+   * \warning \a res must not alias \a lhs or \a rhs. */
+  void compute(const SparseMatrixType& lhs, const SparseMatrixType& rhs, SparseMatrixType& res) const;
+
+  Index rows() const { return m_rows; }
+  Index cols() const { return m_cols; }
+  /** \returns the number of nonzeros of the product */
+  Index nonZeros() const { return Index(m_inner.size()); }
+  /** \returns the number of scalar products of the product, that is the size of the scatter map */
+  Index flops() const { return Index(m_slots.size()); }
+
+ private:
+  void setPattern(SparseMatrixType& res) const;
+  void computeOuter(const SparseMatrixType& a, const SparseMatrixType& b, Scalar* values, Index j) const;
+
+  Index m_rows = 0;
+  Index m_cols = 0;
+  // Number of nonzeros of the operands, to detect pattern changes in debug builds.
+  Index m_lhsNonZeros = 0;
+  Index m_rhsNonZeros = 0;
+  bool m_isInitialized = false;
+  // Compressed pattern of the product.
+  std::vector<StorageIndex> m_outer;
+  std::vector<StorageIndex> m_inner;
+  // The scalar products of the outer vector j of the product are scattered through m_slots[m_firstSlot[j], ...).
+  std::vector<StorageIndex> m_slots;
+  std::vector<Index> m_firstSlot;
+};
+
+template <typename SparseMatrixType>
+SparseProductPlan<SparseMatrixType>& SparseProductPlan<SparseMatrixType>::analyzePattern(const SparseMatrixType& lhs,
+                                                                                         const SparseMatrixType& rhs) {
+  eigen_assert(lhs.cols() == rhs.rows() && "invalid matrix product");
+  eigen_assert(lhs.isCompressed() && rhs.isCompressed() && "SparseProductPlan requires compressed operands");
+  m_rows = lhs.rows();
+  m_cols = rhs.cols();
+  m_lhsNonZeros = lhs.nonZeros();
+  m_rhsNonZeros = rhs.nonZeros();
+
+  // As for the product itself, row major storage computes the transposed product, column major by column major: the
+  // outer vector j of the product combines the outer vectors of a selected by the outer vector j of b.
+  const SparseMatrixType& a = IsRowMajor ? rhs : lhs;
+  const SparseMatrixType& b = IsRowMajor ? lhs : rhs;
+  const Index innerSize = a.innerSize();
+  const Index outerSize = b.outerSize();
+  const StorageIndex* aOuter = a.outerIndexPtr();
+  const StorageIndex* aInner = a.innerIndexPtr();
+  const StorageIndex* bOuter = b.outerIndexPtr();
+  const StorageIndex* bInner = b.innerIndexPtr();
+
+  Index flops = 0;
+  for (Index q = 0; q < b.nonZeros(); ++q) flops += aOuter[bInner[q] + 1] - aOuter[bInner[q]];
+  m_outer.assign(outerSize + 1, 0);
+  m_inner.clear();
+  m_slots.resize(flops);
+  m_firstSlot.resize(outerSize + 1);
+
+  // marker[i] == j iff the inner index i already appears in the outer vector j, and position[i] is then its position
+  // in the value array of the product.
+  std::vector<Index> marker(innerSize, Index(-1));
+  std::vector<StorageIndex> position(innerSize);
+  Index t = 0;
+  for (Index j = 0; j < outerSize; ++j) {
+    const Index start = Index(m_inner.size());
+    for (Index q = bOuter[j]; q < bOuter[j + 1]; ++q) {
+      const Index k = bInner[q];
+      for (Index p = aOuter[k]; p < aOuter[k + 1]; ++p) {
+        const Index i = aInner[p];
+        if (marker[i] != j) {
+          marker[i] = j;
+          m_inner.push_back(StorageIndex(i));
+        }
+      }
+    }
+    std::sort(m_inner.begin() + start, m_inner.end());
+    eigen_assert(m_inner.size() <= std::size_t(NumTraits<StorageIndex>::highest()) &&
+                 "the product overflows the StorageIndex");
+    m_outer[j + 1] = StorageIndex(m_inner.size());
+    for (Index p = start; p < Index(m_inner.size()); ++p) position[m_inner[p]] = StorageIndex(p);
+
+    m_firstSlot[j] = t;
+    for (Index q = bOuter[j]; q < bOuter[j + 1]; ++q) {
+      const Index k = bInner[q];
+      for (Index p = aOuter[k]; p < aOuter[k + 1]; ++p) m_slots[t++] = position[aInner[p]];
+    }
+  }
+  m_firstSlot[outerSize] = t;
+  m_inner.shrink_to_fit();
+  m_isInitialized = true;
+  return *this;
+}
+
+template <typename SparseMatrixType>
+void SparseProductPlan<SparseMatrixType>::setPattern(SparseMatrixType& res) const {
+  res.resize(m_rows, m_cols);
+  res.resizeNonZeros(nonZeros());
+  std::copy(m_outer.begin(), m_outer.end(), res.outerIndexPtr());
+  std::copy(m_inner.begin(), m_inner.end(), res.innerIndexPtr());
+}
+
+template <typename SparseMatrixType>
+void SparseProductPlan<SparseMatrixType>::computeOuter(const SparseMatrixType& a, const SparseMatrixType& b,
+                                                       Scalar* values, Index j) const {
+  const StorageIndex* aOuter = a.outerIndexPtr();
+  const Scalar* aValues = a.valuePtr();
+  const StorageIndex* bOuter = b.outerIndexPtr();
+  const StorageIndex* bInner = b.innerIndexPtr();
+  const Scalar* bValues = b.valuePtr();
+  std::fill(values + m_outer[j], values + m_outer[j + 1], Scalar(0));
+  const StorageIndex* slot = m_slots.data() + m_firstSlot[j];
+  for (Index q = bOuter[j]; q < bOuter[j + 1]; ++q) {
+    const Scalar y = bValues[q];
+    const Index k = bInner[q];
+    for (Index p = aOuter[k]; p < aOuter[k + 1]; ++p) values[*slot++] += aValues[p] * y;
+  }
+}
+
+template <typename SparseMatrixType>
+void SparseProductPlan<SparseMatrixType>::compute(const SparseMatrixType& lhs, const SparseMatrixType& rhs,
+                                                  SparseMatrixType& res) const {
+  eigen_assert(m_isInitialized && "SparseProductPlan: call analyzePattern() first");
+  eigen_assert(lhs.rows() == m_rows && rhs.cols() == m_cols && lhs.cols() == rhs.rows() &&
+               lhs.nonZeros() == m_lhsNonZeros && rhs.nonZeros() == m_rhsNonZeros && lhs.isCompressed() &&
+               rhs.isCompressed() && "SparseProductPlan: the operands do not have the analyzed patterns");
+  if (res.rows() != m_rows || res.cols() != m_cols || !res.isCompressed() || res.nonZeros() != nonZeros())
+    setPattern(res);
+  eigen_assert(std::equal(m_outer.begin(), m_outer.end(), res.outerIndexPtr()) &&
+               "SparseProductPlan: the pattern of the result was modified");
+
+  const SparseMatrixType& a = IsRowMajor ? rhs : lhs;
+  const SparseMatrixType& b = IsRowMajor ? lhs : rhs;
+  const Index outerSize = b.outerSize();
+  Scalar* values = res.valuePtr();
+#ifdef EIGEN_HAS_OPENMP
+  const int threads = Eigen::nbThreads();
+  if (threads > 1 && omp_get_num_threads() == 1 && flops() > internal::kSparseThreadingThreshold) {
+    const Index chunk = numext::maxi<Index>(Index(1), (outerSize + Index(threads) * 4 - 1) / (Index(threads) * 4));
+#pragma omp parallel for schedule(dynamic, chunk) num_threads(threads)
+    for (Index j = 0; j < outerSize; ++j) computeOuter(a, b, values, j);
+    return;
+  }
+#endif
+  for (Index j = 0; j < outerSize; ++j) computeOuter(a, b, values, j);
+}
+
+}  // namespace Eigen
+
+#endif  // EIGEN_SPARSE_PRODUCT_PLAN_H
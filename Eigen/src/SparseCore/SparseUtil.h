@@ -162,6 +162,46 @@ struct LowerBoundIndex {
   bool found = false;
 };
 
+// Minimum amount of work, in non-zeros or multiply-adds, for which the threaded sparse kernels split their work. It is
+// the threshold of the sparse * dense products of SparseDenseProduct.h.
+constexpr Index kSparseThreadingThreshold = 20000;
+
+// nnz-balanced partition of an outer range [0, outerSize) into numChunks
+// contiguous chunks. boundaries[t] = first outer index owned by partition t;
+// boundaries[numChunks] = outerSize.
+//
+// The split uses std::lower_bound on the outer-index array. Targets are
+// monotonically increasing in t, so each search starts from the previous
+// boundary; total work is bounded by O(numChunks + log outerSize) rather than
+// numChunks * log(outerSize). Each chunk's nnz count differs from the ideal by
+// at most max_nnz_per_outer.
+template <typename StorageIndex>
+inline void compute_nnz_balanced_partition(const StorageIndex* outer, Index outerSize, Index totalNnz, int numChunks,
+                                           std::vector<Index>& boundaries) {
+  boundaries.assign(numChunks + 1, 0);
+  boundaries[numChunks] = outerSize;
+  if (numChunks <= 1 || outerSize == 0 || totalNnz == 0) return;
+  const StorageIndex* const last = outer + outerSize + 1;
+  const StorageIndex* lo = outer;
+  for (int t = 1; t < numChunks; ++t) {
+    Index target = (static_cast<Index>(t) * totalNnz) / numChunks;
+    lo = std::lower_bound(lo, last, static_cast<StorageIndex>(target));
+    boundaries[t] = lo - outer;
+  }
+}
+
+#ifdef EIGEN_HAS_OPENMP
+// Runs task(0), ..., task(threads-1) concurrently on OpenMP threads. Used by the parallel kernels which take the
+// thread dispatch as a parameter, so that they also run on a ThreadPool.
+struct openmp_parallel_run {
+  template <typename Task>
+  void operator()(int threads, Task& task) const {
+#pragma omp parallel num_threads(threads)
+    task(omp_get_thread_num());
+  }
+};
+#endif
+
 }  // end namespace internal
 
 /** \ingroup SparseCore_Module
@@ -0,0 +1,117 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_THREADED_SPARSE_ASSEMBLY_H
+#define EIGEN_THREADED_SPARSE_ASSEMBLY_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+/** \ingroup SparseCore_Module
+ *
+ * The same as SparseMatrix::setFromTriplets(), but computed on the threads of \a pool, or of a default pool with one
+ * thread per hardware thread if \a pool is null. When duplicates are met, the functor \a dup_func is applied as in
+ * setFromTriplets(), in the order of the triplets.
+ *
+ * The triplets are shared among the threads, which count the entries of each outer vector in per-thread
+ * histograms, then scatter the triplets to their outer vectors in parallel. The outer vectors are then shared among
+ * the threads, which collapse their duplicates and sort them concurrently. The result is the same as that of
+ * setFromTriplets(): a sorted and compressed matrix.
+ *
+ * \a InputIterator must be a random access iterator. Small inputs are assembled serially. This needs about as much
+ * temporary memory as setFromTriplets(), plus one counter per thread and outer vector.
+ *
+ * \sa SparseMatrix::setFromTriplets(), threadedSetValuesFromTriplets()
+ */
+template <typename InputIterator, typename Scalar, int Options, typename StorageIndex, typename DupFunctor>
+void threadedSetFromTriplets(const InputIterator& begin, const InputIterator& end,
+                             SparseMatrix<Scalar, Options, StorageIndex>& mat, ThreadPool* pool, DupFunctor dup_func) {
+  EIGEN_STATIC_ASSERT((std::is_base_of<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<InputIterator>::iterator_category>::value),
+                      THE_TRIPLETS_MUST_BE_GIVEN_BY_RANDOM_ACCESS_ITERATORS)
+  ThreadPool* p = pool ? pool : &internal::default_threaded_sparse_pool();
+  const int threads = p->NumThreads();
+  // Same serial-fallback threshold as the other threaded sparse kernels.
+  if (threads <= 1 || end - begin < internal::kSparseThreadingThreshold) {
+    mat.setFromTriplets(begin, end, dup_func);
+    return;
+  }
+  internal::parallel_set_from_triplets<false>(begin, end, mat, dup_func, threads,
+                                              internal::thread_pool_parallel_run{p});
+}
+
+/** \ingroup SparseCore_Module
+ *
+ * The same as threadedSetFromTriplets(begin, end, mat, pool, dup_func), with duplicates summed up. */
+template <typename InputIterator, typename Scalar, int Options, typename StorageIndex>
+void threadedSetFromTriplets(const InputIterator& begin, const InputIterator& end,
+                             SparseMatrix<Scalar, Options, StorageIndex>& mat, ThreadPool* pool = nullptr) {
+  threadedSetFromTriplets(begin, end, mat, pool, internal::scalar_sum_op<Scalar, Scalar>());
+}
+
+/** \ingroup SparseCore_Module
+ *
+ * Sets the values of the compressed matrix \a mat from the triplets in the range from \a begin to \a end, keeping
+ * its pattern, on the threads of \a pool, or of a default pool if \a pool is null.
+ *
+ * This is for repeated assemblies of matrices of the same pattern, for instance by the first assembly done with
+ * setFromTriplets() or threadedSetFromTriplets(). The pattern of \a mat must contain the positions of all the
+ * triplets, which is asserted in debug builds. The entries of the pattern without triplets are set to zero, and
+ * those with several triplets are combined by \a dup_func as in setFromTriplets(). Neither the pattern nor the
+ * memory of \a mat changes.
+ *
+ * \a InputIterator must be a random access iterator.
+ *
+ * For assemblies repeated many times from the same triplet positions, SparseAssemblyMap and threadedAssemble()
+ * avoid the sorts of this function.
+ *
+ * \sa threadedSetFromTriplets(), SparseAssemblyMap
+ */
+template <typename InputIterator, typename Scalar, int Options, typename StorageIndex, typename DupFunctor>
+void threadedSetValuesFromTriplets(const InputIterator& begin, const InputIterator& end,
+                                   SparseMatrix<Scalar, Options, StorageIndex>& mat, ThreadPool* pool,
+                                   DupFunctor dup_func) {
+  EIGEN_STATIC_ASSERT((std::is_base_of<std::random_access_iterator_tag,
+                                       typename std::iterator_traits<InputIterator>::iterator_category>::value),
+                      THE_TRIPLETS_MUST_BE_GIVEN_BY_RANDOM_ACCESS_ITERATORS)
+  eigen_assert(mat.isCompressed() && "threadedSetValuesFromTriplets requires a compressed SparseMatrix");
+  ThreadPool* p = pool ? pool : &internal::default_threaded_sparse_pool();
+  const int threads = end - begin < internal::kSparseThreadingThreshold ? 1 : p->NumThreads();
+  internal::parallel_set_from_triplets<true>(begin, end, mat, dup_func, threads, internal::thread_pool_parallel_run{p});
+}
+
+/** \ingroup SparseCore_Module
+ *
+ * The same as threadedSetValuesFromTriplets(begin, end, mat, pool, dup_func), with duplicates summed up. */
+template <typename InputIterator, typename Scalar, int Options, typename StorageIndex>
+void threadedSetValuesFromTriplets(const InputIterator& begin, const InputIterator& end,
+                                   SparseMatrix<Scalar, Options, StorageIndex>& mat, ThreadPool* pool = nullptr) {
+  threadedSetValuesFromTriplets(begin, end, mat, pool, internal::scalar_sum_op<Scalar, Scalar>());
+}
+
+/** \ingroup SparseCore_Module
+ *
+ * The same as \a map.assemble(values, mat), computed on the threads of \a pool, or of a default pool if \a pool is
+ * null. Each thread assembles a contiguous range of nonzeros with about the same number of triplets.
+ *
+ * \sa SparseAssemblyMap
+ */
+template <typename SparseMatrixType, typename ValueIterator>
+void threadedAssemble(const SparseAssemblyMap<SparseMatrixType>& map, const ValueIterator& values,
+                      SparseMatrixType& mat, ThreadPool* pool = nullptr) {
+  ThreadPool* p = pool ? pool : &internal::default_threaded_sparse_pool();
+  const int threads = map.size() < internal::kSparseThreadingThreshold ? 1 : p->NumThreads();
+  map._assemble_impl(values, mat, threads, internal::thread_pool_parallel_run{p});
+}
+
+}  // namespace Eigen
+
+#endif  // EIGEN_THREADED_SPARSE_ASSEMBLY_H
@@ -23,30 +23,6 @@ inline ThreadPool& default_threaded_sparse_pool() {
   return pool;
 }
 
-// nnz-balanced partition of an outer range [0, outerSize) into numChunks
-// contiguous chunks. boundaries[t] = first outer index owned by partition t;
-// boundaries[numChunks] = outerSize.
-//
-// The split uses std::lower_bound on the outer-index array. Targets are
-// monotonically increasing in t, so each search starts from the previous
-// boundary; total work is bounded by O(numChunks + log outerSize) rather than
-// numChunks * log(outerSize). Each chunk's nnz count differs from the ideal by
-// at most max_nnz_per_outer.
-template <typename StorageIndex>
-inline void compute_nnz_balanced_partition(const StorageIndex* outer, Index outerSize, Index totalNnz, int numChunks,
-                                           std::vector<Index>& boundaries) {
-  boundaries.assign(numChunks + 1, 0);
-  boundaries[numChunks] = outerSize;
-  if (numChunks <= 1 || outerSize == 0 || totalNnz == 0) return;
-  const StorageIndex* const last = outer + outerSize + 1;
-  const StorageIndex* lo = outer;
-  for (int t = 1; t < numChunks; ++t) {
-    Index target = (static_cast<Index>(t) * totalNnz) / numChunks;
-    lo = std::lower_bound(lo, last, static_cast<StorageIndex>(target));
-    boundaries[t] = lo - outer;
-  }
-}
-
 // Single-row dot-product kernel. Used as the body of a per-row OpenMP
 // `parallel for` (which can do its own dynamic scheduling) and from within
 // run_dot_chunk for the ThreadPool dispatch path. Marked ALWAYS_INLINE so
@@ -98,8 +74,92 @@ EIGEN_STRONG_INLINE void run_dot_chunk(const Scalar* EIGEN_RESTRICT vals, const
   }
 }
 
+// Runs task(0), ..., task(threads-1) concurrently: task 0 on the calling thread, the others on the pool, like the
+// ThreadPool dispatch of ThreadedSparseProduct. Used by the parallel sparse * sparse product.
+struct thread_pool_parallel_run {
+  ThreadPool* pool;
+  template <typename Task>
+  void operator()(int threads, Task& task) const {
+    Barrier barrier(static_cast<unsigned>(threads));
+    for (int t = 1; t < threads; ++t) {
+      pool->Schedule([&task, &barrier, t]() {
+        task(t);
+        barrier.Notify();
+      });
+    }
+    task(0);
+    barrier.Notify();
+    barrier.Wait();
+  }
+};
+
 }  // namespace internal
 
+/** \ingroup SparseCore_Module
+ *
+ * Computes the sparse * sparse product \a res = \a lhs * \a rhs on the threads of \a pool, or of a default pool
+ * with one thread per hardware thread if \a pool is null.
+ *
+ * A symbolic pass first counts in parallel the nonzeros of each outer vector of \a res, from which its outer index
+ * array is built. A numeric pass then computes the outer vectors in parallel with one dense accumulator per thread,
+ * and writes them directly at their final position in the compressed arrays of \a res, with sorted inner indices.
+ * The threads take chunks of consecutive outer vectors dynamically, which balances irregular sparsity patterns.
+ * The result is the same as that of \c res \c = \c lhs*rhs, up to the rounding of the sums, and always compressed.
+ *
+ * Operands whose storage order differs from that of \a res are first copied to the storage order of \a res.
+ * Small products, below the threshold used by the other threaded sparse products, are computed serially.
+ *
+ * \warning \a res must not alias \a lhs or \a rhs.
+ *
+ * \sa ThreadedSparseProduct
+ */
+template <typename Lhs, typename Rhs, typename Scalar, int Options, typename StorageIndex>
+void threadedSparseSparseProduct(const SparseMatrixBase<Lhs>& lhs, const SparseMatrixBase<Rhs>& rhs,
+                                 SparseMatrix<Scalar, Options, StorageIndex>& res, ThreadPool* pool = nullptr) {
+  eigen_assert(lhs.cols() == rhs.rows() && "invalid matrix product");
+  using OperandType = SparseMatrix<Scalar, Options, StorageIndex>;
+  ThreadPool* p = pool ? pool : &internal::default_threaded_sparse_pool();
+  const int threads = p->NumThreads();
+  // Same serial-fallback threshold as ThreadedSparseProduct, on the same estimate as the serial product.
+  if (threads <= 1 || lhs.derived().nonZeros() + rhs.derived().nonZeros() < internal::kSparseThreadingThreshold) {
+    res = lhs.derived() * rhs.derived();
+    return;
+  }
+  // Binds without a copy when the operand is already a compressed matrix of the right type.
+  const Ref<const OperandType> lhsRef(lhs.derived()), rhsRef(rhs.derived());
+  const internal::evaluator<Ref<const OperandType>> lhsEval(lhsRef), rhsEval(rhsRef);
+  res.resize(lhs.rows(), rhs.cols());
+  // Row major operands and result compute the transposed product, column major by column major.
+  if (OperandType::IsRowMajor)
+    internal::parallel_conservative_sparse_sparse_product_impl(rhsEval, lhsEval, rhs.cols(), lhs.rows(), res, threads,
+                                                               internal::thread_pool_parallel_run{p});
+  else
+    internal::parallel_conservative_sparse_sparse_product_impl(lhsEval, rhsEval, lhs.rows(), rhs.cols(), res, threads,
+                                                               internal::thread_pool_parallel_run{p});
+}
+
+/** \ingroup SparseCore_Module
+ *
+ * Computes \a y = \a mat * \a x on the threads of \a pool, or of a default pool with one thread per hardware thread
+ * if \a pool is null. Each thread computes a contiguous range of slices of \a mat with about the same number of
+ * stored coefficients, by the nnz-balanced partition of ThreadedSparseProduct. Small products are computed
+ * serially.
+ *
+ * \warning \a x and \a y must not overlap.
+ *
+ * \sa SellMatrix
+ */
+template <typename Scalar, int SliceHeight, typename StorageIndex>
+void threadedSellProduct(const SellMatrix<Scalar, SliceHeight, StorageIndex>& mat,
+                         const Ref<const typename SellMatrix<Scalar, SliceHeight, StorageIndex>::DenseVector>& x,
+                         Ref<typename SellMatrix<Scalar, SliceHeight, StorageIndex>::DenseVector> y,
+                         ThreadPool* pool = nullptr) {
+  eigen_assert(x.size() == mat.cols() && y.size() == mat.rows() && "invalid matrix product");
+  ThreadPool* p = pool ? pool : &internal::default_threaded_sparse_pool();
+  y.setZero();
+  mat._apply_impl(x.data(), y.data(), Scalar(1), p->NumThreads(), internal::thread_pool_parallel_run{p});
+}
+
 /** \class ThreadedSparseProduct
  * \ingroup SparseCore_Module
  *
@@ -268,9 +328,6 @@ class ThreadedSparseProduct {
     }
   }
 
-  // Serial-fallback threshold; matches the same constant in SparseDenseProduct.h.
-  static constexpr Index kThreadingThreshold = 20000;
-
   template <bool Conjugate, bool Overwrite>
   void run(const Scalar* vals, const StorageIndex* inner, const StorageIndex* outer, const StorageIndex* innerNnz,
            Index outerSize, const std::vector<Index>& part, const ConstVectorRef& x, MutableVectorRef& y,
@@ -289,7 +346,7 @@ class ThreadedSparseProduct {
     // Ref construction already enforced unit inner stride for x/y.
     const Scalar* xp = x.data();
     Scalar* yp = y.data();
-    if (T <= 1 || total_nnz < kThreadingThreshold) {
+    if (T <= 1 || total_nnz < internal::kSparseThreadingThreshold) {
       internal::run_dot_chunk<Conjugate, Overwrite, Scalar, StorageIndex>(vals, inner, outer, innerNnz, xp, yp, 0,
                                                                           outerSize, alpha);
       return;
@@ -141,6 +141,99 @@ struct CoreThreadPoolDevice {
     barrier.Wait();
   }
 
+  // Runs f(begin, end) on consecutive chunks covering [begin, end) = [0, size), with chunk boundaries at multiples
+  // of granularity. As in calculateLevels, the number of chunks is bounded by the number of threads in the pool and
+  // by the total cost of the operation. Unlike parallelFor, the chunks are not further subdivided: this is meant for
+  // blocked kernels (e.g. matrix products) that have their own inner loops. Calls made from a thread of the pool run
+  // f(0, size) inline since waiting for the other chunks could starve the pool. The chunks run in a
+  // sequential_products_scope, so that the products they evaluate do not start threads beyond those of the pool.
+  template <typename BinaryFunctor>
+  void parallelForBlocks(Index size, Index granularity, float cost, BinaryFunctor& f) {
+    eigen_assert(granularity > 0 && "granularity must be positive");
+    const Index numBlocks = numext::div_ceil(size, granularity);
+    const float idealChunks = cost * m_costFactor;
+    Index numChunks = numext::mini<Index>(numBlocks, m_pool.NumThreads());
+    if (idealChunks < static_cast<float>(numChunks)) numChunks = static_cast<Index>(idealChunks);
+    auto chunk = [&f](Index begin, Index end) {
+      internal::sequential_products_scope sequential;
+      f(begin, end);
+    };
+    if (numChunks <= 1 || m_pool.CurrentThreadId() != -1) {
+      chunk(0, size);
+      return;
+    }
+    auto bound = [=](Index i) { return numext::mini(size, (i * numBlocks / numChunks) * granularity); };
+    Barrier barrier(static_cast<unsigned int>(numChunks - 1));
+    for (Index i = 1; i < numChunks; ++i) {
+      m_pool.Schedule([&chunk, &barrier, &bound, i]() {
+        chunk(bound(i), bound(i + 1));
+        barrier.Notify();
+      });
+    }
+    chunk(0, bound(1));
+    barrier.Wait();
+  }
+
+  // Runs the tasks 0, ..., graph.size()-1 of a dependency graph and returns once all of them have finished. The graph
+  // provides:
+  //   - dependencies(i): the number of tasks that must finish before task i can start,
+  //   - run(i): the work of task i,
+  //   - forEachSuccessor(i, f): calls f(j) once for each task j that depends on task i.
+  // When a task finishes, the first of its successors that becomes ready continues on the same thread and the others
+  // are scheduled on the pool, so the graph should list the successors on its critical path first (e.g. the next
+  // panel of a factorization, which gives lookahead). Calls made from a thread of the pool run all tasks inline. Like
+  // the chunks of parallelForBlocks, the tasks run in a sequential_products_scope.
+  template <typename TaskGraph>
+  void runTaskGraph(TaskGraph& graph) {
+    const Index numTasks = graph.size();
+    if (numTasks == 0) return;
+    std::unique_ptr<std::atomic<int>[]> pending(new std::atomic<int>[numTasks]);
+    std::vector<Index> ready;
+    for (Index i = 0; i < numTasks; ++i) {
+      const int deps = graph.dependencies(i);
+      pending[i].store(deps, std::memory_order_relaxed);
+      if (deps == 0) ready.push_back(i);
+    }
+    eigen_assert(!ready.empty() && "the task graph has a cycle");
+
+    if (m_pool.NumThreads() <= 1 || m_pool.CurrentThreadId() != -1) {
+      internal::sequential_products_scope sequential;
+      while (!ready.empty()) {
+        const Index task = ready.back();
+        ready.pop_back();
+        graph.run(task);
+        graph.forEachSuccessor(task, [&](Index successor) {
+          if (pending[successor].fetch_sub(1, std::memory_order_relaxed) == 1) ready.push_back(successor);
+        });
+      }
+      return;
+    }
+
+    Barrier barrier(static_cast<unsigned int>(numTasks));
+    std::function<void(Index)> worker = [&](Index task) {
+      internal::sequential_products_scope sequential;
+      while (task >= 0) {
+        graph.run(task);
+        Index next = -1;
+        graph.forEachSuccessor(task, [&](Index successor) {
+          if (pending[successor].fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+          if (next < 0)
+            next = successor;
+          else
+            m_pool.Schedule([&worker, successor]() { worker(successor); });
+        });
+        barrier.Notify();
+        task = next;
+      }
+    };
+    for (size_t i = 1; i < ready.size(); ++i) {
+      const Index task = ready[i];
+      m_pool.Schedule([&worker, task]() { worker(task); });
+    }
+    worker(ready[0]);
+    barrier.Wait();
+  }
+
   ThreadPool& m_pool;
   // costFactor is the cost of delegating a task to a thread
   // the inverse is used to avoid a floating point division
@@ -330,6 +423,182 @@ struct dense_assignment_loop_with_device<Kernel, CoreThreadPoolDevice, LinearVec
   }
 };
 
+// specialization of matrix products for CoreThreadPoolDevice
+
+// Evaluates the gemm functor of generic_product_impl<..., GemmProduct> on the threads of the device. Each chunk is
+// an independent sequential gemm with its own packing buffers, so no synchronization is needed between the tasks
+// and nested calls from another pool are safe. The result is split along the dimension that minimizes the amount of
+// repacking: splitting the columns repacks the lhs in every chunk, splitting the rows repacks the rhs.
+struct core_thread_pool_gemm_parallelizer {
+  CoreThreadPoolDevice& m_device;
+
+  template <typename GemmFunctor>
+  void operator()(const GemmFunctor& func, Index rows, Index cols, Index depth, bool transpose) const {
+    using Traits = typename GemmFunctor::Traits;
+    const float cost = static_cast<float>(rows) * static_cast<float>(cols) * static_cast<float>(depth);
+    if (rows <= cols) {
+      auto task = [&func, rows](Index begin, Index end) { func(0, rows, begin, end - begin); };
+      m_device.parallelForBlocks(cols, transpose ? Index(Traits::mr) : Index(Traits::nr), cost, task);
+    } else {
+      auto task = [&func, cols](Index begin, Index end) { func(begin, end - begin, 0, cols); };
+      m_device.parallelForBlocks(rows, transpose ? Index(Traits::nr) : Index(Traits::mr), cost, task);
+    }
+  }
+};
+
+// Scaling factor of a product for each assignment operator, after clearing the destination for plain assignments.
+template <typename Dst, typename Scalar, typename DstScalar, typename SrcScalar>
+Scalar device_product_prepare(Dst& dst, const assign_op<DstScalar, SrcScalar>&) {
+  dst.setZero();
+  return Scalar(1);
+}
+template <typename Dst, typename Scalar, typename DstScalar, typename SrcScalar>
+Scalar device_product_prepare(Dst&, const add_assign_op<DstScalar, SrcScalar>&) {
+  return Scalar(1);
+}
+template <typename Dst, typename Scalar, typename DstScalar, typename SrcScalar>
+Scalar device_product_prepare(Dst&, const sub_assign_op<DstScalar, SrcScalar>&) {
+  return Scalar(-1);
+}
+
+// By default, products are evaluated sequentially.
+template <typename Lhs, typename Rhs, typename LhsShape = typename evaluator_traits<Lhs>::Shape,
+          typename RhsShape = typename evaluator_traits<Rhs>::Shape, int ProductTag = product_type<Lhs, Rhs>::value>
+struct device_product_impl {
+  template <typename Dst, typename Functor>
+  static void run(Dst& dst, const Product<Lhs, Rhs, DefaultProduct>& src, const Functor& func,
+                  CoreThreadPoolDevice&) {
+    Assignment<Dst, Product<Lhs, Rhs, DefaultProduct>, Functor>::run(dst, src, func);
+  }
+};
+
+template <typename Lhs, typename Rhs>
+struct device_product_split_rhs;
+template <typename Lhs, typename Rhs>
+struct device_product_split_lhs;
+
+template <typename Lhs, typename Rhs>
+struct device_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemmProduct> {
+  using Impl = generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemmProduct>;
+  using Scalar = typename Impl::Scalar;
+
+  template <typename Dst, typename Functor>
+  static void run(Dst& dst, const Product<Lhs, Rhs, DefaultProduct>& src, const Functor& func,
+                  CoreThreadPoolDevice& device) {
+    // Fixed-size blockings use static packing buffers that cannot be shared between threads.
+    constexpr bool FixedBlocking = Dst::MaxRowsAtCompileTime != Dynamic && Dst::MaxColsAtCompileTime != Dynamic &&
+                                   int(Impl::MaxDepthAtCompileTime) != Dynamic;
+    if (FixedBlocking || Impl::useRuntimeCoeffBasedProduct(dst, src.rhs())) {
+      Assignment<Dst, Product<Lhs, Rhs, DefaultProduct>, Functor>::run(dst, src, func);
+      return;
+    }
+    // Runtime vectors are split as matrix-vector products, which the gemm functor would leave to parallelize_gemv.
+    if (dst.cols() == 1) {
+      using Col = typename Rhs::ConstColXpr;
+      auto dstCol = dst.col(0);
+      device_product_split_lhs<Lhs, Col>::run(dstCol, Product<Lhs, Col, DefaultProduct>(src.lhs(), src.rhs().col(0)),
+                                              func, device);
+      return;
+    }
+    if (dst.rows() == 1) {
+      using Row = typename Lhs::ConstRowXpr;
+      auto dstRow = dst.row(0);
+      device_product_split_rhs<Row, Rhs>::run(dstRow, Product<Row, Rhs, DefaultProduct>(src.lhs().row(0), src.rhs()),
+                                              func, device);
+      return;
+    }
+    const Scalar alpha = device_product_prepare<Dst, Scalar>(dst, func);
+    Impl::scaleAndAddTo(dst, src.lhs(), src.rhs(), alpha, core_thread_pool_gemm_parallelizer{device});
+  }
+};
+
+// Evaluates one chunk of a product split across the threads of the device. Matrix-vector chunks run the sequential
+// kernel, so that they do not start the threads of the OpenMP team or of the GEMM ThreadPool from the device threads.
+template <typename Lhs, typename Rhs, typename LhsShape = typename evaluator_traits<Lhs>::Shape,
+          typename RhsShape = typename evaluator_traits<Rhs>::Shape, int ProductTag = product_type<Lhs, Rhs>::value>
+struct device_product_chunk {
+  template <typename Dst, typename Scalar>
+  static void run(Dst& dst, const Lhs& lhs, const Rhs& rhs, const Scalar& alpha) {
+    generic_product_impl<Lhs, Rhs>::scaleAndAddTo(dst, lhs, rhs, alpha);
+  }
+};
+
+template <typename Lhs, typename Rhs>
+struct device_product_chunk<Lhs, Rhs, DenseShape, DenseShape, GemvProduct> {
+  template <typename Dst, typename Scalar>
+  static void run(Dst& dst, const Lhs& lhs, const Rhs& rhs, const Scalar& alpha) {
+    generic_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemvProduct>::scaleAndAddTo(dst, lhs, rhs, alpha, false);
+  }
+};
+
+// Products by a triangular or selfadjoint matrix: the columns of a dense rhs (resp. the rows of a dense lhs) are
+// independent and are split across the threads of the device.
+template <typename Lhs, typename Rhs>
+struct device_product_split_rhs {
+  using Scalar = typename Product<Lhs, Rhs, DefaultProduct>::Scalar;
+
+  template <typename Dst, typename Functor>
+  static void run(Dst& dst, const Product<Lhs, Rhs, DefaultProduct>& src, const Functor& func,
+                  CoreThreadPoolDevice& device) {
+    // The dense operand is evaluated once, so that each chunk only takes a block of it.
+    const Ref<const typename Rhs::PlainObject> rhs(src.rhs());
+    const Scalar alpha = device_product_prepare<Dst, Scalar>(dst, func);
+    auto task = [&](Index begin, Index end) {
+      auto rhsBlock = rhs.middleCols(begin, end - begin);
+      auto dstBlock = dst.middleCols(begin, end - begin);
+      device_product_chunk<Lhs, decltype(rhsBlock)>::run(dstBlock, src.lhs(), rhsBlock, alpha);
+    };
+    const float cost = static_cast<float>(src.lhs().rows()) * static_cast<float>(src.lhs().cols()) *
+                       static_cast<float>(rhs.cols());
+    device.parallelForBlocks(rhs.cols(), Index(gebp_traits<Scalar, Scalar>::nr), cost, task);
+  }
+};
+
+template <typename Lhs, typename Rhs>
+struct device_product_split_lhs {
+  using Scalar = typename Product<Lhs, Rhs, DefaultProduct>::Scalar;
+
+  template <typename Dst, typename Functor>
+  static void run(Dst& dst, const Product<Lhs, Rhs, DefaultProduct>& src, const Functor& func,
+                  CoreThreadPoolDevice& device) {
+    const Ref<const typename Lhs::PlainObject> lhs(src.lhs());
+    const Scalar alpha = device_product_prepare<Dst, Scalar>(dst, func);
+    auto task = [&](Index begin, Index end) {
+      auto lhsBlock = lhs.middleRows(begin, end - begin);
+      auto dstBlock = dst.middleRows(begin, end - begin);
+      device_product_chunk<decltype(lhsBlock), Rhs>::run(dstBlock, lhsBlock, src.rhs(), alpha);
+    };
+    const float cost = static_cast<float>(lhs.rows()) * static_cast<float>(src.rhs().rows()) *
+                       static_cast<float>(src.rhs().cols());
+    device.parallelForBlocks(lhs.rows(), Index(gebp_traits<Scalar, Scalar>::mr), cost, task);
+  }
+};
+
+// Matrix-vector products: the rows of the matrix (resp. its columns for a vector-matrix product) are split.
+template <typename Lhs, typename Rhs>
+struct device_product_impl<Lhs, Rhs, DenseShape, DenseShape, GemvProduct>
+    : std::conditional_t<Rhs::ColsAtCompileTime == 1, device_product_split_lhs<Lhs, Rhs>,
+                         device_product_split_rhs<Lhs, Rhs>> {};
+template <typename Lhs, typename Rhs, int ProductTag>
+struct device_product_impl<Lhs, Rhs, TriangularShape, DenseShape, ProductTag> : device_product_split_rhs<Lhs, Rhs> {};
+template <typename Lhs, typename Rhs, int ProductTag>
+struct device_product_impl<Lhs, Rhs, SelfAdjointShape, DenseShape, ProductTag> : device_product_split_rhs<Lhs, Rhs> {};
+template <typename Lhs, typename Rhs, int ProductTag>
+struct device_product_impl<Lhs, Rhs, DenseShape, TriangularShape, ProductTag> : device_product_split_lhs<Lhs, Rhs> {};
+template <typename Lhs, typename Rhs, int ProductTag>
+struct device_product_impl<Lhs, Rhs, DenseShape, SelfAdjointShape, ProductTag> : device_product_split_lhs<Lhs, Rhs> {};
+
+// dst.device(device).noalias() = lhs * rhs (and +=, -=)
+template <typename DstXprType, typename Lhs, typename Rhs, typename Functor, typename Weak>
+struct AssignmentWithDevice<DstXprType, Product<Lhs, Rhs, DefaultProduct>, Functor, CoreThreadPoolDevice, Dense2Dense,
+                            Weak> {
+  using SrcXprType = Product<Lhs, Rhs, DefaultProduct>;
+  static void run(DstXprType& dst, const SrcXprType& src, const Functor& func, CoreThreadPoolDevice& device) {
+    resize_if_allowed(dst, src, func);
+    device_product_impl<Lhs, Rhs>::run(dst, src, func, device);
+  }
+};
+
 }  // namespace internal
 
 }  // namespace Eigen
@@ -0,0 +1,330 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_MISC_ITERATIVE_REFINEMENT_H
+#define EIGEN_MISC_ITERATIVE_REFINEMENT_H
+
+// IWYU pragma: private
+#include "./InternalHeaderCheck.h"
+
+namespace Eigen {
+
+namespace internal {
+
+// The scalar type of the residuals of a refinement whose decomposition is computed with Scalar.
+template <typename Scalar>
+struct refinement_scalar {
+  using type = Scalar;
+};
+template <>
+struct refinement_scalar<float> {
+  using type = double;
+};
+template <>
+struct refinement_scalar<std::complex<float> > {
+  using type = std::complex<double>;
+};
+
+template <typename MatrixType>
+struct refinement_matrix {
+  using type = Matrix<typename refinement_scalar<typename MatrixType::Scalar>::type, MatrixType::RowsAtCompileTime,
+                      MatrixType::ColsAtCompileTime, traits<MatrixType>::Options, MatrixType::MaxRowsAtCompileTime,
+                      MatrixType::MaxColsAtCompileTime>;
+};
+
+// The decomposition of the same kind as Decomposition, but in the precision of the residuals.
+template <typename Decomposition>
+struct refinement_decomposition;
+template <typename MatrixType, typename PermutationIndex>
+struct refinement_decomposition<PartialPivLU<MatrixType, PermutationIndex> > {
+  using type = PartialPivLU<typename refinement_matrix<MatrixType>::type, PermutationIndex>;
+};
+template <typename MatrixType, int UpLo>
+struct refinement_decomposition<LLT<MatrixType, UpLo> > {
+  using type = LLT<typename refinement_matrix<MatrixType>::type, UpLo>;
+};
+template <typename MatrixType, int UpLo>
+struct refinement_decomposition<LDLT<MatrixType, UpLo> > {
+  using type = LDLT<typename refinement_matrix<MatrixType>::type, UpLo>;
+};
+
+template <typename Decomposition_>
+struct traits<IterativeRefinement<Decomposition_> >
+    : traits<typename refinement_decomposition<Decomposition_>::type::MatrixType> {
+  using XprKind = MatrixXpr;
+  using StorageKind = SolverStorage;
+  using StorageIndex = int;
+  enum { Flags = 0 };
+};
+
+}  // end namespace internal
+
+/** \ingroup LU_Module
+ *
+ * \class IterativeRefinement
+ *
+ * \brief Mixed-precision iterative refinement of the solutions of a dense decomposition
+ *
+ * \tparam Decomposition_ the decomposition computed in low precision: PartialPivLU, LLT or LDLT of a \c float or
+ * \c std::complex<float> matrix.
+ *
+ * This class factors a low precision copy of a matrix \b A, which is about twice as fast as a factorization in
+ * double precision, and recovers the accuracy of the double precision by iterative refinement:
+ * \f[
+ *  \mathbf{x}_{k+1} = \mathbf{x}_k + \mathbf{A}_{low}^{-1} (\mathbf{b} - \mathbf{A} \mathbf{x}_k),
+ * \f]
+ * where the residuals are computed in double precision (Higham, Accuracy and Stability of Numerical Algorithms,
+ * chapter 12). The matrix type of the class, that of \b A and of the right hand sides, is thus the double
+ * precision counterpart of the matrix type of \c Decomposition_.
+ *
+ * As in LAPACK's \c dsgesv, the iterations stop when, for every column,
+ * \f$ \| \mathbf{b} - \mathbf{A} \mathbf{x} \|_\infty \leq tol \, \| \mathbf{A} \|_\infty \| \mathbf{x} \|_\infty \f$.
+ * The refinement converges when \b A is not too ill-conditioned for the low precision, roughly
+ * \f$ \kappa(\mathbf{A}) \ll 1/\epsilon_{float} \f$. When the condition number estimated by the low precision
+ * decomposition is too large, or if the low precision factorization fails, compute() falls back to a factorization of
+ * \b A in double precision, which is then used by all the solves. The solves themselves never change the state of the
+ * class, so that they can run concurrently: a solve whose refinement does not converge, because it reached
+ * maxIterations() or its residual stopped decreasing, returns its iterate of smallest residual, which refinedSolve()
+ * reports, and computeFallback() switches to the double precision explicitly.
+ *
+ * Example:
+ * \code
+ * MatrixXd A = ...;
+ * VectorXd b = ...;
+ * IterativeRefinement<PartialPivLU<MatrixXf> > solver(A);
+ * VectorXd x;
+ * if (solver.refinedSolve(b, x) != Success) x = solver.computeFallback().solve(b);
+ * \endcode
+ *
+ * This class is available from both the LU and the Cholesky modules.
+ *
+ * \sa class PartialPivLU, class LLT, class LDLT
+ */
+template <typename Decomposition_>
+class IterativeRefinement : public SolverBase<IterativeRefinement<Decomposition_> > {
+ public:
+  using Decomposition = Decomposition_;
+  using FallbackDecomposition = typename internal::refinement_decomposition<Decomposition>::type;
+  using MatrixType = typename FallbackDecomposition::MatrixType;
+  using Base = SolverBase<IterativeRefinement>;
+  friend class SolverBase<IterativeRefinement>;
+
+  EIGEN_GENERIC_PUBLIC_INTERFACE(IterativeRefinement)
+  using LowScalar = typename Decomposition::Scalar;
+  using LowRealScalar = typename NumTraits<LowScalar>::Real;
+
+  /** \brief Default Constructor.
+   *
+   * The default constructor is useful in cases in which the user intends to
+   * perform decompositions via IterativeRefinement::compute(const MatrixType&).
+   */
+  IterativeRefinement()
+      : m_matrixNorm(0),
+        m_tolerance(-1),
+        m_maxIterations(30),
+        m_info(Success),
+        m_useFallback(false),
+        m_isInitialized(false) {}
+
+  /** Constructor.
+   *
+   * \param matrix the matrix \b A of the systems to solve, in double precision.
+   */
+  template <typename InputType>
+  explicit IterativeRefinement(const EigenBase<InputType>& matrix) : IterativeRefinement() {
+    compute(matrix.derived());
+  }
+
+  /** Keeps a copy of \a matrix for the residuals, and computes the decomposition of its low precision copy, or that
+   * of \a matrix in double precision if the low precision cannot solve the systems of \a matrix. */
+  template <typename InputType>
+  IterativeRefinement& compute(const EigenBase<InputType>& matrix);
+
+  /** Computes the decomposition of \b A in double precision, which all the following solves use instead of the
+   * refinement, until the next call to compute(). */
+  IterativeRefinement& computeFallback() {
+    eigen_assert(m_isInitialized && "IterativeRefinement is not initialized.");
+    if (!m_useFallback) fallback();
+    return *this;
+  }
+
+  /** Solves \b A \a x = \a b like solve(), and \returns \c Success if the solution of every column reached the
+   * tolerance, or \c NoConvergence if the refinement stopped at maxIterations() or its residual stopped decreasing, in
+   * which case \a x holds its iterate of smallest residual. The number of refinement steps is written to \a iterations
+   * when it is not null.
+   */
+  template <typename Rhs, typename Dest>
+  ComputationInfo refinedSolve(const MatrixBase<Rhs>& b, MatrixBase<Dest>& x, Index* iterations = nullptr) const {
+    eigen_assert(m_isInitialized && "IterativeRefinement is not initialized.");
+    eigen_assert(rows() == b.rows() && "IterativeRefinement::refinedSolve(): invalid number of rows of the rhs");
+    Index iters = 0;
+    bool converged = true;
+    if (m_useFallback)
+      x = m_fallbackDecomposition.solve(b);
+    else
+      converged = refine(b.derived(), x.derived(), iters);
+    if (iterations) *iterations = iters;
+    return converged ? Success : NoConvergence;
+  }
+
+  /** \returns the tolerance of the stopping criterion.
+   * It is either the value set by setTolerance(), or by default \f$ \sqrt{n} \f$ times the machine precision of
+   * \c Scalar, as in LAPACK.
+   */
+  RealScalar tolerance() const {
+    using std::sqrt;
+    return m_tolerance < RealScalar(0) ? sqrt(RealScalar(cols())) * NumTraits<Scalar>::epsilon() : m_tolerance;
+  }
+
+  /** Sets the tolerance of the stopping criterion. */
+  IterativeRefinement& setTolerance(const RealScalar& tolerance) {
+    m_tolerance = tolerance;
+    return *this;
+  }
+
+  /** \returns the maximum number of refinement steps of a solve, 30 by default. */
+  Index maxIterations() const { return m_maxIterations; }
+
+  /** Sets the maximum number of refinement steps of a solve, after which it stops with its iterate of smallest
+   * residual. */
+  IterativeRefinement& setMaxIterations(Index maxIters) {
+    m_maxIterations = maxIters;
+    return *this;
+  }
+
+  /** \returns whether the solves use the factorization in double precision, because compute() found the low
+   * precision unable to solve the systems of \b A, or computeFallback() was called. */
+  bool usesFallback() const {
+    eigen_assert(m_isInitialized && "IterativeRefinement is not initialized.");
+    return m_useFallback;
+  }
+
+  /** \returns the low precision decomposition */
+  const Decomposition& decomposition() const {
+    eigen_assert(m_isInitialized && "IterativeRefinement is not initialized.");
+    return m_decomposition;
+  }
+
+  /** \returns the double precision decomposition, which is only computed if usesFallback() */
+  const FallbackDecomposition& fallbackDecomposition() const {
+    eigen_assert(m_isInitialized && "IterativeRefinement is not initialized.");
+    return m_fallbackDecomposition;
+  }
+
+  /** \brief Reports whether the decomposition was successful.
+   *
+   * \returns \c Success, or the status of the double precision decomposition if usesFallback().
+   */
+  ComputationInfo info() const {
+    eigen_assert(m_isInitialized && "IterativeRefinement is not initialized.");
+    return m_info;
+  }
+
+  inline Index rows() const { return m_matrix.rows(); }
+  inline Index cols() const { return m_matrix.cols(); }
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+  template <typename RhsType, typename DstType>
+  void _solve_impl(const RhsType& rhs, DstType& dst) const;
+#endif
+
+ protected:
+  EIGEN_STATIC_ASSERT_NON_INTEGER(Scalar)
+
+  void fallback() {
+    m_fallbackDecomposition.compute(m_matrix);
+    m_info = m_fallbackDecomposition.info();
+    m_useFallback = true;
+  }
+
+  template <typename RhsType, typename DstType>
+  bool refine(const RhsType& rhs, DstType& dst, Index& iterations) const;
+
+  MatrixType m_matrix;
+  RealScalar m_matrixNorm;
+  Decomposition m_decomposition;
+  FallbackDecomposition m_fallbackDecomposition;
+  RealScalar m_tolerance;
+  Index m_maxIterations;
+  ComputationInfo m_info;
+  bool m_useFallback;
+  bool m_isInitialized;
+};
+
+template <typename Decomposition>
+template <typename InputType>
+IterativeRefinement<Decomposition>& IterativeRefinement<Decomposition>::compute(const EigenBase<InputType>& matrix) {
+  m_matrix = matrix.derived();
+  m_matrixNorm = m_matrix.size() == 0 ? RealScalar(0) : m_matrix.cwiseAbs().rowwise().sum().maxCoeff();
+  m_info = Success;
+  m_useFallback = false;
+  m_isInitialized = true;
+
+  // Like dsgesv, do not even try when the matrix overflows in low precision.
+  if (!(m_matrixNorm <= RealScalar(NumTraits<LowRealScalar>::highest()))) {
+    fallback();
+    return *this;
+  }
+  m_decomposition.compute(m_matrix.template cast<LowScalar>());
+  if (m_decomposition.info() != Success) {
+    fallback();
+    return *this;
+  }
+  // The refinement contracts the error by about kappa(A) * epsilon of the low precision at each step, so give up
+  // beforehand on the matrices for which this is not well below 1, as estimated from the low precision decomposition.
+  if (m_matrix.size() > 0 && !(m_decomposition.rcond() >= LowRealScalar(16) * NumTraits<LowRealScalar>::epsilon()))
+    fallback();
+  return *this;
+}
+
+#ifndef EIGEN_PARSED_BY_DOXYGEN
+template <typename Decomposition_>
+template <typename RhsType, typename DstType>
+void IterativeRefinement<Decomposition_>::_solve_impl(const RhsType& rhs, DstType& dst) const {
+  Index iterations = 0;
+  if (m_useFallback)
+    dst = m_fallbackDecomposition.solve(rhs);
+  else
+    refine(rhs, dst, iterations);
+}
+
+template <typename Decomposition_>
+template <typename RhsType, typename DstType>
+bool IterativeRefinement<Decomposition_>::refine(const RhsType& rhs, DstType& dst, Index& iterations) const {
+  iterations = 0;
+  if (rows() == 0) return true;
+  const RealScalar threshold = tolerance() * m_matrixNorm;
+  dst = m_decomposition.solve(rhs.template cast<LowScalar>()).template cast<Scalar>();
+  typename RhsType::PlainObject residual, best;
+  RealScalar bestNorm = NumTraits<RealScalar>::infinity();
+  while (true) {
+    residual = rhs;
+    residual.noalias() -= m_matrix * dst;
+    // A residual which does not decrease, or is not finite, means that the refinement diverges or stagnates: it
+    // stops with the iterate of smallest residual.
+    const RealScalar residualNorm = residual.cwiseAbs().maxCoeff();
+    if (!(residualNorm < bestNorm)) {
+      if (iterations > 0) dst = best;
+      return false;
+    }
+    if ((residual.cwiseAbs().colwise().maxCoeff().array() <= threshold * dst.cwiseAbs().colwise().maxCoeff().array())
+            .all())
+      return true;
+    if (iterations == m_maxIterations) return false;
+    bestNorm = residualNorm;
+    best = dst;
+    dst += m_decomposition.solve(residual.template cast<LowScalar>()).template cast<Scalar>();
+    ++iterations;
+  }
+}
+#endif
+
+}  // end namespace Eigen
+
+#endif  // EIGEN_MISC_ITERATIVE_REFINEMENT_H
@@ -4,6 +4,10 @@
 #include <benchmark/benchmark.h>
 #include <Eigen/Core>
 #include <Eigen/Cholesky>
+#include <Eigen/ThreadPool>
+
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
@@ -53,3 +57,50 @@ static void BM_LLT(benchmark::State& state) {
       benchmark::Counter(cost, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
 }
 BENCHMARK(BM_LLT)->RangeMultiplier(2)->Range(4, 1500);
+
+// A double precision solve through a float LLT refined in double, against a plain double LLT.
+template <bool Refine>
+static void BM_LLT_ComputeSolve_double(benchmark::State& state) {
+  int n = state.range(0);
+  typedef Matrix<double, Dynamic, Dynamic> MatrixType;
+  MatrixType a = MatrixType::Random(n, n);
+  MatrixType covMat = a * a.adjoint() / double(n) + MatrixType::Identity(n, n);
+  MatrixType b = MatrixType::Random(n, 1), x(n, 1);
+  typename std::conditional<Refine, IterativeRefinement<LLT<MatrixXf>>, LLT<MatrixType>>::type solver;
+  for (auto _ : state) {
+    solver.compute(covMat);
+    x = solver.solve(b);
+    benchmark::DoNotOptimize(x.data());
+  }
+}
+BENCHMARK(BM_LLT_ComputeSolve_double<false>)->RangeMultiplier(2)->Range(64, 2048)->Name("LLT_ComputeSolve_double");
+BENCHMARK(BM_LLT_ComputeSolve_double<true>)->RangeMultiplier(2)->Range(64, 2048)->Name("LLT_ComputeSolve_double_Refinement");
+
+// Tiled LLT on a CoreThreadPoolDevice: the last argument is the number of threads of the pool.
+static void BM_LLT_Tiled(benchmark::State& state) {
+  int n = state.range(0);
+  typedef Matrix<Scalar, Dynamic, Dynamic> MatrixType;
+  MatrixType a = MatrixType::Random(n, n);
+  MatrixType covMat = a * a.adjoint();
+  covMat.diagonal().array() += Scalar(n);
+  ThreadPool pool(static_cast<int>(state.range(1)));
+  CoreThreadPoolDevice device(pool);
+  Scalar acc = 0;
+  for (auto _ : state) {
+    LLT<MatrixType> chol(covMat, device);
+    acc += chol.matrixL().coeff(n - 1, 0);
+    benchmark::DoNotOptimize(acc);
+  }
+  state.counters["GFLOPS"] = benchmark::Counter(double(n) * n * n / 3, benchmark::Counter::kIsIterationInvariantRate,
+                                                benchmark::Counter::kIs1000);
+}
+
+static void TiledSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"n", "threads"});
+  const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int n : {1024, 4096, 8192}) {
+    for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({n, threads});
+    b->Args({n, maxThreads});
+  }
+}
+BENCHMARK(BM_LLT_Tiled)->Apply(TiledSizes)->UseRealTime();
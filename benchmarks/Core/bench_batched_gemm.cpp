@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include <benchmark/benchmark.h>
+#include <Eigen/Core>
+
+using namespace Eigen;
+
+#ifndef SCALAR
+#define SCALAR float
+#endif
+
+typedef SCALAR Scalar;
+typedef Matrix<Scalar, Dynamic, Dynamic> Mat;
+typedef Map<Mat> MatMap;
+typedef Map<const Mat> ConstMatMap;
+
+// Batch of n x n products stored back to back, as produced by e.g. per-request tensors.
+struct Batch {
+  Batch(Index n_, Index count_)
+      : n(n_), count(count_), a(Mat::Random(n, n * count)), b(Mat::Random(n, n * count)), c(n, n * count) {}
+  Index n, count;
+  Mat a, b, c;
+};
+
+// Baseline: one dynamic-size GEMM per matrix.
+static void BM_LoopGemm(benchmark::State& state) {
+  Batch batch(state.range(0), state.range(1));
+  const Index n = batch.n;
+  for (auto _ : state) {
+    for (Index i = 0; i < batch.count; ++i) {
+      MatMap(batch.c.data() + i * n * n, n, n).noalias() =
+          ConstMatMap(batch.a.data() + i * n * n, n, n) * ConstMatMap(batch.b.data() + i * n * n, n, n);
+    }
+    benchmark::DoNotOptimize(batch.c.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["GFLOPS"] =
+      benchmark::Counter(2.0 * n * n * n * batch.count, benchmark::Counter::kIsIterationInvariantRate,
+                         benchmark::Counter::kIs1000);
+}
+
+static void BM_BatchedGemm(benchmark::State& state) {
+  Batch batch(state.range(0), state.range(1));
+  const Index n = batch.n;
+  for (auto _ : state) {
+    batchedProduct(ConstMatMap(batch.a.data(), n, n), ConstMatMap(batch.b.data(), n, n), MatMap(batch.c.data(), n, n),
+                   batch.count, n * n, n * n, n * n);
+    benchmark::DoNotOptimize(batch.c.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["GFLOPS"] =
+      benchmark::Counter(2.0 * n * n * n * batch.count, benchmark::Counter::kIsIterationInvariantRate,
+                         benchmark::Counter::kIs1000);
+}
+
+// Shared lhs (e.g. a weight matrix) applied to a batch of inputs.
+static void BM_BatchedGemmSharedLhs(benchmark::State& state) {
+  Batch batch(state.range(0), state.range(1));
+  const Index n = batch.n;
+  for (auto _ : state) {
+    batchedProduct(ConstMatMap(batch.a.data(), n, n), ConstMatMap(batch.b.data(), n, n), MatMap(batch.c.data(), n, n),
+                   batch.count, 0, n * n, n * n);
+    benchmark::DoNotOptimize(batch.c.data());
+    benchmark::ClobberMemory();
+  }
+  state.counters["GFLOPS"] =
+      benchmark::Counter(2.0 * n * n * n * batch.count, benchmark::Counter::kIsIterationInvariantRate,
+                         benchmark::Counter::kIs1000);
+}
+
+static void BatchSizes(benchmark::internal::Benchmark* b) {
+  for (int n : {8, 12, 16, 24, 32, 48, 64}) b->Args({n, 4096});
+}
+
+BENCHMARK(BM_LoopGemm)->Apply(BatchSizes);
+BENCHMARK(BM_BatchedGemm)->Apply(BatchSizes);
+BENCHMARK(BM_BatchedGemmSharedLhs)->Apply(BatchSizes);
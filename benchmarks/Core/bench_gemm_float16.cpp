@@ -0,0 +1,75 @@
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+// GEMM with bfloat16/half inputs and float accumulation, C = A.cast<float>() * B.cast<float>(),
+// compared to the same product on float copies of the inputs. The 16-bit operands are widened
+// while being packed, so the cast product should run at about the float GEMM rate while reading
+// half of the input bytes, and without the cost of the conversion temporaries (BM_ConvertThenGemm).
+
+#include <benchmark/benchmark.h>
+#include <Eigen/Core>
+
+using namespace Eigen;
+
+typedef Matrix<float, Dynamic, Dynamic> MatF;
+
+static void setCounters(benchmark::State& state, Index m, Index k, Index n) {
+  state.counters["GFLOPS"] = benchmark::Counter(2.0 * m * k * n, benchmark::Counter::kIsIterationInvariantRate,
+                                                benchmark::Counter::kIs1000);
+}
+
+template <typename Half>
+static void BM_CastGemm(benchmark::State& state) {
+  typedef Matrix<Half, Dynamic, Dynamic> MatH;
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  MatH a = MatF::Random(m, k).cast<Half>(), b = MatF::Random(k, n).cast<Half>();
+  MatF c(m, n);
+  for (auto _ : state) {
+    c.noalias() = a.template cast<float>() * b.template cast<float>();
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, m, k, n);
+}
+
+// What the cast product amounts to without the packing conversion: explicit float copies first.
+template <typename Half>
+static void BM_ConvertThenGemm(benchmark::State& state) {
+  typedef Matrix<Half, Dynamic, Dynamic> MatH;
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  MatH a = MatF::Random(m, k).cast<Half>(), b = MatF::Random(k, n).cast<Half>();
+  MatF af(m, k), bf(k, n), c(m, n);
+  for (auto _ : state) {
+    af = a.template cast<float>();
+    bf = b.template cast<float>();
+    c.noalias() = af * bf;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, m, k, n);
+}
+
+static void BM_FloatGemm(benchmark::State& state) {
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  MatF a = MatF::Random(m, k), b = MatF::Random(k, n), c(m, n);
+  for (auto _ : state) {
+    c.noalias() = a * b;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, m, k, n);
+}
+
+static void GemmSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"m", "k", "n"});
+  for (int s : {64, 128, 256, 512, 1024}) b->Args({s, s, s});
+  // Skinny products, where streaming the operands dominates.
+  b->Args({4096, 256, 64});
+  b->Args({64, 4096, 64});
+}
+
+BENCHMARK(BM_CastGemm<bfloat16>)->Apply(GemmSizes);
+BENCHMARK(BM_CastGemm<half>)->Apply(GemmSizes);
+BENCHMARK(BM_ConvertThenGemm<bfloat16>)->Apply(GemmSizes);
+BENCHMARK(BM_ConvertThenGemm<half>)->Apply(GemmSizes);
+BENCHMARK(BM_FloatGemm)->Apply(GemmSizes);
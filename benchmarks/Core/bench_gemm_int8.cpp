@@ -0,0 +1,76 @@
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+// int8 x int8 -> int32 GEMM, C = A.cast<int>() * B.cast<int>(), and its dequantized variant quantizedProduct(),
+// compared to a float GEMM of the same size. Build with -march=native (or -mavx512vnni, -mavxvnni,
+// -march=armv8.2-a+dotprod) to use the dot-product instructions; the portable kernel is used otherwise.
+//
+// Args: m, k, n.
+
+#include <benchmark/benchmark.h>
+#include <Eigen/Core>
+
+using namespace Eigen;
+
+typedef Matrix<int8_t, Dynamic, Dynamic> MatI8;
+typedef Matrix<int8_t, Dynamic, Dynamic, RowMajor> RowMatI8;
+
+static void setCounters(benchmark::State& state, Index m, Index k, Index n) {
+  state.counters["GOPS"] = benchmark::Counter(2.0 * m * k * n, benchmark::Counter::kIsIterationInvariantRate,
+                                              benchmark::Counter::kIs1000);
+}
+
+static MatI8 randomInt8(Index rows, Index cols) {
+  return (MatrixXf::Random(rows, cols) * 127.f).cast<int8_t>();
+}
+
+static void BM_Int8Gemm(benchmark::State& state) {
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  MatI8 a = randomInt8(m, k), b = randomInt8(k, n);
+  MatrixXi c(m, n);
+  for (auto _ : state) {
+    c.noalias() = a.cast<int>() * b.cast<int>();
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, m, k, n);
+}
+
+// Row-major weights times column-major activations: both operands are contiguous along the depth.
+static void BM_QuantizedProduct(benchmark::State& state) {
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  RowMatI8 a = randomInt8(m, k);
+  MatI8 b = randomInt8(k, n);
+  VectorXi za = VectorXi::Zero(m), zb = VectorXi::Constant(n, 3);
+  VectorXf sa = VectorXf::Constant(m, 0.01f), sb = VectorXf::Constant(n, 0.02f);
+  MatrixXf c(m, n);
+  for (auto _ : state) {
+    quantizedProduct(a, za, sa, b, zb, sb, c);
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, m, k, n);
+}
+
+static void BM_FloatGemm(benchmark::State& state) {
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  MatrixXf a = MatrixXf::Random(m, k), b = MatrixXf::Random(k, n), c(m, n);
+  for (auto _ : state) {
+    c.noalias() = a * b;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  setCounters(state, m, k, n);
+}
+
+static void GemmSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"m", "k", "n"});
+  for (int s : {64, 128, 256, 512, 1024, 2048}) b->Args({s, s, s});
+  // Fully connected layers with a small batch.
+  b->Args({1024, 1024, 16});
+  b->Args({4096, 1024, 64});
+}
+
+BENCHMARK(BM_Int8Gemm)->Apply(GemmSizes);
+BENCHMARK(BM_QuantizedProduct)->Apply(GemmSizes);
+BENCHMARK(BM_FloatGemm)->Apply(GemmSizes);
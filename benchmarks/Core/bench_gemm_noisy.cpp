@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+// Multi-threaded GEMM latency with and without competing load on the machine.
+//
+// A set of background threads alternates busy and idle periods to mimic co-tenants, so that the GEMM threads get
+// preempted at random points. The static schedule of parallelize_gemm waits for the slowest thread at every depth
+// block, while the dynamic schedule (setGemmDynamicScheduling) lets the other threads take over its tiles. Besides
+// the mean time, the p50/p99/max latencies of the individual products are reported.
+//
+// Args: matrix size, dynamic scheduling (0/1), number of background threads.
+
+#define EIGEN_GEMM_THREADPOOL
+#include <benchmark/benchmark.h>
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace Eigen;
+
+#ifndef SCALAR
+#define SCALAR float
+#endif
+
+typedef SCALAR Scalar;
+typedef Matrix<Scalar, Dynamic, Dynamic> Mat;
+
+namespace {
+
+int numGemmThreads() { return std::max(2, static_cast<int>(std::thread::hardware_concurrency())); }
+
+ThreadPool& gemmPool() {
+  static ThreadPool pool(numGemmThreads());
+  return pool;
+}
+
+// Spins for about 2ms, then sleeps for a random 0-2ms, until destroyed.
+class NoisyNeighbors {
+ public:
+  explicit NoisyNeighbors(int count) {
+    for (int i = 0; i < count; ++i) {
+      m_threads.emplace_back([this, i]() {
+        unsigned state = 12345u + i;
+        volatile double sink = 0;
+        while (!m_stop.load(std::memory_order_relaxed)) {
+          const auto busyEnd = std::chrono::steady_clock::now() + std::chrono::milliseconds(2);
+          while (std::chrono::steady_clock::now() < busyEnd) sink = sink + 1.0;
+          state = state * 1664525u + 1013904223u;
+          std::this_thread::sleep_for(std::chrono::microseconds((state >> 8) % 2000));
+        }
+      });
+    }
+  }
+  ~NoisyNeighbors() {
+    m_stop = true;
+    for (auto& t : m_threads) t.join();
+  }
+
+ private:
+  std::atomic<bool> m_stop{false};
+  std::vector<std::thread> m_threads;
+};
+
+double percentile(std::vector<double> v, double p) {
+  std::sort(v.begin(), v.end());
+  return v[std::min(v.size() - 1, static_cast<size_t>(p * v.size()))];
+}
+
+}  // namespace
+
+static void BM_GemmNoisy(benchmark::State& state) {
+  const Index n = state.range(0);
+  const bool dynamic = state.range(1) != 0;
+  const int noise = static_cast<int>(state.range(2));
+  setGemmThreadPool(&gemmPool());
+  setGemmDynamicScheduling(dynamic);
+
+  Mat a = Mat::Random(n, n), b = Mat::Random(n, n), c(n, n);
+  NoisyNeighbors neighbors(noise);
+  std::vector<double> times;
+  for (auto _ : state) {
+    const auto start = std::chrono::steady_clock::now();
+    c.noalias() = a * b;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+    times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+  }
+  setGemmDynamicScheduling(false);
+
+  state.counters["p50_ms"] = percentile(times, 0.5);
+  state.counters["p99_ms"] = percentile(times, 0.99);
+  state.counters["max_ms"] = *std::max_element(times.begin(), times.end());
+  state.counters["GFLOPS"] =
+      benchmark::Counter(2.0 * n * n * n, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
+}
+
+static void NoisyArgs(benchmark::internal::Benchmark* b) {
+  const int threads = numGemmThreads();
+  for (int n : {1024, 2048, 4096})
+    for (int noise : {0, threads / 2, threads})
+      for (int dynamic : {0, 1}) b->Args({n, dynamic, noise});
+}
+
+BENCHMARK(BM_GemmNoisy)->Apply(NoisyArgs)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -18,12 +18,20 @@
 //   GemvTrans  y += A^T * x         -> RowMajor kernel, no conjugation
 //   GemvConj   y += conj(A) * x     -> ColMajor kernel, ConjugateLhs=true
 //   GemvAdj    y += A^H * x         -> RowMajor kernel, ConjugateLhs=true
+//
+// The GemvThreads and GemvTransThreads variants split large products across
+// the threads of the GEMM ThreadPool (see parallelize_gemv); their last
+// argument is the number of threads passed to setNbThreads.
 // SPDX-FileCopyrightText: The Eigen Authors
 // SPDX-License-Identifier: MPL-2.0
 
+#define EIGEN_GEMM_THREADPOOL
 #include <benchmark/benchmark.h>
 #include <Eigen/Core>
 
+#include <algorithm>
+#include <thread>
+
 using namespace Eigen;
 
 // ---------- Benchmark helpers ----------
@@ -114,6 +122,50 @@ static void BM_GemvAdj(benchmark::State& state) {
                                                 benchmark::Counter::kIs1000);
 }
 
+// ---------- y += op(A) * x on 1..N threads ----------
+
+static int maxGemvThreads() { return std::max(2, static_cast<int>(std::thread::hardware_concurrency())); }
+
+static ThreadPool& gemvPool() {
+  static ThreadPool pool(maxGemvThreads());
+  return pool;
+}
+
+template <typename Scalar, bool Transpose>
+static void BM_GemvThreaded(benchmark::State& state) {
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  const Index m = state.range(0);
+  const Index n = state.range(1);
+  setGemmThreadPool(&gemvPool());
+  setNbThreads(static_cast<int>(state.range(2)));
+  Mat A = Mat::Random(m, n);
+  Vec x = Vec::Random(Transpose ? m : n);
+  Vec y = Vec::Random(Transpose ? n : m);
+  for (auto _ : state) {
+    if (Transpose)
+      y.noalias() += A.transpose() * x;
+    else
+      y.noalias() += A * x;
+    benchmark::DoNotOptimize(y.data());
+    benchmark::ClobberMemory();
+  }
+  // The other benchmarks are single-threaded.
+  setNbThreads(1);
+  state.counters["GFLOPS"] = benchmark::Counter(gemvFlops<Scalar>(m, n), benchmark::Counter::kIsIterationInvariantRate,
+                                                benchmark::Counter::kIs1000);
+}
+
+static void GemvThreadedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"m", "n", "threads"});
+  for (int threads = 1; threads <= maxGemvThreads(); threads *= 2) {
+    // Square, from L2-resident to memory-bound; tall-thin; short-wide (few row blocks to split).
+    for (int s : {256, 1024, 4096, 8192}) b->Args({s, s, threads});
+    b->Args({65536, 64, threads});
+    b->Args({256, 65536, threads});
+  }
+}
+
 // ---------- Size configurations ----------
 // All sizes refer to the stored matrix A (m rows, n cols).
 
@@ -145,4 +197,10 @@ BENCHMARK(BM_GemvConj<std::complex<float>>) GEMV_SIZES ->Name("GemvConj_cfloat")
 BENCHMARK(BM_GemvAdj<std::complex<float>>) GEMV_SIZES ->Name("GemvAdj_cfloat");
 
 #undef GEMV_SIZES
+
+// Threaded variants of the col-major (axpy) and row-major (dot) kernels.
+BENCHMARK(BM_GemvThreaded<float, false>)->Apply(GemvThreadedSizes)->Name("GemvThreads_float")->UseRealTime();
+BENCHMARK(BM_GemvThreaded<float, true>)->Apply(GemvThreadedSizes)->Name("GemvTransThreads_float")->UseRealTime();
+BENCHMARK(BM_GemvThreaded<double, false>)->Apply(GemvThreadedSizes)->Name("GemvThreads_double")->UseRealTime();
+BENCHMARK(BM_GemvThreaded<double, true>)->Apply(GemvThreadedSizes)->Name("GemvTransThreads_double")->UseRealTime();
 // clang-format on
@@ -8,6 +8,9 @@
 #include <Eigen/QR>
 #include <Eigen/SVD>
 #include <Eigen/Eigenvalues>
+#include <Eigen/Geometry>
+
+#include <vector>
 
 using namespace Eigen;
 
@@ -222,6 +225,140 @@ static void BM_SelfAdjointEig_ComputeDirect(benchmark::State& state) {
   }
 }
 
+// ============================================================================
+// Batched decompositions — one SIMD lane per matrix, compared to a loop over
+// the same batch. Both report one item per matrix.
+// ============================================================================
+
+static const Index kBatch = 4096;
+
+// A structure-of-arrays batch of SPD matrices (field i + j * N holds the coefficient (i, j)), and the same matrices
+// one after the other.
+template <typename Scalar, int N>
+static void make_spd_batch(Matrix<Scalar, Dynamic, N * N>& soa,
+                           std::vector<Matrix<Scalar, N, N>, aligned_allocator<Matrix<Scalar, N, N>>>& aos) {
+  soa.resize(kBatch, N * N);
+  aos.resize(kBatch);
+  for (Index b = 0; b < kBatch; ++b) {
+    Matrix<Scalar, N, N> a = Matrix<Scalar, N, N>::Random();
+    aos[b] = a.transpose() * a + Matrix<Scalar, N, N>::Identity();
+    soa.row(b) = aos[b].reshaped().transpose();
+  }
+}
+
+template <typename Scalar, int N>
+static void BM_LLT_Loop(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, N * N> soa;
+  std::vector<Matrix<Scalar, N, N>, aligned_allocator<Matrix<Scalar, N, N>>> aos;
+  make_spd_batch(soa, aos);
+  LLT<Matrix<Scalar, N, N>> llt;
+  for (auto _ : state) {
+    for (Index b = 0; b < kBatch; ++b) {
+      llt.compute(aos[b]);
+      benchmark::DoNotOptimize(&llt);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar, int N>
+static void BM_LLT_Batched(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, N * N> soa;
+  std::vector<Matrix<Scalar, N, N>, aligned_allocator<Matrix<Scalar, N, N>>> aos;
+  make_spd_batch(soa, aos);
+  Matrix<Scalar, Dynamic, N * N> factors(kBatch, N * N);
+  for (auto _ : state) {
+    factors = soa;
+    benchmark::DoNotOptimize(batchedLLT<N>(factors));
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar, int N>
+static void BM_PartialPivLU_Loop(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, N * N> soa;
+  std::vector<Matrix<Scalar, N, N>, aligned_allocator<Matrix<Scalar, N, N>>> aos;
+  make_spd_batch(soa, aos);
+  PartialPivLU<Matrix<Scalar, N, N>> lu;
+  for (auto _ : state) {
+    for (Index b = 0; b < kBatch; ++b) {
+      lu.compute(aos[b]);
+      benchmark::DoNotOptimize(lu.matrixLU().data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar, int N>
+static void BM_PartialPivLU_Batched(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, N * N> soa;
+  std::vector<Matrix<Scalar, N, N>, aligned_allocator<Matrix<Scalar, N, N>>> aos;
+  make_spd_batch(soa, aos);
+  Matrix<Scalar, Dynamic, N * N> factors(kBatch, N * N);
+  Matrix<int, Dynamic, N> transpositions(kBatch, N);
+  for (auto _ : state) {
+    factors = soa;
+    batchedPartialPivLU<N>(factors, transpositions);
+    benchmark::DoNotOptimize(factors.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar>
+static void BM_SelfAdjointEig3_Loop(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, 9> soa;
+  std::vector<Matrix<Scalar, 3, 3>, aligned_allocator<Matrix<Scalar, 3, 3>>> aos;
+  make_spd_batch(soa, aos);
+  SelfAdjointEigenSolver<Matrix<Scalar, 3, 3>> eig;
+  for (auto _ : state) {
+    for (Index b = 0; b < kBatch; ++b) {
+      eig.computeDirect(aos[b]);
+      benchmark::DoNotOptimize(eig.eigenvectors().data());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar>
+static void BM_SelfAdjointEig3_Batched(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, 9> soa;
+  std::vector<Matrix<Scalar, 3, 3>, aligned_allocator<Matrix<Scalar, 3, 3>>> aos;
+  make_spd_batch(soa, aos);
+  Matrix<Scalar, Dynamic, 3> values(kBatch, 3);
+  Matrix<Scalar, Dynamic, 9> vectors(kBatch, 9);
+  for (auto _ : state) {
+    batchedSelfAdjointEigen3x3(soa, values, vectors);
+    benchmark::DoNotOptimize(vectors.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar>
+static void BM_QuaternionProduct_Loop(benchmark::State& state) {
+  std::vector<Quaternion<Scalar>, aligned_allocator<Quaternion<Scalar>>> p(kBatch), q(kBatch), r(kBatch);
+  for (Index b = 0; b < kBatch; ++b) {
+    p[b] = Quaternion<Scalar>::UnitRandom();
+    q[b] = Quaternion<Scalar>::UnitRandom();
+  }
+  for (auto _ : state) {
+    for (Index b = 0; b < kBatch; ++b) r[b] = p[b] * q[b];
+    benchmark::DoNotOptimize(r.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
+template <typename Scalar>
+static void BM_QuaternionProduct_Batched(benchmark::State& state) {
+  Matrix<Scalar, Dynamic, 4> p = Matrix<Scalar, Dynamic, 4>::Random(kBatch, 4);
+  Matrix<Scalar, Dynamic, 4> q = Matrix<Scalar, Dynamic, 4>::Random(kBatch, 4);
+  Matrix<Scalar, Dynamic, 4> r(kBatch, 4);
+  for (auto _ : state) {
+    batchedQuaternionProduct(p, q, r);
+    benchmark::DoNotOptimize(r.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kBatch);
+}
+
 // ============================================================================
 // Registration — focus on robotics/CV sizes
 // ============================================================================
@@ -317,3 +454,21 @@ BENCHMARK(BM_SelfAdjointEig_ComputeDirect<float, 2>);
 BENCHMARK(BM_SelfAdjointEig_ComputeDirect<float, 3>);
 BENCHMARK(BM_SelfAdjointEig_ComputeDirect<double, 2>);
 BENCHMARK(BM_SelfAdjointEig_ComputeDirect<double, 3>);
+
+// Batched decompositions vs. loops over the same batch
+BENCHMARK(BM_LLT_Loop<double, 3>);
+BENCHMARK(BM_LLT_Batched<double, 3>);
+BENCHMARK(BM_LLT_Loop<double, 6>);
+BENCHMARK(BM_LLT_Batched<double, 6>);
+BENCHMARK(BM_LLT_Loop<float, 6>);
+BENCHMARK(BM_LLT_Batched<float, 6>);
+BENCHMARK(BM_PartialPivLU_Loop<double, 4>);
+BENCHMARK(BM_PartialPivLU_Batched<double, 4>);
+BENCHMARK(BM_PartialPivLU_Loop<double, 6>);
+BENCHMARK(BM_PartialPivLU_Batched<double, 6>);
+BENCHMARK(BM_SelfAdjointEig3_Loop<float>);
+BENCHMARK(BM_SelfAdjointEig3_Batched<float>);
+BENCHMARK(BM_SelfAdjointEig3_Loop<double>);
+BENCHMARK(BM_SelfAdjointEig3_Batched<double>);
+BENCHMARK(BM_QuaternionProduct_Loop<double>);
+BENCHMARK(BM_QuaternionProduct_Batched<double>);
@@ -1,9 +1,13 @@
 // SPDX-FileCopyrightText: The Eigen Authors
 // SPDX-License-Identifier: MPL-2.0
 
+#define EIGEN_GEMM_THREADPOOL
 #include <benchmark/benchmark.h>
 #include <Eigen/Dense>
 
+#include <algorithm>
+#include <thread>
+
 using namespace Eigen;
 
 // ---------- TRSV: triangular solve with single RHS vector ----------
@@ -64,6 +68,45 @@ static void BM_TRSM_Right(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * n * n * nrhs);
 }
 
+// ---------- TRSM with many RHS on 1..N threads ----------
+// The right hand sides are split across the threads of the GEMM ThreadPool;
+// the last argument is the number of threads passed to setNbThreads.
+
+static int maxTrsmThreads() { return std::max(2, static_cast<int>(std::thread::hardware_concurrency())); }
+
+static ThreadPool& trsmPool() {
+  static ThreadPool pool(maxTrsmThreads());
+  return pool;
+}
+
+template <typename Scalar, unsigned int Mode>
+static void BM_TRSM_Threaded(benchmark::State& state) {
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  const Index n = state.range(0);
+  const Index nrhs = state.range(1);
+  setGemmThreadPool(&trsmPool());
+  setNbThreads(static_cast<int>(state.range(2)));
+  Mat A = Mat::Random(n, n);
+  A.diagonal().array() += Scalar(n);
+  Mat X = Mat::Random(n, nrhs);
+  Mat B = X;
+  for (auto _ : state) {
+    X = B;
+    A.template triangularView<Mode>().solveInPlace(X);
+    benchmark::DoNotOptimize(X.data());
+  }
+  // The other benchmarks are single-threaded.
+  setNbThreads(1);
+  state.SetItemsProcessed(state.iterations() * n * n * nrhs);
+}
+
+static void TrsmThreadedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"n", "nrhs", "threads"});
+  for (int threads = 1; threads <= maxTrsmThreads(); threads *= 2) {
+    for (int n : {512, 2048}) b->Args({n, 4096, threads});
+  }
+}
+
 // ---------- TRSV benchmarks ----------
 // Only Lower is benchmarked; Upper exercises the same kernel via transposed storage.
 
@@ -80,4 +123,9 @@ BENCHMARK(BM_TRSM_Left<double, Lower>)->ArgsProduct({{64, 256, 512}, {1, 16, 64}
 
 BENCHMARK(BM_TRSM_Right<float, Lower>)->ArgsProduct({{64, 256, 512}, {1, 16, 64}})->Name("TRSM_Right_float_Lower");
 BENCHMARK(BM_TRSM_Right<double, Lower>)->ArgsProduct({{64, 256, 512}, {1, 16, 64}})->Name("TRSM_Right_double_Lower");
+
+// ---------- TRSM threaded benchmarks ----------
+
+BENCHMARK(BM_TRSM_Threaded<float, Lower>)->Apply(TrsmThreadedSizes)->Name("TRSM_Threads_float_Lower")->UseRealTime();
+BENCHMARK(BM_TRSM_Threaded<double, Lower>)->Apply(TrsmThreadedSizes)->Name("TRSM_Threads_double_Lower")->UseRealTime();
 // clang-format on
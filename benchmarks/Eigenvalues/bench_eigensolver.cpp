@@ -5,6 +5,10 @@
 #include <Eigen/Core>
 #include <Eigen/QR>
 #include <Eigen/Eigenvalues>
+#include <Eigen/ThreadPool>
+
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
@@ -31,6 +35,59 @@ static void BM_SelfAdjointEigenSolver(benchmark::State& state) {
 }
 BENCHMARK(BM_SelfAdjointEigenSolver)->RangeMultiplier(2)->Range(4, 512);
 
+// One-stage (args: n, vectors) against two-stage (args: n, vectors, threads) tridiagonalization, with and without
+// the eigenvectors, to show the crossover between the two reductions.
+static void BM_SelfAdjointEigenSolver_OneStage(benchmark::State& state) {
+  int n = state.range(0);
+  int options = state.range(1) ? ComputeEigenvectors : EigenvaluesOnly;
+  typedef Matrix<Scalar, Dynamic, Dynamic> MatrixType;
+  MatrixType a = MatrixType::Random(n, n);
+  MatrixType covMat = a * a.adjoint();
+  SelfAdjointEigenSolver<MatrixType> ei(n);
+  Scalar acc = 0;
+  for (auto _ : state) {
+    ei.compute(covMat, options);
+    acc += ei.eigenvalues().coeff(n - 1);
+    benchmark::DoNotOptimize(acc);
+  }
+}
+
+static void BM_SelfAdjointEigenSolver_TwoStage(benchmark::State& state) {
+  int n = state.range(0);
+  int options = state.range(1) ? ComputeEigenvectors : EigenvaluesOnly;
+  typedef Matrix<Scalar, Dynamic, Dynamic> MatrixType;
+  MatrixType a = MatrixType::Random(n, n);
+  MatrixType covMat = a * a.adjoint();
+  ThreadPool pool(static_cast<int>(state.range(2)));
+  CoreThreadPoolDevice device(pool);
+  SelfAdjointEigenSolver<MatrixType> ei(n);
+  Scalar acc = 0;
+  for (auto _ : state) {
+    ei.compute(covMat, device, options);
+    acc += ei.eigenvalues().coeff(n - 1);
+    benchmark::DoNotOptimize(acc);
+  }
+}
+
+static void OneStageSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"n", "vectors"});
+  for (int vectors : {0, 1})
+    for (int n : {256, 512, 1024, 2048, 4096}) b->Args({n, vectors});
+}
+
+static void TwoStageSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"n", "vectors", "threads"});
+  const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int vectors : {0, 1}) {
+    for (int n : {256, 512, 1024, 2048, 4096}) {
+      for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({n, vectors, threads});
+      b->Args({n, vectors, maxThreads});
+    }
+  }
+}
+BENCHMARK(BM_SelfAdjointEigenSolver_OneStage)->Apply(OneStageSizes)->UseRealTime();
+BENCHMARK(BM_SelfAdjointEigenSolver_TwoStage)->Apply(TwoStageSizes)->UseRealTime();
+
 static void BM_EigenSolver(benchmark::State& state) {
   int n = state.range(0);
   typedef Matrix<Scalar, Dynamic, Dynamic> MatrixType;
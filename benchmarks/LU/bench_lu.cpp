@@ -1,11 +1,23 @@
 // Benchmarks for LU decompositions.
 //
 // Tests PartialPivLU and FullPivLU: compute, solve, inverse, determinant.
+//
+// PartialPivLU_Threads compares, on 1..N threads, the blocked factorization
+// with multi-threaded products (GEMM ThreadPool, _Blocked) and the task graph
+// run on a CoreThreadPoolDevice (_Tasks).
+//
+// IterativeRefinement compares a double precision solve through a float
+// PartialPivLU refined in double with a plain double PartialPivLU.
 // SPDX-FileCopyrightText: The Eigen Authors
 // SPDX-License-Identifier: MPL-2.0
 
+#define EIGEN_GEMM_THREADPOOL
 #include <benchmark/benchmark.h>
 #include <Eigen/LU>
+#include <Eigen/ThreadPool>
+
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
@@ -76,6 +88,42 @@ static void BM_PartialPivLU_Determinant(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+template <typename Scalar, bool Tasks>
+static void BM_PartialPivLU_Threaded(benchmark::State& state) {
+  const Index n = state.range(0);
+  const int threads = static_cast<int>(state.range(1));
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  Mat A = Mat::Random(n, n);
+  PartialPivLU<Mat> lu(n);
+  ThreadPool pool(threads);
+  CoreThreadPoolDevice device(pool);
+  if (!Tasks) {
+    setGemmThreadPool(&pool);
+    setNbThreads(threads);
+  }
+  for (auto _ : state) {
+    if (Tasks)
+      lu.compute(A, device);
+    else
+      lu.compute(A);
+    benchmark::DoNotOptimize(lu.matrixLU().data());
+  }
+  // The other benchmarks are single-threaded.
+  setGemmThreadPool(nullptr);
+  setNbThreads(1);
+  state.counters["GFLOPS"] = benchmark::Counter(2.0 * n * n * n / 3, benchmark::Counter::kIsIterationInvariantRate,
+                                                benchmark::Counter::kIs1000);
+}
+
+static void ThreadedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"n", "threads"});
+  const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int n : {2048, 8192}) {
+    for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({n, threads});
+    b->Args({n, maxThreads});
+  }
+}
+
 // --- FullPivLU ---
 
 template <typename Scalar>
@@ -113,6 +161,39 @@ static void BM_FullPivLU_Solve(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// --- Mixed-precision iterative refinement ---
+
+// A well-conditioned system, for which the refinement converges in a few steps.
+static void BM_PartialPivLU_ComputeSolve_double(benchmark::State& state) {
+  const Index n = state.range(0);
+  Matd A = Matd::Random(n, n) + double(n) * Matd::Identity(n, n);
+  Matd B = Matd::Random(n, 1);
+  PartialPivLU<Matd> lu(n);
+  Matd X(n, 1);
+  for (auto _ : state) {
+    lu.compute(A);
+    X = lu.solve(B);
+    benchmark::DoNotOptimize(X.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_IterativeRefinement_ComputeSolve_double(benchmark::State& state) {
+  const Index n = state.range(0);
+  Matd A = Matd::Random(n, n) + double(n) * Matd::Identity(n, n);
+  Matd B = Matd::Random(n, 1);
+  IterativeRefinement<PartialPivLU<Matf>> solver;
+  Matd X(n, 1);
+  Index iterations = 0;
+  for (auto _ : state) {
+    solver.compute(A);
+    solver.refinedSolve(B, X, &iterations);
+    benchmark::DoNotOptimize(X.data());
+  }
+  state.counters["iterations"] = double(iterations);
+  state.SetItemsProcessed(state.iterations());
+}
+
 // --- Size configurations ---
 
 // clang-format off
@@ -124,6 +205,10 @@ BENCHMARK(BM_PartialPivLU_Inverse<float>)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->A
 BENCHMARK(BM_PartialPivLU_Inverse<double>)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("PartialPivLU_Inverse_double");
 BENCHMARK(BM_PartialPivLU_Determinant<float>)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("PartialPivLU_Determinant_float");
 BENCHMARK(BM_PartialPivLU_Determinant<double>)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("PartialPivLU_Determinant_double");
+BENCHMARK(BM_PartialPivLU_Threaded<double, false>)->Apply(ThreadedSizes)->UseRealTime()->Name("PartialPivLU_Threads_double_Blocked");
+BENCHMARK(BM_PartialPivLU_Threaded<double, true>)->Apply(ThreadedSizes)->UseRealTime()->Name("PartialPivLU_Threads_double_Tasks");
+BENCHMARK(BM_PartialPivLU_ComputeSolve_double)->Arg(64)->Arg(256)->Arg(512)->Arg(1024)->Arg(2048)->Name("ComputeSolve_double_PartialPivLU");
+BENCHMARK(BM_IterativeRefinement_ComputeSolve_double)->Arg(64)->Arg(256)->Arg(512)->Arg(1024)->Arg(2048)->Name("ComputeSolve_double_IterativeRefinement");
 BENCHMARK(BM_FullPivLU_Compute<float>)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("FullPivLU_Compute_float");
 BENCHMARK(BM_FullPivLU_Compute<double>)->Arg(8)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("FullPivLU_Compute_double");
 BENCHMARK(BM_FullPivLU_Solve<float>)->ArgsProduct({{32, 128, 512, 1024}, {1, 16, 64}})->Name("FullPivLU_Solve_float");
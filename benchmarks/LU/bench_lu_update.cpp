@@ -0,0 +1,63 @@
+// Benchmarks for updating a LU decomposition.
+//
+// Compares the O(n^2) column replacement of UpdatableLU, followed by a solve,
+// with a new O(n^3) PartialPivLU of the modified matrix, followed by a solve,
+// as in an iteration of the simplex method.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include <benchmark/benchmark.h>
+#include <Eigen/LU>
+
+using namespace Eigen;
+
+template <typename Scalar>
+static void BM_UpdatableLU_ReplaceColumn(benchmark::State& state) {
+  const Index n = state.range(0);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  Mat A = Mat::Random(n, n);
+  Mat columns = Mat::Random(n, 16);
+  Vec b = Vec::Random(n), x(n);
+  UpdatableLU<Mat> lu(A);
+  Index k = 0;
+  for (auto _ : state) {
+    lu.replaceColumn((k * 7) % n, columns.col(k % 16));
+    x = lu.solve(b);
+    benchmark::DoNotOptimize(x.data());
+    // Start again from a fresh factorization from time to time, as a solver would, outside of the timing.
+    if (++k % n == 0) {
+      state.PauseTiming();
+      lu.compute(A);
+      state.ResumeTiming();
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Scalar>
+static void BM_PartialPivLU_ReplaceColumn(benchmark::State& state) {
+  const Index n = state.range(0);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  Mat A = Mat::Random(n, n);
+  Mat columns = Mat::Random(n, 16);
+  Vec b = Vec::Random(n), x(n);
+  PartialPivLU<Mat> lu(n);
+  Index k = 0;
+  for (auto _ : state) {
+    A.col((k * 7) % n) = columns.col(k % 16);
+    lu.compute(A);
+    x = lu.solve(b);
+    benchmark::DoNotOptimize(x.data());
+    ++k;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// clang-format off
+BENCHMARK(BM_UpdatableLU_ReplaceColumn<double>)->Arg(8)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("ReplaceColumn_double_Update");
+BENCHMARK(BM_PartialPivLU_ReplaceColumn<double>)->Arg(8)->Arg(16)->Arg(32)->Arg(64)->Arg(128)->Arg(256)->Arg(512)->Arg(1024)->Name("ReplaceColumn_double_Refactor");
+BENCHMARK(BM_UpdatableLU_ReplaceColumn<float>)->Arg(8)->Arg(32)->Arg(128)->Arg(512)->Name("ReplaceColumn_float_Update");
+BENCHMARK(BM_PartialPivLU_ReplaceColumn<float>)->Arg(8)->Arg(32)->Arg(128)->Arg(512)->Name("ReplaceColumn_float_Refactor");
+// clang-format on
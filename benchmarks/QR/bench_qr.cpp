@@ -7,6 +7,10 @@
 
 #include <benchmark/benchmark.h>
 #include <Eigen/QR>
+#include <Eigen/ThreadPool>
+
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
@@ -132,6 +136,36 @@ static void BM_HouseholderQR_Solve(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// --- HouseholderQR on a CoreThreadPoolDevice (TSQR for tall-skinny matrices) ---
+
+// The last argument is the number of threads of the pool.
+template <typename Scalar>
+static void BM_HouseholderQR_Threaded(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  Mat A = Mat::Random(rows, cols);
+  ThreadPool pool(static_cast<int>(state.range(2)));
+  CoreThreadPoolDevice device(pool);
+  HouseholderQR<Mat> qr(rows, cols);
+  for (auto _ : state) {
+    qr.compute(A, device);
+    benchmark::DoNotOptimize(qr.matrixQR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void TallSkinnyThreadedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"rows", "cols", "threads"});
+  const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int rows : {100000, 1000000}) {
+    for (int cols : {16, 50, 200}) {
+      for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({rows, cols, threads});
+      b->Args({rows, cols, maxThreads});
+    }
+  }
+}
+
 // --- Size configurations ---
 
 // clang-format off
@@ -158,5 +192,9 @@ BENCHMARK(BM_COD<double>) QR_SIZES ->Name("COD_double");
 BENCHMARK(BM_RandCOD<double>) QR_SIZES ->Name("RandCOD_double");
 BENCHMARK(BM_HouseholderQR_Solve<double>) QR_SIZES ->Name("HouseholderQR_Solve_double");
 
+// Register: tall-skinny on a device
+BENCHMARK(BM_HouseholderQR_Threaded<float>)->Apply(TallSkinnyThreadedSizes)->UseRealTime()->Name("HouseholderQR_Threaded_float");
+BENCHMARK(BM_HouseholderQR_Threaded<double>)->Apply(TallSkinnyThreadedSizes)->UseRealTime()->Name("HouseholderQR_Threaded_double");
+
 #undef QR_SIZES
 // clang-format on
@@ -0,0 +1,140 @@
+// Benchmarks for updating a QR decomposition.
+//
+// Compares the O(m^2) updates of UpdatableQR with a new O(m n^2) HouseholderQR
+// of the modified matrix, for the insertion and removal of a row or a column
+// and for a rank-one update. Each iteration makes the matrix grow and shrink
+// back, so that its size stays constant.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include <benchmark/benchmark.h>
+#include <Eigen/QR>
+
+using namespace Eigen;
+
+template <typename QR>
+EIGEN_DONT_INLINE void do_compute(QR& qr, const typename QR::MatrixType& A) {
+  qr.compute(A);
+}
+
+// --- Rows ---
+
+template <typename Scalar>
+static void BM_UpdatableQR_InsertRemoveRow(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using RowVec = Matrix<Scalar, 1, Dynamic>;
+  Mat A = Mat::Random(rows, cols);
+  RowVec row = RowVec::Random(cols);
+  UpdatableQR<Mat> qr(A);
+  for (auto _ : state) {
+    qr.insertRow(rows / 2, row);
+    qr.removeRow(rows / 2);
+    benchmark::DoNotOptimize(qr.matrixR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Scalar>
+static void BM_HouseholderQR_InsertRemoveRow(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  Mat A = Mat::Random(rows, cols);
+  Mat B(rows + 1, cols);
+  B << A.topRows(rows / 2), Mat::Random(1, cols), A.bottomRows(rows - rows / 2);
+  HouseholderQR<Mat> qr(rows + 1, cols);
+  for (auto _ : state) {
+    do_compute(qr, B);
+    do_compute(qr, A);
+    benchmark::DoNotOptimize(qr.matrixQR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// --- Columns ---
+
+template <typename Scalar>
+static void BM_UpdatableQR_InsertRemoveColumn(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  Mat A = Mat::Random(rows, cols);
+  Vec col = Vec::Random(rows);
+  UpdatableQR<Mat> qr(A);
+  for (auto _ : state) {
+    qr.insertColumn(cols / 2, col);
+    qr.removeColumn(cols / 2);
+    benchmark::DoNotOptimize(qr.matrixR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Scalar>
+static void BM_HouseholderQR_InsertRemoveColumn(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  Mat A = Mat::Random(rows, cols);
+  Mat B(rows, cols + 1);
+  B << A.leftCols(cols / 2), Mat::Random(rows, 1), A.rightCols(cols - cols / 2);
+  HouseholderQR<Mat> qr(rows, cols + 1);
+  for (auto _ : state) {
+    do_compute(qr, B);
+    do_compute(qr, A);
+    benchmark::DoNotOptimize(qr.matrixQR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// --- Rank-one update ---
+
+template <typename Scalar>
+static void BM_UpdatableQR_RankUpdate(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  Mat A = Mat::Random(rows, cols);
+  Vec u = Vec::Random(rows) * Scalar(1e-3), v = Vec::Random(cols);
+  UpdatableQR<Mat> qr(A);
+  for (auto _ : state) {
+    qr.rankUpdate(u, v);
+    benchmark::DoNotOptimize(qr.matrixR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+template <typename Scalar>
+static void BM_HouseholderQR_RankUpdate(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  Mat A = Mat::Random(rows, cols);
+  HouseholderQR<Mat> qr(rows, cols);
+  for (auto _ : state) {
+    do_compute(qr, A);
+    benchmark::DoNotOptimize(qr.matrixQR().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// --- Size configurations ---
+
+// clang-format off
+// Square sizes + moderately tall sizes, since UpdatableQR stores Q explicitly.
+#define QR_UPDATE_SIZES \
+    ->Args({16, 16})->Args({32, 32})->Args({64, 64})->Args({128, 128})->Args({256, 256})->Args({512, 512}) \
+    ->Args({256, 32})->Args({1000, 32})->Args({1000, 100})
+
+BENCHMARK(BM_UpdatableQR_InsertRemoveRow<double>) QR_UPDATE_SIZES ->Name("InsertRemoveRow_double_Update");
+BENCHMARK(BM_HouseholderQR_InsertRemoveRow<double>) QR_UPDATE_SIZES ->Name("InsertRemoveRow_double_Refactor");
+BENCHMARK(BM_UpdatableQR_InsertRemoveColumn<double>) QR_UPDATE_SIZES ->Name("InsertRemoveColumn_double_Update");
+BENCHMARK(BM_HouseholderQR_InsertRemoveColumn<double>) QR_UPDATE_SIZES ->Name("InsertRemoveColumn_double_Refactor");
+BENCHMARK(BM_UpdatableQR_RankUpdate<double>) QR_UPDATE_SIZES ->Name("RankUpdate_double_Update");
+BENCHMARK(BM_HouseholderQR_RankUpdate<double>) QR_UPDATE_SIZES ->Name("RankUpdate_double_Refactor");
+
+#undef QR_UPDATE_SIZES
+// clang-format on
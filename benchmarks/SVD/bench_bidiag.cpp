@@ -3,6 +3,10 @@
 
 #include <benchmark/benchmark.h>
 #include <Eigen/SVD>
+#include <Eigen/ThreadPool>
+
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
@@ -64,6 +68,35 @@ static void BM_UpperBidiag_BlockSize(benchmark::State& state) {
   state.SetLabel("bs=" + std::to_string(blockSize));
 }
 
+// ---------- Blocked on a CoreThreadPoolDevice ----------
+
+// The last argument is the number of threads of the pool.
+template <typename Scalar>
+static void BM_UpperBidiag_Threaded(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  Mat<Scalar> A = Mat<Scalar>::Random(rows, cols);
+  ThreadPool pool(static_cast<int>(state.range(2)));
+  CoreThreadPoolDevice device(pool);
+  internal::UpperBidiagonalization<Mat<Scalar>> ubd(rows, cols);
+  for (auto _ : state) {
+    ubd.compute(A, device);
+    benchmark::DoNotOptimize(ubd.bidiagonal().toDenseMatrix().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void ThreadedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"rows", "cols", "threads"});
+  const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int n : {1024, 2048, 5000}) {
+    for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({n, n, threads});
+    b->Args({n, n, maxThreads});
+  }
+  for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({8192, 1024, threads});
+  b->Args({8192, 1024, maxThreads});
+}
+
 // ---------- Size configurations ----------
 
 // clang-format off
@@ -127,6 +160,10 @@ BENCHMARK(BM_UpperBidiag_BlockSize<double>) BLOCKSIZE_SWEEP_TALL ->Name("Bidiag_
 BENCHMARK(BM_UpperBidiag_BlockSize<float>) BLOCKSIZE_SWEEP ->Name("Bidiag_BS_float_Square");
 BENCHMARK(BM_UpperBidiag_BlockSize<float>) BLOCKSIZE_SWEEP_TALL ->Name("Bidiag_BS_float_Tall");
 
+// Blocked on a device — double and float
+BENCHMARK(BM_UpperBidiag_Threaded<double>)->Apply(ThreadedSizes)->UseRealTime()->Name("Bidiag_Threaded_double");
+BENCHMARK(BM_UpperBidiag_Threaded<float>)->Apply(ThreadedSizes)->UseRealTime()->Name("Bidiag_Threaded_float");
+
 #undef SMALL_SIZES
 #undef MEDIUM_SIZES
 #undef LARGE_SIZES
@@ -3,10 +3,14 @@
 
 #include <benchmark/benchmark.h>
 #include <Eigen/Dense>
+#include <Eigen/ThreadPool>
+
+#include <algorithm>
+#include <thread>
 
 using namespace Eigen;
 
-// Benchmark JacobiSVD and BDCSVD for various scalar types, matrix shapes,
+// Benchmark JacobiSVD, BDCSVD and RandomizedSVD for various scalar types, matrix shapes,
 // and computation options.
 
 // ---------- helpers ----------
@@ -62,6 +66,50 @@ static void BM_BDCSVDBidiagonal(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations());
 }
 
+// BDCSVD whose divide-and-conquer phase runs on a CoreThreadPoolDevice: the last argument is the number of threads
+// of the pool.
+template <typename Scalar, int Options>
+static void BM_BDCSVDThreaded(benchmark::State& state) {
+  const Index size = state.range(0);
+  Mat<Scalar> A = Mat<Scalar>::Random(size, size);
+  ThreadPool pool(static_cast<int>(state.range(1)));
+  CoreThreadPoolDevice device(pool);
+  BDCSVD<Mat<Scalar>, Options> svd(size, size);
+  for (auto _ : state) {
+    svd.compute(A, device);
+    benchmark::DoNotOptimize(svd.singularValues().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+// ---------- RandomizedSVD ----------
+
+// Truncated SVD of a rows x cols matrix of rank 2k, to compare with BDCSVD of the same matrix: the last argument is
+// the target rank k.
+template <typename Scalar, int Options>
+static void BM_RandomizedSVD(benchmark::State& state) {
+  const Index rows = state.range(0);
+  const Index cols = state.range(1);
+  const Index k = state.range(2);
+  Mat<Scalar> A = Mat<Scalar>::Random(rows, 2 * k) * Mat<Scalar>::Random(2 * k, cols);
+  RandomizedSVD<Mat<Scalar>, Options> svd(k);
+  svd.setSeed(0);
+  for (auto _ : state) {
+    svd.compute(A);
+    benchmark::DoNotOptimize(svd.singularValues().data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void ThreadedSizes(benchmark::internal::Benchmark* b) {
+  b->ArgNames({"n", "threads"});
+  const int maxThreads = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+  for (int n : {1024, 2048, 5000}) {
+    for (int threads = 1; threads < maxThreads; threads *= 2) b->Args({n, threads});
+    b->Args({n, maxThreads});
+  }
+}
+
 // ---------- Size configurations ----------
 
 // ---------- Register benchmarks ----------
@@ -103,11 +151,28 @@ BENCHMARK(BM_BDCSVDBidiagonal<double, ComputeThinU | ComputeThinV>)
     BDC_BIDIAG_SIZES ->Name("BDCSVD_Bidiagonal_double_ThinUV");
 BENCHMARK(BM_BDCSVDBidiagonal<double, 0>) BDC_BIDIAG_SIZES ->Name("BDCSVD_Bidiagonal_double_ValuesOnly");
 
+BENCHMARK(BM_BDCSVDThreaded<double, ComputeThinU | ComputeThinV>)
+    ->Apply(ThreadedSizes)->UseRealTime()->Name("BDCSVD_Threaded_double_ThinUV");
+BENCHMARK(BM_BDCSVDThreaded<double, 0>)->Apply(ThreadedSizes)->UseRealTime()->Name("BDCSVD_Threaded_double_ValuesOnly");
+
 #undef JACOBI_SIZES
 #undef BDC_SIZES
 #undef BDC_BIDIAG_SIZES
 // clang-format on
 
+// RandomizedSVD — compare with BDCSVD_double_ThinUV on the same shapes.
+BENCHMARK(BM_RandomizedSVD<double, ComputeThinU | ComputeThinV>)
+    ->ArgNames({"rows", "cols", "k"})
+    ->Args({1000, 1000, 20})
+    ->Args({4000, 1000, 20})
+    ->Args({4000, 1000, 50})
+    ->Args({4000, 1000, 200})
+    ->Name("RandomizedSVD_double_ThinUV");
+BENCHMARK(BM_BDCSVD<double, ComputeThinU | ComputeThinV>)
+    ->Args({4000, 1000})
+    ->Name("BDCSVD_double_ThinUV");
+BENCHMARK(BM_RandomizedSVD<double, 0>)->Args({4000, 1000, 50})->Name("RandomizedSVD_double_ValuesOnly");
+
 // JacobiSVD — QR preconditioner comparison (double, 64x64, ThinUV)
 BENCHMARK(BM_JacobiSVD<double, ComputeThinU | ComputeThinV | ColPivHouseholderQRPreconditioner>)
     ->Args({64, 64})
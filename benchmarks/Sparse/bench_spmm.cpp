@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: The Eigen Authors
 // SPDX-License-Identifier: MPL-2.0
 
+#define EIGEN_USE_THREADS 1
+
 #include <benchmark/benchmark.h>
 #include <Eigen/Sparse>
 #include <set>
@@ -42,3 +44,62 @@ static void BM_SparseMM(benchmark::State& state) {
 }
 
 BENCHMARK(BM_SparseMM)->ArgsProduct({{1000, 10000}, {4, 6, 10}});
+
+// Repeated product with a fixed pattern: only the numeric phase of SparseProductPlan is timed.
+static void BM_SparseMM_Plan(benchmark::State& state) {
+  int n = state.range(0);
+  int nnzPerCol = state.range(1);
+  SpMat sm1(n, n), sm2(n, n), sm3(n, n);
+  fillMatrix(nnzPerCol, n, n, sm1);
+  fillMatrix(nnzPerCol, n, n, sm2);
+  SparseProductPlan<SpMat> plan(sm1, sm2);
+  plan.compute(sm1, sm2, sm3);
+  for (auto _ : state) {
+    plan.compute(sm1, sm2, sm3);
+    benchmark::DoNotOptimize(sm3.valuePtr());
+  }
+  state.counters["nnz_A"] = sm1.nonZeros();
+  state.counters["nnz_B"] = sm2.nonZeros();
+}
+
+BENCHMARK(BM_SparseMM_Plan)->ArgsProduct({{1000, 10000}, {4, 6, 10}});
+
+// Threaded product: threads == 0 is the serial operator*, for reference.
+static void BM_SparseMM_Threaded(benchmark::State& state) {
+  int n = state.range(0);
+  int nnzPerCol = state.range(1);
+  int threads = state.range(2);
+  SpMat sm1(n, n), sm2(n, n), sm3(n, n);
+  fillMatrix(nnzPerCol, n, n, sm1);
+  fillMatrix(nnzPerCol, n, n, sm2);
+  ThreadPool pool(numext::maxi(threads, 1));
+  for (auto _ : state) {
+    if (threads == 0)
+      sm3 = sm1 * sm2;
+    else
+      threadedSparseSparseProduct(sm1, sm2, sm3, &pool);
+    benchmark::DoNotOptimize(sm3.valuePtr());
+  }
+  state.counters["nnz_C"] = sm3.nonZeros();
+}
+
+BENCHMARK(BM_SparseMM_Threaded)->ArgsProduct({{10000, 100000}, {6, 10}, {0, 1, 2, 4, 8}})->UseRealTime();
+
+// A * A^T, the product of normal equations and of Galerkin coarsening.
+static void BM_SparseMM_AAt_Threaded(benchmark::State& state) {
+  int n = state.range(0);
+  int threads = state.range(1);
+  SpMat sm1(n, n), sm3(n, n);
+  fillMatrix(8, n, n, sm1);
+  ThreadPool pool(numext::maxi(threads, 1));
+  for (auto _ : state) {
+    if (threads == 0)
+      sm3 = sm1 * sm1.transpose();
+    else
+      threadedSparseSparseProduct(sm1, sm1.transpose(), sm3, &pool);
+    benchmark::DoNotOptimize(sm3.valuePtr());
+  }
+  state.counters["nnz_C"] = sm3.nonZeros();
+}
+
+BENCHMARK(BM_SparseMM_AAt_Threaded)->ArgsProduct({{10000, 100000}, {0, 1, 2, 4, 8}})->UseRealTime();
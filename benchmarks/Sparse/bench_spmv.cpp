@@ -55,5 +55,87 @@ static void BM_SpMV_Transpose(benchmark::State& state) {
   state.counters["nnz"] = sm.nonZeros();
 }
 
+// Matrices with the sparsity structures of common SuiteSparse collection groups, for comparing the CSR product with
+// the SELL-C-sigma one.
+enum MatrixKind { Laplacian2D = 0, Banded = 1, PowerLaw = 2, Uniform = 3 };
+
+static void fillKindMatrix(int kind, int n, SparseMatrix<Scalar, RowMajor>& dst) {
+  std::vector<Triplet<Scalar>> triplets;
+  if (kind == Laplacian2D) {
+    // 5-point stencil on a square grid (thermal, structural and CFD problems): rows of 3 to 5 nonzeros.
+    const int m = int(std::sqrt(double(n)));
+    n = m * m;
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < m; ++j) {
+        const int r = i * m + j;
+        triplets.emplace_back(r, r, Scalar(4));
+        if (i > 0) triplets.emplace_back(r, r - m, Scalar(-1));
+        if (i + 1 < m) triplets.emplace_back(r, r + m, Scalar(-1));
+        if (j > 0) triplets.emplace_back(r, r - 1, Scalar(-1));
+        if (j + 1 < m) triplets.emplace_back(r, r + 1, Scalar(-1));
+      }
+    }
+  } else if (kind == Banded) {
+    // Random entries within a band (circuit simulation and reordered FEM problems): rows of 1 to 16 nonzeros.
+    for (int r = 0; r < n; ++r) {
+      const int len = internal::random<int>(1, 16);
+      for (int k = 0; k < len; ++k) {
+        const int c = numext::mini(n - 1, numext::maxi(0, r + internal::random<int>(-200, 200)));
+        triplets.emplace_back(r, c, internal::random<Scalar>());
+      }
+    }
+  } else if (kind == PowerLaw) {
+    // Power-law row lengths and random columns (web and social graphs): mostly 1 or 2 nonzeros, up to 1000.
+    for (int r = 0; r < n; ++r) {
+      const double u = internal::random<double>(0.001, 1.0);
+      const int len = numext::mini(n, int(1.0 / u));
+      for (int k = 0; k < len; ++k)
+        triplets.emplace_back(r, internal::random<int>(0, n - 1), internal::random<Scalar>());
+    }
+  } else {
+    // Uniformly random, 8 nonzeros per row.
+    for (int r = 0; r < n; ++r)
+      for (int k = 0; k < 8; ++k) triplets.emplace_back(r, internal::random<int>(0, n - 1), internal::random<Scalar>());
+  }
+  dst.resize(n, n);
+  dst.setFromTriplets(triplets.begin(), triplets.end());
+}
+
+static void BM_SpMV_CSR(benchmark::State& state) {
+  SparseMatrix<Scalar, RowMajor> sm;
+  fillKindMatrix(state.range(0), state.range(1), sm);
+  DenseVec v = DenseVec::Random(sm.cols());
+  DenseVec res(sm.rows());
+  for (auto _ : state) {
+    res.noalias() = sm * v;
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.counters["nnz"] = sm.nonZeros();
+  state.counters["GFlops"] = benchmark::Counter(2.0 * sm.nonZeros(), benchmark::Counter::kIsIterationInvariantRate,
+                                                benchmark::Counter::kIs1000);
+}
+
+// The third argument is sigma, the sorting window, which does not reorder the rows when equal to the slice height.
+template <int SliceHeight>
+static void BM_SpMV_SELL(benchmark::State& state) {
+  SparseMatrix<Scalar, RowMajor> sm;
+  fillKindMatrix(state.range(0), state.range(1), sm);
+  const SellMatrix<Scalar, SliceHeight> sell(sm, state.range(2));
+  DenseVec v = DenseVec::Random(sm.cols());
+  DenseVec res(sm.rows());
+  for (auto _ : state) {
+    res.noalias() = sell * v;
+    benchmark::DoNotOptimize(res.data());
+  }
+  state.counters["nnz"] = sm.nonZeros();
+  state.counters["fill"] = double(sell.paddedNonZeros()) / double(numext::maxi<Index>(1, sm.nonZeros()));
+  state.counters["GFlops"] = benchmark::Counter(2.0 * sm.nonZeros(), benchmark::Counter::kIsIterationInvariantRate,
+                                                benchmark::Counter::kIs1000);
+}
+
 BENCHMARK(BM_SpMV)->ArgsProduct({{1000, 10000, 100000}, {7, 20, 50}});
 BENCHMARK(BM_SpMV_Transpose)->ArgsProduct({{1000, 10000, 100000}, {7, 20, 50}});
+BENCHMARK(BM_SpMV_CSR)->ArgsProduct({{Laplacian2D, Banded, PowerLaw, Uniform}, {10000, 1000000}});
+BENCHMARK(BM_SpMV_SELL<8>)->ArgsProduct({{Laplacian2D, Banded, PowerLaw, Uniform}, {10000, 1000000}, {8, 256, 4096}});
+BENCHMARK(BM_SpMV_SELL<4>)->ArgsProduct({{Laplacian2D, Banded, PowerLaw, Uniform}, {10000, 1000000}, {256}});
+BENCHMARK(BM_SpMV_SELL<16>)->ArgsProduct({{Laplacian2D, Banded, PowerLaw, Uniform}, {10000, 1000000}, {256}});
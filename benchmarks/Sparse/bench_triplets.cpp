@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+// Assembly of finite element matrices from triplets: serial setFromTriplets against the threaded assembly, and the
+// repeated assembly into the pattern of a previous one.
+
+#define EIGEN_USE_THREADS 1
+
+#include <benchmark/benchmark.h>
+#include <Eigen/SparseCore>
+
+#include <algorithm>
+#include <random>
+
+using namespace Eigen;
+
+using Scalar = double;
+using SpMat = SparseMatrix<Scalar>;
+using T = Triplet<Scalar>;
+
+// Triplet stream of a trilinear hexahedral mesh of n^3 elements: each element adds its 8x8 element matrix, so each
+// interior node row receives 27 distinct columns from 8 elements, with 216 triplets. With shuffled = true, the
+// elements are visited in random order, like in an unstructured mesh.
+static std::vector<T> hex_mesh_triplets(int n, bool shuffled) {
+  const int m = n + 1;
+  std::vector<int> elements(n * n * n);
+  for (int e = 0; e < n * n * n; ++e) elements[e] = e;
+  std::mt19937 gen(42);
+  if (shuffled) std::shuffle(elements.begin(), elements.end(), gen);
+  std::uniform_real_distribution<Scalar> dist(-1, 1);
+  std::vector<T> triplets;
+  triplets.reserve(std::size_t(64) * elements.size());
+  for (int e : elements) {
+    const int x = e % n, y = (e / n) % n, z = e / (n * n);
+    int nodes[8];
+    for (int c = 0; c < 8; ++c) nodes[c] = (x + (c & 1)) + m * ((y + ((c >> 1) & 1)) + m * (z + (c >> 2)));
+    for (int a = 0; a < 8; ++a)
+      for (int b = 0; b < 8; ++b) triplets.emplace_back(nodes[a], nodes[b], dist(gen));
+  }
+  return triplets;
+}
+
+static void BM_SetFromTriplets(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<T> triplets = hex_mesh_triplets(n, state.range(1));
+  const int nodes = (n + 1) * (n + 1) * (n + 1);
+  SpMat mat(nodes, nodes);
+  for (auto _ : state) {
+    mat.setFromTriplets(triplets.begin(), triplets.end());
+    benchmark::DoNotOptimize(mat.valuePtr());
+  }
+  state.counters["triplets"] = triplets.size();
+  state.counters["nnz"] = mat.nonZeros();
+}
+
+static void BM_ThreadedSetFromTriplets(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<T> triplets = hex_mesh_triplets(n, state.range(1));
+  const int nodes = (n + 1) * (n + 1) * (n + 1);
+  ThreadPool pool(state.range(2));
+  SpMat mat(nodes, nodes);
+  for (auto _ : state) {
+    threadedSetFromTriplets(triplets.begin(), triplets.end(), mat, &pool);
+    benchmark::DoNotOptimize(mat.valuePtr());
+  }
+  state.counters["triplets"] = triplets.size();
+  state.counters["nnz"] = mat.nonZeros();
+}
+
+static void BM_ThreadedSetValuesFromTriplets(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<T> triplets = hex_mesh_triplets(n, state.range(1));
+  const int nodes = (n + 1) * (n + 1) * (n + 1);
+  ThreadPool pool(state.range(2));
+  SpMat mat(nodes, nodes);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  for (auto _ : state) {
+    threadedSetValuesFromTriplets(triplets.begin(), triplets.end(), mat, &pool);
+    benchmark::DoNotOptimize(mat.valuePtr());
+  }
+  state.counters["triplets"] = triplets.size();
+  state.counters["nnz"] = mat.nonZeros();
+}
+
+// Reassembly by coeffRef, with a binary search per triplet, for reference.
+static void BM_CoeffRefReassembly(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<T> triplets = hex_mesh_triplets(n, state.range(1));
+  const int nodes = (n + 1) * (n + 1) * (n + 1);
+  SpMat mat(nodes, nodes);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  for (auto _ : state) {
+    mat.coeffs().setZero();
+    for (const T& t : triplets) mat.coeffRef(t.row(), t.col()) += t.value();
+    benchmark::DoNotOptimize(mat.valuePtr());
+  }
+  state.counters["triplets"] = triplets.size();
+}
+
+// Reassembly through a SparseAssemblyMap, which only streams the values.
+static void BM_AssemblyMap(benchmark::State& state) {
+  const int n = state.range(0);
+  const std::vector<T> triplets = hex_mesh_triplets(n, state.range(1));
+  const int nodes = (n + 1) * (n + 1) * (n + 1);
+  const int threads = state.range(2);
+  ThreadPool pool(numext::maxi(threads, 1));
+  SpMat mat(nodes, nodes);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  const SparseAssemblyMap<SpMat> map(mat, triplets.begin(), triplets.end());
+  std::vector<Scalar> values(triplets.size());
+  for (std::size_t k = 0; k < triplets.size(); ++k) values[k] = triplets[k].value();
+  for (auto _ : state) {
+    if (threads == 0)
+      map.assemble(values.data(), mat);
+    else
+      threadedAssemble(map, values.data(), mat, &pool);
+    benchmark::DoNotOptimize(mat.valuePtr());
+  }
+  state.counters["triplets"] = triplets.size();
+}
+
+// Mesh size n (n^3 elements, 64 n^3 triplets), shuffled elements, threads.
+BENCHMARK(BM_SetFromTriplets)->ArgsProduct({{20, 50}, {0, 1}})->UseRealTime();
+BENCHMARK(BM_ThreadedSetFromTriplets)->ArgsProduct({{20, 50}, {0, 1}, {1, 2, 4, 8}})->UseRealTime();
+BENCHMARK(BM_ThreadedSetValuesFromTriplets)->ArgsProduct({{20, 50}, {0, 1}, {1, 2, 4, 8}})->UseRealTime();
+BENCHMARK(BM_CoeffRefReassembly)->ArgsProduct({{20, 50}, {0, 1}})->UseRealTime();
+// threads == 0 is the serial assemble().
+BENCHMARK(BM_AssemblyMap)->ArgsProduct({{20, 50}, {0, 1}, {0, 1, 2, 4, 8}})->UseRealTime();
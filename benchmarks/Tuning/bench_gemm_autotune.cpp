@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+// GEMM throughput with the cache-size heuristic versus autotuned blocking sizes (EIGEN_GEMM_AUTOTUNE).
+//
+// The autotuned variant tunes the shape class with tuneGemmBlockingSizes() before the measurement starts, unless
+// EIGEN_GEMM_BLOCKING_FILE names a file holding its tuned sizes; the table is then saved to that file.
+//
+// Args: m, k, n, autotuning (0/1).
+
+#define EIGEN_GEMM_AUTOTUNE
+#include <benchmark/benchmark.h>
+#include <Eigen/Core>
+
+#include <cstdlib>
+
+using namespace Eigen;
+
+#ifndef SCALAR
+#define SCALAR float
+#endif
+
+typedef SCALAR Scalar;
+typedef Matrix<Scalar, Dynamic, Dynamic> Mat;
+
+static void BM_GemmAutotune(benchmark::State& state) {
+  const Index m = state.range(0), k = state.range(1), n = state.range(2);
+  const bool autotune = state.range(3) != 0;
+  const char* file = std::getenv("EIGEN_GEMM_BLOCKING_FILE");
+  if (autotune && file) loadGemmBlockingSizes(file);
+  setGemmBlockingAutotuning(autotune);
+  if (autotune) {
+    Index kc = k, mc = m, nc = n;
+    if (!internal::gemm_autotuned_blocking_sizes<Scalar, Scalar, 1>(kc, mc, nc)) tuneGemmBlockingSizes<Scalar>(m, n, k);
+  }
+
+  Mat a = Mat::Random(m, k), b = Mat::Random(k, n), c(m, n);
+  for (auto _ : state) {
+    c.noalias() = a * b;
+    benchmark::DoNotOptimize(c.data());
+    benchmark::ClobberMemory();
+  }
+  if (autotune && file) saveGemmBlockingSizes(file);
+  setGemmBlockingAutotuning(true);
+
+  state.counters["GFLOPS"] =
+      benchmark::Counter(2.0 * m * k * n, benchmark::Counter::kIsIterationInvariantRate, benchmark::Counter::kIs1000);
+}
+
+static void AutotuneArgs(benchmark::internal::Benchmark* b) {
+  // Square, tall-skinny, short-wide and small-depth shapes.
+  const int shapes[][3] = {{256, 256, 256},  {512, 512, 512},  {1024, 1024, 1024}, {2048, 2048, 2048},
+                           {4096, 256, 256}, {256, 256, 4096}, {1024, 64, 1024},   {1024, 4096, 64}};
+  for (const auto& s : shapes)
+    for (int autotune : {0, 1}) b->Args({s[0], s[1], s[2], autotune});
+}
+
+BENCHMARK(BM_GemmAutotune)->Apply(AutotuneArgs)->ArgNames({"m", "k", "n", "autotune"});
@@ -77,9 +77,121 @@ void test_threaded_assignment(const PlainObject&, Index rows = PlainObject::Rows
   VERIFY_IS_CWISE_EQUAL(ref.bottomRightCorner(blockRows, blockCols), dst.bottomRightCorner(blockRows, blockCols));
 }
 
+template <typename Scalar, int DstOrder>
+void test_threaded_product(Index rows, Index depth, Index cols) {
+  using Mat = Matrix<Scalar, Dynamic, Dynamic>;
+  using DstMat = Matrix<Scalar, Dynamic, Dynamic, DstOrder>;
+
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+
+  Mat a = Mat::Random(rows, depth), b = Mat::Random(depth, cols);
+  DstMat dst(rows, cols), ref(rows, cols);
+
+  // general matrix products
+  ref = a * b;
+  dst.device(device).noalias() = a * b;
+  VERIFY_IS_APPROX(dst, ref);
+  ref += a * b;
+  dst.device(device).noalias() += a * b;
+  VERIFY_IS_APPROX(dst, ref);
+  ref -= Scalar(3) * a * b.conjugate();
+  dst.device(device).noalias() -= Scalar(3) * a * b.conjugate();
+  VERIFY_IS_APPROX(dst, ref);
+  Mat at = a.adjoint();
+  ref = at.adjoint() * b;
+  dst.setZero();
+  dst.device(device).noalias() = at.adjoint() * b;
+  VERIFY_IS_APPROX(dst, ref);
+  DstMat resized;
+  resized.device(device).noalias() = a * b;
+  VERIFY_IS_APPROX(resized, ref);
+
+  // triangular and selfadjoint products, with the dense operand on either side
+  Mat sq = Mat::Random(rows, rows), sq2 = Mat::Random(cols, cols);
+  ref = sq.template triangularView<Lower>() * (a * b);
+  dst.device(device).noalias() = sq.template triangularView<Lower>() * (a * b);
+  VERIFY_IS_APPROX(dst, ref);
+  ref += (a * b) * sq2.template triangularView<UnitUpper>();
+  dst.device(device).noalias() += (a * b) * sq2.template triangularView<UnitUpper>();
+  VERIFY_IS_APPROX(dst, ref);
+  ref = sq.template selfadjointView<Upper>() * (a * b);
+  dst.device(device).noalias() = sq.template selfadjointView<Upper>() * (a * b);
+  VERIFY_IS_APPROX(dst, ref);
+  ref -= (a * b) * sq2.template selfadjointView<Lower>();
+  dst.device(device).noalias() -= (a * b) * sq2.template selfadjointView<Lower>();
+  VERIFY_IS_APPROX(dst, ref);
+
+  // matrix-vector products, with the vector on either side
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  using RowVec = Matrix<Scalar, 1, Dynamic>;
+  Vec x = Vec::Random(depth), y(rows);
+  y.device(device).noalias() = a * x;
+  VERIFY_IS_APPROX(y, (a * x).eval());
+  y.device(device).noalias() -= Scalar(2) * a.conjugate() * x;
+  VERIFY_IS_APPROX(y, (a * x - Scalar(2) * a.conjugate() * x).eval());
+  RowVec u = RowVec::Random(rows), v(depth);
+  v.device(device).noalias() = u * a;
+  VERIFY_IS_APPROX(v, (u * a).eval());
+  // and with runtime vectors, given as matrices of one column or row
+  Mat xm = x, um = u;
+  DstMat ym(rows, 1), vm(1, depth);
+  ym.device(device).noalias() = a * xm;
+  VERIFY_IS_APPROX(ym, (a * x).eval());
+  vm.device(device).noalias() = um * a;
+  VERIFY_IS_APPROX(vm, (u * a).eval());
+
+  // products issued from the tasks of another pool, each on its own device
+  ThreadPool outer(2);
+  Barrier barrier(2);
+  DstMat results[2];
+  for (int i = 0; i < 2; ++i) {
+    outer.Schedule([&, i]() {
+      results[i].resize(rows, cols);
+      results[i].device(device).noalias() = a * b;
+      barrier.Notify();
+    });
+  }
+  barrier.Wait();
+  ref = a * b;
+  VERIFY_IS_APPROX(results[0], ref);
+  VERIFY_IS_APPROX(results[1], ref);
+
+  // products issued from a task of the device's own pool are evaluated sequentially
+  Barrier inner(1);
+  pool.Schedule([&]() {
+    dst.device(device).noalias() = a * b;
+    inner.Notify();
+  });
+  inner.Wait();
+  VERIFY_IS_APPROX(dst, ref);
+}
+
+template <typename Scalar>
+void test_threaded_fixed_product() {
+  using Mat = Matrix<Scalar, 40, 40>;
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+  Mat a = Mat::Random(), b = Mat::Random(), dst;
+  dst.device(device).noalias() = a * b;
+  VERIFY_IS_APPROX(dst, (a * b).eval());
+}
+
 EIGEN_DECLARE_TEST(assignment_threaded) {
   for (int i = 0; i < g_repeat; i++) {
     CALL_SUBTEST(test_threaded_assignment(MatrixXd(), 123, 123));
     CALL_SUBTEST(test_threaded_assignment(Matrix<float, 16, 16>()));
+    CALL_SUBTEST((test_threaded_product<float, ColMajor>(internal::random<Index>(1, 300),
+                                                         internal::random<Index>(1, 300),
+                                                         internal::random<Index>(1, 300))));
+    CALL_SUBTEST((test_threaded_product<double, RowMajor>(internal::random<Index>(1, 300),
+                                                          internal::random<Index>(1, 300),
+                                                          internal::random<Index>(1, 300))));
+    CALL_SUBTEST((test_threaded_product<std::complex<float>, ColMajor>(internal::random<Index>(1, 150),
+                                                                       internal::random<Index>(1, 150),
+                                                                       internal::random<Index>(1, 150))));
+    CALL_SUBTEST(test_threaded_fixed_product<float>());
   }
+  CALL_SUBTEST((test_threaded_product<float, ColMajor>(500, 400, 600)));
+  CALL_SUBTEST((test_threaded_product<double, RowMajor>(700, 300, 200)));
 }
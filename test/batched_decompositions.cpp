@@ -0,0 +1,166 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+#include <Eigen/Cholesky>
+#include <Eigen/LU>
+#include <Eigen/Eigenvalues>
+#include <Eigen/Geometry>
+
+// Batches are stored as structures of arrays: row b of a batch holds the coefficients of its b-th object.
+// The batch sizes below are not multiples of the packet sizes, so that the scalar remainder is exercised.
+
+template <typename Scalar, int Size>
+Matrix<Scalar, Size, Size> batch_matrix(const Matrix<Scalar, Dynamic, Dynamic>& batch, Index b) {
+  return Map<const Matrix<Scalar, Size, Size>, 0, InnerStride<>>(batch.data() + b, InnerStride<>(batch.rows()));
+}
+
+template <typename Scalar, int Size>
+void batched_llt(Index batchSize) {
+  using MatrixType = Matrix<Scalar, Size, Size>;
+  using VectorType = Matrix<Scalar, Size, 1>;
+  Matrix<Scalar, Dynamic, Dynamic> matrices(batchSize, Size * Size), rhs(batchSize, Size);
+  for (Index b = 0; b < batchSize; ++b) {
+    const MatrixType a = MatrixType::Random();
+    const MatrixType spd = a * a.adjoint() + MatrixType::Identity();
+    matrices.row(b) = spd.reshaped().transpose();
+    rhs.row(b) = VectorType::Random().transpose();
+  }
+  const Matrix<Scalar, Dynamic, Dynamic> original = matrices, originalRhs = rhs;
+
+  VERIFY_IS_EQUAL(batchedLLT<Size>(matrices), Success);
+  batchedLLTSolve<Size>(matrices, rhs);
+  for (Index b = 0; b < batchSize; ++b) {
+    const MatrixType a = batch_matrix<Scalar, Size>(original, b);
+    LLT<MatrixType> ref(a);
+    const MatrixType l = batch_matrix<Scalar, Size>(matrices, b).template triangularView<Lower>();
+    VERIFY_IS_APPROX(l, MatrixType(ref.matrixL()));
+    // The strictly upper part is left untouched.
+    VERIFY_IS_EQUAL(MatrixType(batch_matrix<Scalar, Size>(matrices, b).template triangularView<StrictlyUpper>()),
+                    MatrixType(a.template triangularView<StrictlyUpper>()));
+    VERIFY_IS_APPROX(a * rhs.row(b).transpose(), originalRhs.row(b).transpose());
+  }
+
+  // A single indefinite matrix is reported.
+  if (batchSize > 0) {
+    matrices = original;
+    const Index bad = internal::random<Index>(0, batchSize - 1);
+    matrices(bad, 0) = -Scalar(1);
+    VERIFY_IS_EQUAL(batchedLLT<Size>(matrices), NumericalIssue);
+  }
+}
+
+template <typename Scalar, int Size>
+void batched_lu(Index batchSize) {
+  using MatrixType = Matrix<Scalar, Size, Size>;
+  using VectorType = Matrix<Scalar, Size, 1>;
+  Matrix<Scalar, Dynamic, Dynamic> matrices(batchSize, Size * Size), rhs(batchSize, Size);
+  // Well conditioned, but with the rows in an order that needs pivoting.
+  for (Index b = 0; b < batchSize; ++b) {
+    const MatrixType a = (MatrixType::Random() + Scalar(Size) * MatrixType::Identity()).colwise().reverse();
+    matrices.row(b) = a.reshaped().transpose();
+  }
+  rhs.setRandom();
+  // A singular matrix in the batch must not disturb the others.
+  if (batchSize > 1) matrices.row(1).segment(0, Size).setZero();
+  const Matrix<Scalar, Dynamic, Dynamic> original = matrices, originalRhs = rhs;
+  Matrix<int, Dynamic, Dynamic> transpositions(batchSize, Size);
+
+  batchedPartialPivLU<Size>(matrices, transpositions);
+  batchedPartialPivLUSolve<Size>(matrices, transpositions, rhs);
+  for (Index b = 0; b < batchSize; ++b) {
+    const MatrixType a = batch_matrix<Scalar, Size>(original, b);
+    PartialPivLU<MatrixType> ref(a);
+    VERIFY_IS_APPROX(MatrixType(batch_matrix<Scalar, Size>(matrices, b)), ref.matrixLU());
+    Transpositions<Size> tr;
+    for (int k = 0; k < Size; ++k) tr.coeffRef(k) = transpositions(b, k);
+    VERIFY_IS_EQUAL(PermutationMatrix<Size>(tr).indices(), ref.permutationP().indices());
+    if (b == 1) continue;
+    const VectorType x = rhs.row(b).transpose();
+    VERIFY_IS_APPROX(a * x, VectorType(originalRhs.row(b).transpose()));
+  }
+}
+
+template <typename Scalar>
+void batched_selfadjoint_eigen3x3(Index batchSize) {
+  using MatrixType = Matrix<Scalar, 3, 3>;
+  using VectorType = Matrix<Scalar, 3, 1>;
+  Matrix<Scalar, Dynamic, Dynamic> matrices(batchSize, 9), values(batchSize, 3), valuesOnly(batchSize, 3),
+      vectors(batchSize, 9);
+  for (Index b = 0; b < batchSize; ++b) {
+    MatrixType a = MatrixType::Random();
+    a = (a + a.adjoint()).eval();
+    switch (b % 5) {
+      case 1: {  // repeated eigenvalue
+        const MatrixType q = Quaternion<Scalar>::UnitRandom().toRotationMatrix();
+        a = q * VectorType(2, 1, 1).asDiagonal() * q.transpose();
+        break;
+      }
+      case 2:  // multiple of the identity
+        a = Scalar(3) * MatrixType::Identity();
+        break;
+      case 3:  // zero
+        a.setZero();
+        break;
+      default:
+        break;
+    }
+    // Garbage in the strictly upper part must be ignored.
+    a.template triangularView<StrictlyUpper>().setRandom();
+    matrices.row(b) = a.reshaped().transpose();
+  }
+
+  batchedSelfAdjointEigen3x3(matrices, valuesOnly);
+  batchedSelfAdjointEigen3x3(matrices, values, vectors);
+  VERIFY_IS_EQUAL(valuesOnly, values);
+  for (Index b = 0; b < batchSize; ++b) {
+    const MatrixType a = batch_matrix<Scalar, 3>(matrices, b).template selfadjointView<Lower>();
+    SelfAdjointEigenSolver<MatrixType> ref;
+    ref.computeDirect(a);
+    const VectorType eivals = values.row(b).transpose();
+    const MatrixType eivecs = batch_matrix<Scalar, 3>(vectors, b);
+    const Scalar scale = numext::maxi(a.cwiseAbs().maxCoeff(), Scalar(1));
+    VERIFY_IS_APPROX(eivals, ref.eigenvalues());
+    VERIFY_IS_MUCH_SMALLER_THAN((a * eivecs - eivecs * eivals.asDiagonal()).norm(), scale);
+    VERIFY_IS_UNITARY(eivecs);
+  }
+}
+
+template <typename Scalar>
+void batched_quaternion_product(Index batchSize) {
+  using QuaternionType = Quaternion<Scalar>;
+  Matrix<Scalar, Dynamic, 4> lhs(batchSize, 4), rhs(batchSize, 4), dst(batchSize, 4);
+  lhs.setRandom();
+  rhs.setRandom();
+  batchedQuaternionProduct(lhs, rhs, dst);
+  for (Index b = 0; b < batchSize; ++b) {
+    const QuaternionType p(lhs.row(b).transpose()), q(rhs.row(b).transpose());
+    VERIFY_IS_APPROX(dst.row(b).transpose(), (p * q).coeffs());
+  }
+  // In place.
+  batchedQuaternionProduct(lhs, rhs, lhs);
+  VERIFY_IS_APPROX(lhs, dst);
+}
+
+EIGEN_DECLARE_TEST(batched_decompositions) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index batchSize = internal::random<Index>(0, 100);
+    CALL_SUBTEST_1((batched_llt<double, 3>(batchSize)));
+    CALL_SUBTEST_1((batched_llt<double, 6>(batchSize)));
+    CALL_SUBTEST_2((batched_llt<float, 4>(batchSize)));
+    CALL_SUBTEST_2((batched_llt<float, 1>(batchSize)));
+    CALL_SUBTEST_3((batched_lu<double, 3>(batchSize)));
+    CALL_SUBTEST_3((batched_lu<double, 6>(batchSize)));
+    CALL_SUBTEST_4((batched_lu<float, 4>(batchSize)));
+    CALL_SUBTEST_5(batched_selfadjoint_eigen3x3<double>(batchSize));
+    CALL_SUBTEST_6(batched_selfadjoint_eigen3x3<float>(batchSize));
+    CALL_SUBTEST_7(batched_quaternion_product<double>(batchSize));
+    CALL_SUBTEST_7(batched_quaternion_product<float>(batchSize));
+  }
+}
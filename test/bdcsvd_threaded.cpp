@@ -0,0 +1,92 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "threaded_device.h"
+#include <Eigen/SVD>
+
+template <typename MatrixType, int Options>
+void test_threaded_bdcsvd(const MatrixType& a, CoreThreadPoolDevice& device, int switchSize = 16) {
+  typedef typename MatrixType::RealScalar RealScalar;
+  const Index diagSize = (std::min)(a.rows(), a.cols());
+
+  BDCSVD<MatrixType, Options> ref;
+  ref.setSwitchSize(switchSize);
+  ref.compute(a);
+  BDCSVD<MatrixType, Options> svd;
+  svd.setSwitchSize(switchSize);
+  svd.compute(a, device);
+  VERIFY_IS_EQUAL(svd.info(), Success);
+  VERIFY_IS_APPROX(svd.singularValues(), ref.singularValues());
+
+  if (svd.computeU() && svd.computeV()) {
+    const MatrixType u = svd.matrixU().leftCols(diagSize);
+    const MatrixType v = svd.matrixV().leftCols(diagSize);
+    VERIFY_IS_APPROX(u * svd.singularValues().asDiagonal() * v.adjoint(), a);
+    VERIFY_IS_UNITARY(svd.matrixU());
+    VERIFY_IS_UNITARY(svd.matrixV());
+  }
+  // The threaded merges combine the same subproblems, so only the rounding of the matrix products may differ.
+  VERIFY((svd.singularValues() - ref.singularValues()).cwiseAbs().maxCoeff() <=
+         RealScalar(64) * NumTraits<RealScalar>::epsilon() * ref.singularValues()(0));
+}
+
+// A matrix with clusters of equal singular values, so that the merges deflate.
+template <typename MatrixType>
+MatrixType clustered_matrix(Index rows, Index cols) {
+  typedef typename MatrixType::RealScalar RealScalar;
+  const Index diagSize = (std::min)(rows, cols);
+  Matrix<RealScalar, Dynamic, 1> sigma(diagSize);
+  for (Index i = 0; i < diagSize; ++i) sigma(i) = RealScalar(1 + (i % 7) / 2);
+  sigma.tail(diagSize / 10).setZero();
+  const MatrixType u = HouseholderQR<MatrixType>(MatrixType::Random(rows, rows)).householderQ();
+  const MatrixType v = HouseholderQR<MatrixType>(MatrixType::Random(cols, cols)).householderQ();
+  return u.leftCols(diagSize) * sigma.asDiagonal() * v.leftCols(diagSize).adjoint();
+}
+
+template <typename MatrixType>
+void test_threaded_bidiagonalization(Index rows, Index cols, CoreThreadPoolDevice& device) {
+  typedef Matrix<typename MatrixType::RealScalar, Dynamic, Dynamic> RealMatrixType;
+  const MatrixType a = MatrixType::Random(rows, cols);
+  internal::UpperBidiagonalization<MatrixType> ref(a);
+  internal::UpperBidiagonalization<MatrixType> ubd(rows, cols);
+  ubd.compute(a, device);
+  RealMatrixType b = RealMatrixType::Zero(rows, cols);
+  b.topRows(cols) = ubd.bidiagonal();
+  VERIFY_IS_APPROX(b.topRows(cols), RealMatrixType(ref.bidiagonal()));
+  MatrixType c = ubd.householderU() * b * ubd.householderV().adjoint();
+  VERIFY_IS_APPROX(a, c);
+}
+
+void test_threaded_bdcsvd_products(CoreThreadPoolDevice& device, ThreadPool& pool) {
+  // The products of the merges, in the tasks of the device or on the calling thread, do not start more threads.
+  MatrixXd a = MatrixXd::Random(400, 400);
+  BDCSVD<MatrixXd, ComputeThinU | ComputeThinV> svd;
+  verify_device_products_sequential(pool, [&]() { svd.compute(a, device); });
+  VERIFY_IS_APPROX(svd.matrixU() * svd.singularValues().asDiagonal() * svd.matrixV().adjoint(), a);
+}
+
+EIGEN_DECLARE_TEST(bdcsvd_threaded) {
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+  CALL_SUBTEST_1((test_threaded_bdcsvd<MatrixXd, ComputeThinU | ComputeThinV>(MatrixXd::Random(600, 600), device)));
+  CALL_SUBTEST_1((test_threaded_bdcsvd<MatrixXd, 0>(MatrixXd::Random(700, 520), device)));
+  CALL_SUBTEST_1((test_threaded_bdcsvd<MatrixXd, ComputeFullU | ComputeFullV>(MatrixXd::Random(300, 300), device, 4)));
+  // Too small to be split.
+  CALL_SUBTEST_1((test_threaded_bdcsvd<MatrixXd, ComputeThinU | ComputeThinV>(MatrixXd::Random(120, 90), device)));
+  CALL_SUBTEST_2((test_threaded_bdcsvd<MatrixXf, ComputeFullU | ComputeFullV>(MatrixXf::Random(410, 530), device)));
+  CALL_SUBTEST_2((test_threaded_bdcsvd<MatrixXf, ComputeThinV>(MatrixXf::Random(450, 450), device)));
+  CALL_SUBTEST_3((test_threaded_bdcsvd<MatrixXcd, ComputeThinU | ComputeThinV>(MatrixXcd::Random(350, 350), device)));
+  CALL_SUBTEST_4((test_threaded_bdcsvd<MatrixXd, ComputeThinU | ComputeThinV>(
+      clustered_matrix<MatrixXd>(640, 600), device)));
+  CALL_SUBTEST_4((test_threaded_bdcsvd<MatrixXd, 0>(clustered_matrix<MatrixXd>(500, 500), device)));
+  CALL_SUBTEST_5(test_threaded_bdcsvd_products(device, pool));
+  CALL_SUBTEST_6(test_threaded_bidiagonalization<MatrixXd>(500, 400, device));
+  CALL_SUBTEST_6(test_threaded_bidiagonalization<MatrixXf>(300, 300, device));
+  CALL_SUBTEST_6(test_threaded_bidiagonalization<MatrixXcd>(260, 250, device));
+  CALL_SUBTEST_6((test_threaded_bidiagonalization<Matrix<double, Dynamic, Dynamic, RowMajor>>(420, 380, device)));
+}
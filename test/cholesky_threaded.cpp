@@ -0,0 +1,55 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "threaded_device.h"
+#include <Eigen/Cholesky>
+
+template <typename MatrixType, int UpLo>
+void test_tiled_llt(Index size, CoreThreadPoolDevice& device) {
+  using Scalar = typename MatrixType::Scalar;
+  MatrixType a = MatrixType::Random(size, size);
+  MatrixType symm = a * a.adjoint();
+  symm.diagonal().array() += Scalar(size);
+
+  LLT<MatrixType, UpLo> ref(symm);
+  LLT<MatrixType, UpLo> llt(symm, device);
+  VERIFY_IS_EQUAL(llt.info(), Success);
+  VERIFY_IS_APPROX(llt.reconstructedMatrix(), symm);
+  VERIFY_IS_APPROX(MatrixType(llt.matrixL()), MatrixType(ref.matrixL()));
+  VERIFY_IS_APPROX(llt.rcond(), ref.rcond());
+
+  MatrixType b = MatrixType::Random(size, 3);
+  VERIFY_IS_APPROX(symm * llt.solve(b), b);
+
+  // A matrix which is not positive definite in its last tile.
+  symm(size - 2, size - 2) = -Scalar(size);
+  llt.compute(symm, device);
+  VERIFY_IS_EQUAL(llt.info(), NumericalIssue);
+}
+
+void test_tiled_llt_products(CoreThreadPoolDevice& device, ThreadPool& pool) {
+  MatrixXd a = MatrixXd::Random(600, 600);
+  MatrixXd symm = a * a.adjoint();
+  symm.diagonal().array() += 600.0;
+  LLT<MatrixXd> llt;
+  verify_device_products_sequential(pool, [&]() { llt.compute(symm, device); });
+  VERIFY_IS_EQUAL(llt.info(), Success);
+  VERIFY_IS_APPROX(llt.reconstructedMatrix(), symm);
+}
+
+EIGEN_DECLARE_TEST(cholesky_threaded) {
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+  // Sizes with a partial last tile, and a matrix too small to be tiled.
+  CALL_SUBTEST_1((test_tiled_llt<MatrixXd, Lower>(1100, device)));
+  CALL_SUBTEST_1((test_tiled_llt<MatrixXd, Upper>(777, device)));
+  CALL_SUBTEST_1((test_tiled_llt<MatrixXd, Lower>(300, device)));
+  CALL_SUBTEST_2((test_tiled_llt<MatrixXf, Lower>(1024, device)));
+  CALL_SUBTEST_3((test_tiled_llt<Matrix<std::complex<double>, Dynamic, Dynamic, RowMajor>, Upper>(600, device)));
+  CALL_SUBTEST_4(test_tiled_llt_products(device, pool));
+}
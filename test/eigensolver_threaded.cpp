@@ -0,0 +1,88 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "threaded_device.h"
+#include <Eigen/Eigenvalues>
+
+template <typename MatrixType>
+void test_two_stage_eigensolver(Index size, CoreThreadPoolDevice& device) {
+  using RealScalar = typename MatrixType::RealScalar;
+  MatrixType a = MatrixType::Random(size, size);
+  MatrixType symm = a + a.adjoint();
+
+  SelfAdjointEigenSolver<MatrixType> ref(symm, EigenvaluesOnly);
+  SelfAdjointEigenSolver<MatrixType> values(symm, device, EigenvaluesOnly);
+  VERIFY_IS_EQUAL(values.info(), Success);
+  VERIFY_IS_APPROX(values.eigenvalues(), ref.eigenvalues());
+
+  // Only the lower triangular part is referenced.
+  MatrixType lower = symm.template triangularView<Lower>();
+  SelfAdjointEigenSolver<MatrixType> eig;
+  eig.compute(lower, device);
+  VERIFY_IS_EQUAL(eig.info(), Success);
+  VERIFY_IS_APPROX(eig.eigenvalues(), ref.eigenvalues());
+  const MatrixType& vectors = eig.eigenvectors();
+  VERIFY(vectors.isUnitary(test_precision<RealScalar>() * RealScalar(size)));
+  VERIFY_IS_APPROX(symm * vectors, vectors * eig.eigenvalues().asDiagonal());
+}
+
+// Checks both stages with a narrow band, on sizes with partial panels and short bulge chases.
+template <typename MatrixType>
+void test_band_reduction(Index size, Index bandwidth, CoreThreadPoolDevice& device) {
+  using RealScalar = typename MatrixType::RealScalar;
+  using RealVectorType = Matrix<RealScalar, Dynamic, 1>;
+  MatrixType a = MatrixType::Random(size, size);
+  MatrixType symm = a + a.adjoint();
+
+  MatrixType mat = symm;
+  Matrix<typename MatrixType::Scalar, Dynamic, 1> hCoeffs(size - 1);
+  internal::tridiagonalization_band_inplace(mat, hCoeffs, bandwidth, device);
+  MatrixType Q;
+  internal::tridiagonalization_band_householder_q(mat, hCoeffs, bandwidth, Q, device);
+  MatrixType band = MatrixType(mat.template triangularView<Lower>()).template selfadjointView<Lower>();
+  for (Index j = 0; j < size; ++j)
+    for (Index i = j + bandwidth + 1; i < size; ++i) band(i, j) = band(j, i) = 0;
+  VERIFY_IS_APPROX(Q * band * Q.adjoint(), symm);
+
+  internal::band_tridiagonalization<typename MatrixType::Scalar> reduction(mat, bandwidth, true);
+  reduction.reduce();
+  RealVectorType diag(size), subdiag(size - 1);
+  reduction.extract(diag, subdiag);
+  reduction.applyOnTheRight(Q, device);
+  MatrixType tridiag = MatrixType::Zero(size, size);
+  tridiag.diagonal() = diag.template cast<typename MatrixType::Scalar>();
+  tridiag.template diagonal<-1>() = subdiag.template cast<typename MatrixType::Scalar>();
+  tridiag.template diagonal<1>() = subdiag.template cast<typename MatrixType::Scalar>();
+  VERIFY(Q.isUnitary(test_precision<RealScalar>() * RealScalar(size)));
+  VERIFY_IS_APPROX(Q * tridiag * Q.adjoint(), symm);
+}
+
+void test_two_stage_eigensolver_products(CoreThreadPoolDevice& device, ThreadPool& pool) {
+  // The products of both stages, including the rank-2k updates of the chunks, do not start more threads.
+  MatrixXd a = MatrixXd::Random(600, 600);
+  MatrixXd symm = a + a.adjoint();
+  SelfAdjointEigenSolver<MatrixXd> eig;
+  verify_device_products_sequential(pool, [&]() { eig.compute(symm, device); });
+  VERIFY_IS_EQUAL(eig.info(), Success);
+  VERIFY_IS_APPROX(symm * eig.eigenvectors(), eig.eigenvectors() * eig.eigenvalues().asDiagonal());
+}
+
+EIGEN_DECLARE_TEST(eigensolver_threaded) {
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+  CALL_SUBTEST_1(test_band_reduction<MatrixXd>(57, 4, device));
+  CALL_SUBTEST_1(test_band_reduction<MatrixXd>(40, 1, device));
+  CALL_SUBTEST_1(test_band_reduction<MatrixXd>(23, 7, device));
+  CALL_SUBTEST_2(test_band_reduction<MatrixXcd>(45, 5, device));
+  // Sizes with a partial last panel, and a matrix too small for the two-stage reduction.
+  CALL_SUBTEST_3(test_two_stage_eigensolver<MatrixXd>(600, device));
+  CALL_SUBTEST_3(test_two_stage_eigensolver<MatrixXd>(100, device));
+  CALL_SUBTEST_4(test_two_stage_eigensolver<MatrixXf>(530, device));
+  CALL_SUBTEST_5(test_two_stage_eigensolver<MatrixXcd>(520, device));
+  CALL_SUBTEST_6(test_two_stage_eigensolver_products(device, pool));
+}
@@ -0,0 +1,148 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+#include <Eigen/LU>
+#include <Eigen/Cholesky>
+
+// A well-conditioned matrix, selfadjoint positive definite if requested.
+template <typename MatrixType>
+MatrixType well_conditioned_matrix(Index size, bool selfadjoint) {
+  MatrixType a = MatrixType::Random(size, size);
+  if (selfadjoint) return a * a.adjoint() / typename MatrixType::Scalar(size) + MatrixType::Identity(size, size);
+  return a + typename MatrixType::Scalar(size) * MatrixType::Identity(size, size);
+}
+
+template <typename Decomposition>
+void iterative_refinement(Index size, bool selfadjoint) {
+  using Solver = IterativeRefinement<Decomposition>;
+  using MatrixType = typename Solver::MatrixType;
+  using Scalar = typename MatrixType::Scalar;
+  using RealScalar = typename NumTraits<Scalar>::Real;
+  using DenseMatrix = Matrix<Scalar, Dynamic, Dynamic>;
+
+  const MatrixType a = well_conditioned_matrix<MatrixType>(size, selfadjoint);
+  const DenseMatrix b = DenseMatrix::Random(size, 3);
+  Solver solver(a);
+  VERIFY_IS_EQUAL(solver.info(), Success);
+
+  // The solution has the accuracy of the working precision, beyond what the low precision could give.
+  const DenseMatrix x = solver.solve(b);
+  VERIFY(!solver.usesFallback());
+  DenseMatrix xr;
+  Index iterations = -1;
+  VERIFY_IS_EQUAL(solver.refinedSolve(b, xr, &iterations), Success);
+  VERIFY_IS_CWISE_EQUAL(xr, x);
+  VERIFY(iterations > 0);
+  VERIFY(iterations <= solver.maxIterations());
+  const RealScalar aNorm = a.cwiseAbs().rowwise().sum().maxCoeff();
+  for (Index j = 0; j < b.cols(); ++j) {
+    const RealScalar residual = (b.col(j) - a * x.col(j)).template lpNorm<Infinity>();
+    VERIFY(residual <= solver.tolerance() * aNorm * x.col(j).template lpNorm<Infinity>());
+  }
+  VERIFY_IS_APPROX(x, DenseMatrix(a.partialPivLu().solve(b)));
+
+  const Matrix<Scalar, Dynamic, 1> x0 = solver.solve(b.col(0));
+  VERIFY_IS_APPROX(x0, x.col(0));
+
+  // No refinement step can succeed with no iteration allowed, which leaves the low precision solution, and the
+  // solver unchanged until the fallback is asked for.
+  solver.setMaxIterations(0);
+  VERIFY_IS_EQUAL(solver.refinedSolve(b, xr, &iterations), NoConvergence);
+  VERIFY_IS_EQUAL(iterations, 0);
+  VERIFY_IS_CWISE_EQUAL(DenseMatrix(solver.solve(b)), xr);
+  VERIFY(!solver.usesFallback());
+  VERIFY_IS_EQUAL(solver.info(), Success);
+  solver.computeFallback();
+  VERIFY(solver.usesFallback());
+  VERIFY_IS_EQUAL(solver.info(), Success);
+  VERIFY_IS_EQUAL(solver.refinedSolve(b, xr), Success);
+  VERIFY_IS_APPROX(xr, x);
+
+  // A new decomposition starts again from the low precision.
+  solver.setMaxIterations(30).compute(a);
+  VERIFY(!solver.usesFallback());
+}
+
+template <typename Decomposition>
+void iterative_refinement_fallback(Index size) {
+  using Solver = IterativeRefinement<Decomposition>;
+  using MatrixType = typename Solver::MatrixType;
+  using Scalar = typename MatrixType::Scalar;
+  using DenseMatrix = Matrix<Scalar, Dynamic, Dynamic>;
+  const DenseMatrix b = DenseMatrix::Random(size, 2);
+
+  // Too ill-conditioned for the low precision: singular values from 1 to 1e-10.
+  {
+    MatrixType u = MatrixType::Random(size, size).householderQr().householderQ();
+    Matrix<Scalar, Dynamic, 1> s(size);
+    for (Index i = 0; i < size; ++i) s(i) = Scalar(std::pow(10.0, -10.0 * double(i) / double(size - 1)));
+    const MatrixType a = u * s.asDiagonal() * u.adjoint();
+    Solver solver(a);
+    VERIFY(solver.usesFallback());
+    const DenseMatrix x = solver.solve(b);
+    VERIFY_IS_EQUAL(solver.info(), Success);
+    VERIFY_IS_APPROX(x, DenseMatrix(solver.fallbackDecomposition().solve(b)));
+  }
+
+  // Not representable in the low precision.
+  {
+    const MatrixType a = well_conditioned_matrix<MatrixType>(size, true) * Scalar(1e300);
+    Solver solver(a);
+    VERIFY(solver.usesFallback());
+    VERIFY_IS_APPROX(DenseMatrix(a * solver.solve(b)), b);
+  }
+}
+
+// The growth of the LU factors of a Wilkinson-like matrix ruins the low precision solves although the matrix is well
+// conditioned, so that the residuals of the refinement grow while they remain finite.
+void iterative_refinement_divergence() {
+  const Index size = 100;
+  MatrixXd a = MatrixXd::Identity(size, size);
+  a.triangularView<StrictlyLower>().setConstant(-1);
+  for (Index i = 0; i + 1 < size; ++i) a(i, size - 1) = std::sin(double(i + 1));
+  const VectorXd b = VectorXd::Ones(size);
+
+  IterativeRefinement<PartialPivLU<MatrixXf>> solver(a);
+  VERIFY(!solver.usesFallback());
+  VectorXd x;
+  Index iterations = -1;
+  VERIFY_IS_EQUAL(solver.refinedSolve(b, x, &iterations), NoConvergence);
+  // The refinement stops once the residual grows, with the iterate of smallest residual.
+  VERIFY(iterations < solver.maxIterations());
+  VERIFY(x.allFinite());
+  const VectorXd x0 = solver.decomposition().solve(b.cast<float>()).cast<double>();
+  VERIFY((b - a * x).lpNorm<Infinity>() <= (b - a * x0).lpNorm<Infinity>());
+  VERIFY_IS_CWISE_EQUAL(VectorXd(solver.solve(b)), x);
+  VERIFY(!solver.usesFallback());
+}
+
+EIGEN_DECLARE_TEST(iterative_refinement) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index size = internal::random<Index>(2, EIGEN_TEST_MAX_SIZE / 2);
+    CALL_SUBTEST_1(iterative_refinement<PartialPivLU<MatrixXf>>(size, false));
+    CALL_SUBTEST_1(iterative_refinement_fallback<PartialPivLU<MatrixXf>>(size));
+    CALL_SUBTEST_2(iterative_refinement<LLT<MatrixXf>>(size, true));
+    CALL_SUBTEST_2((iterative_refinement<LDLT<MatrixXf, Upper>>(size, true)));
+    CALL_SUBTEST_2(iterative_refinement_fallback<LLT<MatrixXf>>(size));
+    CALL_SUBTEST_3(iterative_refinement<PartialPivLU<MatrixXcf>>(size, false));
+    CALL_SUBTEST_3(iterative_refinement<LLT<MatrixXcf>>(size, true));
+    CALL_SUBTEST_4((iterative_refinement<PartialPivLU<Matrix4f>>(4, false)));
+    CALL_SUBTEST_4((iterative_refinement<LLT<Matrix<float, 3, 3, RowMajor>>>(3, true)));
+    EIGEN_UNUSED_VARIABLE(size);
+  }
+  CALL_SUBTEST_1(iterative_refinement_divergence());
+
+  // An indefinite matrix fails in both precisions.
+  CALL_SUBTEST_2({
+    IterativeRefinement<LLT<MatrixXf>> solver(-MatrixXd::Identity(4, 4));
+    VERIFY(solver.usesFallback());
+    VERIFY_IS_EQUAL(solver.info(), NumericalIssue);
+  });
+}
@@ -213,6 +213,34 @@ static void test_complex_key() {
   VERIFY(cache.find(Key{9, 9}) == nullptr);
 }
 
+static void test_for_each_order() {
+  LruCache<int, int> cache(3);
+  cache.insert(1, 100);
+  cache.insert(2, 200);
+  cache.insert(3, 300);
+  cache.find(1);
+  std::vector<int> keys;
+  int sum = 0;
+  cache.forEach([&](const int& k, const int& v) {
+    keys.push_back(k);
+    sum += v;
+  });
+  // Least recently used first, and visiting does not promote.
+  VERIFY_IS_EQUAL(keys.size(), std::size_t(3));
+  VERIFY_IS_EQUAL(keys[0], 2);
+  VERIFY_IS_EQUAL(keys[1], 3);
+  VERIFY_IS_EQUAL(keys[2], 1);
+  VERIFY_IS_EQUAL(sum, 600);
+
+  // Re-inserting in visiting order reproduces the eviction order.
+  LruCache<int, int> copy(3);
+  cache.forEach([&](const int& k, const int& v) { copy.insert(k, v); });
+  copy.insert(4, 400);
+  VERIFY(copy.find(2) == nullptr);
+  VERIFY(copy.find(3) != nullptr);
+  VERIFY(copy.find(1) != nullptr);
+}
+
 EIGEN_DECLARE_TEST(lru_cache) {
   CALL_SUBTEST(test_basic_get_and_miss());
   CALL_SUBTEST(test_lru_eviction());
@@ -224,4 +252,5 @@ EIGEN_DECLARE_TEST(lru_cache) {
   CALL_SUBTEST(test_move_semantics());
   CALL_SUBTEST(test_capacity_one());
   CALL_SUBTEST(test_complex_key());
+  CALL_SUBTEST(test_for_each_order());
 }
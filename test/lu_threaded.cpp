@@ -0,0 +1,54 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "threaded_device.h"
+#include <Eigen/LU>
+
+template <typename MatrixType>
+void test_threaded_partial_lu(Index size, CoreThreadPoolDevice& device) {
+  MatrixType a = MatrixType::Random(size, size);
+
+  PartialPivLU<MatrixType> ref(a);
+  PartialPivLU<MatrixType> lu(a, device);
+  VERIFY_IS_APPROX(lu.reconstructedMatrix(), a);
+  // Scaled so that the determinant does not overflow.
+  using std::exp;
+  const typename MatrixType::RealScalar logDet = ref.matrixLU().diagonal().cwiseAbs().array().log().sum();
+  const MatrixType scaled = a * exp(-logDet / typename MatrixType::RealScalar(size));
+  VERIFY_IS_APPROX(PartialPivLU<MatrixType>(scaled, device).determinant(),
+                   PartialPivLU<MatrixType>(scaled).determinant());
+  // Partial pivoting keeps the multipliers bounded by one.
+  VERIFY(lu.matrixLU().template triangularView<StrictlyLower>().toDenseMatrix().cwiseAbs().maxCoeff() <=
+         typename MatrixType::RealScalar(1));
+
+  MatrixType b = MatrixType::Random(size, 4);
+  VERIFY_IS_APPROX(a * lu.solve(b), b);
+}
+
+void test_threaded_partial_lu_products(CoreThreadPoolDevice& device, ThreadPool& pool) {
+  // The products of the tasks of the graph, and of the fallback for small matrices, do not start more threads.
+  MatrixXd a = MatrixXd::Random(700, 700), small = MatrixXd::Random(300, 300);
+  PartialPivLU<MatrixXd> lu, luSmall;
+  verify_device_products_sequential(pool, [&]() {
+    lu.compute(a, device);
+    luSmall.compute(small, device);
+  });
+  VERIFY_IS_APPROX(lu.reconstructedMatrix(), a);
+  VERIFY_IS_APPROX(luSmall.reconstructedMatrix(), small);
+}
+
+EIGEN_DECLARE_TEST(lu_threaded) {
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+  // Sizes with a partial last block column, and a matrix too small to be split.
+  CALL_SUBTEST_1(test_threaded_partial_lu<MatrixXd>(1100, device));
+  CALL_SUBTEST_1(test_threaded_partial_lu<MatrixXd>(300, device));
+  CALL_SUBTEST_2((test_threaded_partial_lu<Matrix<float, Dynamic, Dynamic, RowMajor>>(777, device)));
+  CALL_SUBTEST_3(test_threaded_partial_lu<MatrixXcd>(600, device));
+  CALL_SUBTEST_4(test_threaded_partial_lu_products(device, pool));
+}
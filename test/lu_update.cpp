@@ -0,0 +1,61 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+#include <Eigen/LU>
+
+template <typename MatrixType>
+void lu_update(Index size) {
+  using Scalar = typename MatrixType::Scalar;
+  using RealScalar = typename NumTraits<Scalar>::Real;
+  using VectorType = Matrix<Scalar, Dynamic, 1>;
+  // Well conditioned, so that the determinant can be compared in single precision too.
+  MatrixType a = MatrixType::Random(size, size) / Scalar(2 * size) + MatrixType::Identity(size, size);
+  UpdatableLU<MatrixType> lu(a);
+
+  for (int k = 0; k < 2 * size; ++k) {
+    // Replace columns at random positions, including the same column twice in a row.
+    const Index j = (k % 3 == 2) ? internal::random<Index>(0, size - 1) : (k * 7) % size;
+    VectorType column = VectorType::Random(size) / Scalar(2 * size);
+    column(j) += Scalar(1);
+    a.col(j) = column;
+    lu.replaceColumn(j, column);
+
+    const MatrixType u = lu.matrixU();
+    VERIFY_IS_EQUAL(MatrixType(u.template triangularView<StrictlyLower>()), MatrixType::Zero(size, size));
+    VERIFY_IS_APPROX(MatrixType(lu.matrixG() * a * lu.permutationQ()), u);
+
+    const PartialPivLU<MatrixType> ref(a);
+    const MatrixType rhs = MatrixType::Random(size, 2);
+    // The updates lose a little more accuracy than a new factorization, which depends on the conditioning of a.
+    const RealScalar refResidual = (a * ref.solve(rhs) - rhs).norm();
+    VERIFY((a * lu.solve(rhs) - rhs).norm() <=
+           RealScalar(100) * numext::maxi(refResidual, NumTraits<RealScalar>::epsilon() * rhs.norm()));
+    // The determinant is a product of n pivots, each with its own rounding error.
+    VERIFY(numext::abs(lu.determinant() - ref.determinant()) <=
+           RealScalar(size) * test_precision<Scalar>() * numext::abs(ref.determinant()));
+  }
+
+  // A new factorization starts again from a plain PartialPivLU.
+  lu.compute(a);
+  PermutationMatrix<Dynamic> identity(size);
+  identity.setIdentity();
+  VERIFY_IS_EQUAL(lu.permutationQ().indices(), identity.indices());
+  VERIFY_IS_APPROX(lu.determinant(), a.determinant());
+}
+
+EIGEN_DECLARE_TEST(lu_update) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index size = internal::random<Index>(1, EIGEN_TEST_MAX_SIZE / 4);
+    CALL_SUBTEST_1(lu_update<MatrixXd>(size));
+    CALL_SUBTEST_2(lu_update<MatrixXcf>(size));
+    CALL_SUBTEST_3((lu_update<Matrix<float, Dynamic, Dynamic, RowMajor>>(size)));
+    CALL_SUBTEST_4(lu_update<MatrixXcd>(size));
+  }
+}
@@ -0,0 +1,126 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#define EIGEN_GEMM_AUTOTUNE
+#include "main.h"
+
+#include <cstdio>
+
+template <typename Scalar, int Order>
+void autotuned_product(Index rows, Index depth, Index cols) {
+  typedef Matrix<Scalar, Dynamic, Dynamic, Order> Mat;
+  typedef Matrix<Scalar, Dynamic, Dynamic> ColMat;
+  Mat a = Mat::Random(rows, depth), b = Mat::Random(depth, cols), c(rows, cols);
+  ColMat ref = a.lazyProduct(b);
+
+  setGemmBlockingAutotuning(true);
+  c.noalias() = a * b;
+  VERIFY_IS_APPROX(c, ref);
+  // Products of a tuned shape class use the tuned sizes.
+  if (Order == ColMajor)
+    tuneGemmBlockingSizes<Scalar>(rows, cols, depth, 0.05);
+  else
+    tuneGemmBlockingSizes<Scalar>(cols, rows, depth, 0.05);
+  c.noalias() = a * b;
+  VERIFY_IS_APPROX(c, ref);
+  c.noalias() += a * b;
+  VERIFY_IS_APPROX(c, Scalar(2) * ref);
+}
+
+template <typename Scalar>
+void autotuned_blocking_sizes() {
+  typedef internal::gemm_blocking_space<ColMajor, Scalar, Scalar, Dynamic, Dynamic, Dynamic> Blocking;
+  clearGemmBlockingSizes();
+  setGemmBlockingAutotuning(true);
+  VERIFY(gemmBlockingAutotuning());
+
+  const Index rows = 300, cols = 200, depth = 500;
+  Index k = depth, m = rows, n = cols;
+  internal::computeProductBlockingSizes<Scalar, Scalar>(k, m, n);
+
+  // Products do not tune themselves.
+  Blocking untuned(rows, cols, depth, 1, true);
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(0));
+  VERIFY_IS_EQUAL(untuned.kc(), k);
+  VERIFY_IS_EQUAL(untuned.mc(), m);
+  VERIFY_IS_EQUAL(untuned.nc(), n);
+
+  // With a zero budget, only the heuristic is timed.
+  VERIFY(tuneGemmBlockingSizes<Scalar>(rows, cols, depth, 0));
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(1));
+  clearGemmBlockingSizes();
+
+  VERIFY(tuneGemmBlockingSizes<Scalar>(rows, cols, depth));
+  Blocking tuned(rows, cols, depth, 1, true);
+  VERIFY(tuned.kc() >= 1 && tuned.kc() <= depth);
+  VERIFY(tuned.mc() >= 1 && tuned.mc() <= rows);
+  VERIFY(tuned.nc() >= 1 && tuned.nc() <= cols);
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(1));
+
+  // Same shape class: no new entry, same sizes.
+  Blocking again(rows - 10, cols - 10, depth - 10, 1, true);
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(1));
+  VERIFY_IS_EQUAL(again.kc(), numext::mini(tuned.kc(), depth - 10));
+  VERIFY_IS_EQUAL(again.mc(), numext::mini(tuned.mc(), rows - 10));
+  VERIFY_IS_EQUAL(again.nc(), numext::mini(tuned.nc(), cols - 10));
+
+  // Small products are not tuned.
+  VERIFY(!tuneGemmBlockingSizes<Scalar>(16, 16, 16));
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(1));
+
+  // Saving and loading restores the table.
+  const char* filename = "product_autotune_blocking_sizes.txt";
+  VERIFY(saveGemmBlockingSizes(filename));
+  clearGemmBlockingSizes();
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(0));
+  VERIFY(loadGemmBlockingSizes(filename));
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(1));
+  Blocking loaded(rows, cols, depth, 1, true);
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(1));
+  VERIFY_IS_EQUAL(loaded.kc(), tuned.kc());
+  VERIFY_IS_EQUAL(loaded.mc(), tuned.mc());
+  VERIFY_IS_EQUAL(loaded.nc(), tuned.nc());
+
+  // Malformed files are rejected as a whole.
+  std::FILE* file = std::fopen(filename, "w");
+  VERIFY(file != nullptr);
+  std::fprintf(file, "1 2 3 4 1 5 6 7 8 9 10\nnot a blocking\n");
+  std::fclose(file);
+  clearGemmBlockingSizes();
+  VERIFY(!loadGemmBlockingSizes(filename));
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(0));
+  std::remove(filename);
+  VERIFY(!loadGemmBlockingSizes(filename));
+
+  // Disabled autotuning falls back to the heuristic.
+  setGemmBlockingAutotuning(false);
+  VERIFY(!gemmBlockingAutotuning());
+  Blocking heuristic(rows, cols, depth, 1, true);
+  VERIFY_IS_EQUAL(heuristic.kc(), k);
+  VERIFY_IS_EQUAL(heuristic.mc(), m);
+  VERIFY_IS_EQUAL(heuristic.nc(), n);
+  VERIFY_IS_EQUAL(internal::gemm_autotuned_blocking_table().cache.size(), std::size_t(0));
+  setGemmBlockingAutotuning(true);
+}
+
+EIGEN_DECLARE_TEST(product_autotune) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index s = EIGEN_TEST_MAX_SIZE;
+    EIGEN_UNUSED_VARIABLE(s);
+    CALL_SUBTEST_1((autotuned_product<float, ColMajor>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                                       internal::random<Index>(1, s))));
+    CALL_SUBTEST_2((autotuned_product<double, RowMajor>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                                        internal::random<Index>(1, s))));
+    CALL_SUBTEST_3((autotuned_product<std::complex<float>, ColMajor>(
+        internal::random<Index>(1, s / 2), internal::random<Index>(1, s / 2), internal::random<Index>(1, s / 2))));
+  }
+  CALL_SUBTEST_1((autotuned_product<float, ColMajor>(700, 900, 300)));
+  CALL_SUBTEST_4(autotuned_blocking_sizes<float>());
+  CALL_SUBTEST_4(autotuned_blocking_sizes<double>());
+}
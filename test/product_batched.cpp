@@ -0,0 +1,113 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+
+template <typename MatrixType>
+void batched_product_check(Index rows, Index depth, Index cols, Index batch) {
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic, MatrixType::Options> DenseType;
+
+  // Padded outer strides to exercise non-contiguous batches.
+  const Index lhsOuter = (MatrixType::IsRowMajor ? depth : rows) + internal::random<Index>(0, 2);
+  const Index rhsOuter = (MatrixType::IsRowMajor ? cols : depth) + internal::random<Index>(0, 2);
+  const Index dstOuter = MatrixType::IsRowMajor ? cols : rows;
+  const Index lhsBatchStride = lhsOuter * (MatrixType::IsRowMajor ? rows : depth) + internal::random<Index>(0, 3);
+  const Index rhsBatchStride = rhsOuter * (MatrixType::IsRowMajor ? depth : cols);
+  const Index dstBatchStride = dstOuter * (MatrixType::IsRowMajor ? rows : cols);
+
+  typedef Map<DenseType, Unaligned, OuterStride<>> MapType;
+  typedef Matrix<Scalar, Dynamic, 1> VectorType;
+  VectorType lhsData = VectorType::Random(numext::maxi<Index>(1, lhsBatchStride * batch));
+  VectorType rhsData = VectorType::Random(numext::maxi<Index>(1, rhsBatchStride * batch));
+  VectorType dstData = VectorType::Random(numext::maxi<Index>(1, dstBatchStride * batch));
+
+  auto lhs = [&](Index b, Index stride) {
+    return MapType(lhsData.data() + b * stride, rows, depth, OuterStride<>(lhsOuter));
+  };
+  auto rhs = [&](Index b, Index stride) {
+    return MapType(rhsData.data() + b * stride, depth, cols, OuterStride<>(rhsOuter));
+  };
+  auto dst = [&](Index b) { return MapType(dstData.data() + b * dstBatchStride, rows, cols, OuterStride<>(dstOuter)); };
+
+  // Independent operands.
+  batchedProduct(lhs(0, 0), rhs(0, 0), dst(0), batch, lhsBatchStride, rhsBatchStride, dstBatchStride);
+  for (Index b = 0; b < batch; ++b) {
+    DenseType ref = lhs(b, lhsBatchStride) * rhs(b, rhsBatchStride);
+    VERIFY_IS_APPROX(DenseType(dst(b)), ref);
+  }
+
+  // Shared lhs (e.g. a weight matrix applied to a batch of inputs).
+  batchedProduct(lhs(0, 0), rhs(0, 0), dst(0), batch, 0, rhsBatchStride, dstBatchStride);
+  for (Index b = 0; b < batch; ++b) {
+    DenseType ref = lhs(0, 0) * rhs(b, rhsBatchStride);
+    VERIFY_IS_APPROX(DenseType(dst(b)), ref);
+  }
+
+  // Shared rhs.
+  batchedProduct(lhs(0, 0), rhs(0, 0), dst(0), batch, lhsBatchStride, 0, dstBatchStride);
+  for (Index b = 0; b < batch; ++b) {
+    DenseType ref = lhs(b, lhsBatchStride) * rhs(0, 0);
+    VERIFY_IS_APPROX(DenseType(dst(b)), ref);
+  }
+}
+
+template <typename Scalar>
+void batched_product_mixed_storage() {
+  const Index rows = internal::random<Index>(1, 40), depth = internal::random<Index>(1, 40),
+              cols = internal::random<Index>(1, 40), batch = internal::random<Index>(1, 20);
+  typedef Matrix<Scalar, Dynamic, Dynamic, ColMajor> ColMat;
+  typedef Matrix<Scalar, Dynamic, Dynamic, RowMajor> RowMat;
+  std::vector<ColMat> a(batch);
+  std::vector<RowMat> b(batch);
+  Matrix<Scalar, Dynamic, 1> lhsData(rows * depth * batch), rhsData(depth * cols * batch), dstData(rows * cols * batch);
+  for (Index i = 0; i < batch; ++i) {
+    a[i] = ColMat::Random(rows, depth);
+    b[i] = RowMat::Random(depth, cols);
+    Map<ColMat>(lhsData.data() + i * rows * depth, rows, depth) = a[i];
+    Map<RowMat>(rhsData.data() + i * depth * cols, depth, cols) = b[i];
+  }
+  batchedProduct(Map<const ColMat>(lhsData.data(), rows, depth), Map<const RowMat>(rhsData.data(), depth, cols),
+                 Map<RowMat>(dstData.data(), rows, cols), batch, rows * depth, depth * cols, rows * cols);
+  for (Index i = 0; i < batch; ++i) {
+    RowMat ref = a[i] * b[i];
+    VERIFY_IS_APPROX(RowMat(Map<RowMat>(dstData.data() + i * rows * cols, rows, cols)), ref);
+  }
+
+  // Strided destination and empty batches.
+  Matrix<Scalar, Dynamic, 1> strided = Matrix<Scalar, Dynamic, 1>::Zero(2 * rows * cols * batch);
+  typedef Map<ColMat, Unaligned, Stride<Dynamic, 2>> StridedMap;
+  batchedProduct(Map<const ColMat>(lhsData.data(), rows, depth), Map<const RowMat>(rhsData.data(), depth, cols),
+                 StridedMap(strided.data(), rows, cols, Stride<Dynamic, 2>(2 * rows, 2)), batch, rows * depth,
+                 depth * cols, 2 * rows * cols);
+  for (Index i = 0; i < batch; ++i) {
+    ColMat ref = a[i] * b[i];
+    VERIFY_IS_APPROX(ColMat(StridedMap(strided.data() + 2 * i * rows * cols, rows, cols,
+                                       Stride<Dynamic, 2>(2 * rows, 2))),
+                     ref);
+  }
+  batchedProduct(Map<const ColMat>(lhsData.data(), rows, depth), Map<const RowMat>(rhsData.data(), depth, cols),
+                 Map<RowMat>(dstData.data(), rows, cols), 0, rows * depth, depth * cols, rows * cols);
+}
+
+EIGEN_DECLARE_TEST(product_batched) {
+  for (int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1(batched_product_check<MatrixXf>(8, 8, 8, internal::random<Index>(1, 50)));
+    CALL_SUBTEST_1(batched_product_check<MatrixXf>(3, 4, 5, internal::random<Index>(1, 50)));
+    CALL_SUBTEST_2(batched_product_check<MatrixXd>(internal::random<Index>(1, 70), internal::random<Index>(0, 70),
+                                                   internal::random<Index>(1, 70), internal::random<Index>(1, 30)));
+    CALL_SUBTEST_3((batched_product_check<Matrix<double, Dynamic, Dynamic, RowMajor>>(
+        internal::random<Index>(1, 70), internal::random<Index>(1, 70), internal::random<Index>(1, 70),
+        internal::random<Index>(1, 30))));
+    CALL_SUBTEST_4(batched_product_check<MatrixXcf>(internal::random<Index>(1, 40), internal::random<Index>(1, 40),
+                                                    internal::random<Index>(1, 40), internal::random<Index>(1, 10)));
+    CALL_SUBTEST_5(batched_product_mixed_storage<float>());
+    CALL_SUBTEST_6(batched_product_mixed_storage<double>());
+  }
+}
@@ -0,0 +1,91 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+
+// Epilogue depending on the position of the coefficients, to check the indices passed by the kernels.
+template <typename Scalar>
+struct position_epilogue {
+  Scalar operator()(const Scalar& x, Index row, Index col) const { return x * Scalar(2) + Scalar(row - 3 * col); }
+  template <typename Packet>
+  Packet packetOp(const Packet& x, Index row, Index col) const {
+    Packet offset = internal::plset<Packet>(Scalar(row - 3 * col));
+    return internal::padd(internal::pmul(x, internal::pset1<Packet>(Scalar(2))), offset);
+  }
+};
+
+template <typename MatrixType>
+void epilogue_product(Index rows, Index depth, Index cols) {
+  typedef typename MatrixType::Scalar Scalar;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic> ColMatrix;
+  typedef Matrix<Scalar, Dynamic, Dynamic, RowMajor> RowMatrix;
+  typedef Matrix<Scalar, Dynamic, 1> Vector;
+
+  MatrixType a = MatrixType::Random(rows, depth), b = MatrixType::Random(depth, cols);
+  Vector bias = Vector::Random(rows);
+  ColMatrix prod = a * b;
+
+  // Bias only.
+  ColMatrix c(rows, cols);
+  c.noalias() = (a * b).withEpilogue(BiasActivation<Scalar>(bias));
+  VERIFY_IS_APPROX(c, (prod.colwise() + bias).eval());
+
+  // Bias and activation, with a scalar factor.
+  typedef internal::bind2nd_op<internal::scalar_max_op<Scalar, Scalar>> Relu;
+  BiasActivation<Scalar, Relu> biasRelu(bias, Relu(Scalar(0)));
+  c.noalias() = ((Scalar(2) * a) * b).withEpilogue(biasRelu);
+  VERIFY_IS_APPROX(c, ((2 * prod).colwise() + bias).cwiseMax(Scalar(0)).eval());
+
+  // Positions, for a transposed product and a block of a larger destination.
+  ColMatrix ref(cols, rows);
+  for (Index j = 0; j < rows; ++j)
+    for (Index i = 0; i < cols; ++i) ref(i, j) = 2 * prod(j, i) + Scalar(i - 3 * j);
+  ColMatrix big = ColMatrix::Zero(cols + 2, rows + 1);
+  big.block(1, 1, cols, rows).noalias() = (b.transpose() * a.transpose()).withEpilogue(position_epilogue<Scalar>());
+  VERIFY_IS_APPROX(big.block(1, 1, cols, rows), ref);
+  VERIFY_IS_EQUAL(big.row(0).squaredNorm(), RealScalar(0));
+
+  // Row-major destination, assignment with aliasing, and nested in other expressions.
+  RowMatrix r(cols, rows);
+  r.noalias() = (b.transpose() * a.transpose()).withEpilogue(position_epilogue<Scalar>());
+  VERIFY_IS_APPROX(r, ref);
+  c = prod;
+  c.noalias() += (a * b).withEpilogue(BiasActivation<Scalar>(bias));
+  VERIFY_IS_APPROX(c, ((2 * prod).colwise() + bias).eval());
+  if (rows == cols && rows == depth) {
+    c = a;
+    c = (c * b).withEpilogue(BiasActivation<Scalar>(bias));
+    VERIFY_IS_APPROX(c, (prod.colwise() + bias).eval());
+  }
+
+  // Matrix-vector products.
+  Vector v(rows);
+  v.noalias() = (a * b.col(0)).withEpilogue(BiasActivation<Scalar>(bias));
+  VERIFY_IS_APPROX(v, (prod.col(0) + bias).eval());
+}
+
+EIGEN_DECLARE_TEST(product_epilogue) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index s = EIGEN_TEST_MAX_SIZE;
+    EIGEN_UNUSED_VARIABLE(s);
+    CALL_SUBTEST_1(epilogue_product<MatrixXf>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                              internal::random<Index>(1, s)));
+    CALL_SUBTEST_2(epilogue_product<MatrixXd>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                              internal::random<Index>(1, s)));
+    CALL_SUBTEST_3(
+        (epilogue_product<Matrix<float, Dynamic, Dynamic, RowMajor>>(internal::random<Index>(1, s),
+                                                                     internal::random<Index>(1, s),
+                                                                     internal::random<Index>(1, s))));
+    CALL_SUBTEST_4((epilogue_product<MatrixXd>(57, 57, 57)));
+  }
+  // Depths larger than the blocking size, and several strips of the result.
+  CALL_SUBTEST_1(epilogue_product<MatrixXf>(517, 1031, 389));
+  CALL_SUBTEST_2(epilogue_product<MatrixXd>(389, 779, 517));
+}
@@ -0,0 +1,82 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+
+// Products of bfloat16/half matrices cast to float, which are evaluated by widening the operands while packing.
+template <typename Half, int LhsOrder, int RhsOrder, int DstOrder>
+void float16_product(Index rows, Index depth, Index cols) {
+  typedef Matrix<Half, Dynamic, Dynamic, LhsOrder> LhsHalf;
+  typedef Matrix<Half, Dynamic, Dynamic, RhsOrder> RhsHalf;
+  typedef Matrix<float, Dynamic, Dynamic, DstOrder> Dst;
+  typedef Matrix<float, Dynamic, Dynamic> MatF;
+
+  STATIC_CHECK((internal::gemm_float16_product_enabled<CwiseUnaryOp<internal::core_cast_op<Half, float>, const LhsHalf>,
+                                                       CwiseUnaryOp<internal::core_cast_op<Half, float>, const RhsHalf>,
+                                                       Dst>::value) == bool(EIGEN_GEMM_FLOAT16_PACKING));
+
+  LhsHalf a = MatF::Random(rows, depth).template cast<Half>();
+  RhsHalf b = MatF::Random(depth, cols).template cast<Half>();
+  // The inputs are exactly representable, so the reference only differs by the order of the float additions.
+  MatF af = a.template cast<float>(), bf = b.template cast<float>();
+  MatF ref = af.lazyProduct(bf);
+
+  Dst c(rows, cols);
+  c.noalias() = a.template cast<float>() * b.template cast<float>();
+  VERIFY_IS_APPROX(c, ref);
+
+  c.noalias() += a.template cast<float>() * b.template cast<float>();
+  VERIFY_IS_APPROX(c, 2.f * ref);
+
+  c.noalias() -= 3.f * (a.template cast<float>() * b.template cast<float>());
+  VERIFY_IS_APPROX(c, -ref);
+
+  // One side in float.
+  c.noalias() = af * b.template cast<float>();
+  VERIFY_IS_APPROX(c, ref);
+  c.noalias() = a.template cast<float>() * bf;
+  VERIFY_IS_APPROX(c, ref);
+
+  // Blocks of larger matrices, for both the operands and the destination.
+  if (rows > 2 && cols > 2 && depth > 2) {
+    Dst big = Dst::Zero(rows + 3, cols + 2);
+    big.block(1, 2, rows - 2, cols - 1).noalias() = a.block(1, 1, rows - 2, depth - 2).template cast<float>() *
+                                                     b.block(1, 1, depth - 2, cols - 1).template cast<float>();
+    MatF subref = af.block(1, 1, rows - 2, depth - 2).lazyProduct(bf.block(1, 1, depth - 2, cols - 1));
+    VERIFY_IS_APPROX(big.block(1, 2, rows - 2, cols - 1), subref);
+    VERIFY_IS_EQUAL(big.row(0).squaredNorm(), 0.f);
+  }
+
+  // Transposed operands.
+  MatF reft = bf.transpose().lazyProduct(af.transpose());
+  Dst ct(cols, rows);
+  ct.noalias() = b.transpose().template cast<float>() * a.transpose().template cast<float>();
+  VERIFY_IS_APPROX(ct, reft);
+}
+
+template <typename Half>
+void float16_products(Index rows, Index depth, Index cols) {
+  float16_product<Half, ColMajor, ColMajor, ColMajor>(rows, depth, cols);
+  float16_product<Half, RowMajor, ColMajor, ColMajor>(rows, depth, cols);
+  float16_product<Half, ColMajor, RowMajor, RowMajor>(rows, depth, cols);
+  float16_product<Half, RowMajor, RowMajor, RowMajor>(rows, depth, cols);
+}
+
+EIGEN_DECLARE_TEST(product_float16) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index s = EIGEN_TEST_MAX_SIZE;
+    EIGEN_UNUSED_VARIABLE(s);
+    CALL_SUBTEST_1(float16_products<bfloat16>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                              internal::random<Index>(1, s)));
+    CALL_SUBTEST_2(float16_products<half>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                          internal::random<Index>(1, s)));
+  }
+  CALL_SUBTEST_1(float16_products<bfloat16>(517, 389, 261));
+  CALL_SUBTEST_2(float16_products<half>(261, 517, 389));
+}
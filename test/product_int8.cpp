@@ -0,0 +1,122 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+
+typedef Matrix<int8_t, Dynamic, Dynamic> MatrixX8;
+
+template <int Order>
+Matrix<int8_t, Dynamic, Dynamic, Order> random_int8(Index rows, Index cols) {
+  Matrix<int8_t, Dynamic, Dynamic, Order> m(rows, cols);
+  for (Index j = 0; j < cols; ++j)
+    for (Index i = 0; i < rows; ++i) m(i, j) = internal::random<int8_t>(-128, 127);
+  return m;
+}
+
+// int8 products accumulated in int32, which are exact.
+template <int LhsOrder, int RhsOrder, int DstOrder>
+void int8_product(Index rows, Index depth, Index cols) {
+  typedef Matrix<int32_t, Dynamic, Dynamic, DstOrder> Dst;
+
+  typedef Matrix<int8_t, Dynamic, Dynamic, LhsOrder> Lhs;
+  typedef Matrix<int8_t, Dynamic, Dynamic, RhsOrder> Rhs;
+  typedef CwiseUnaryOp<internal::core_cast_op<int8_t, int32_t>, const Lhs> LhsCast;
+  typedef CwiseUnaryOp<internal::core_cast_op<int8_t, int32_t>, const Rhs> RhsCast;
+  STATIC_CHECK((internal::gemm_int8_product_enabled<LhsCast, RhsCast, Dst>::value));
+
+  Lhs a = random_int8<LhsOrder>(rows, depth);
+  Rhs b = random_int8<RhsOrder>(depth, cols);
+  MatrixXi ai = a.template cast<int>(), bi = b.template cast<int>();
+  MatrixXi ref = ai.lazyProduct(bi);
+
+  Dst c(rows, cols);
+  c.noalias() = a.template cast<int>() * b.template cast<int>();
+  VERIFY_IS_EQUAL(c, ref);
+
+  c.noalias() += a.template cast<int>() * b.template cast<int>();
+  VERIFY_IS_EQUAL(c, 2 * ref);
+
+  c.noalias() -= 3 * (a.template cast<int>() * b.template cast<int>());
+  VERIFY_IS_EQUAL(c, -ref);
+
+  // Blocks of larger matrices, for both the operands and the destination.
+  if (rows > 2 && cols > 2 && depth > 2) {
+    Dst big = Dst::Zero(rows + 3, cols + 2);
+    big.block(1, 2, rows - 2, cols - 1).noalias() = a.block(1, 1, rows - 2, depth - 2).template cast<int>() *
+                                                     b.block(1, 1, depth - 2, cols - 1).template cast<int>();
+    VERIFY_IS_EQUAL(big.block(1, 2, rows - 2, cols - 1),
+                    ai.block(1, 1, rows - 2, depth - 2).lazyProduct(bi.block(1, 1, depth - 2, cols - 1)));
+    VERIFY_IS_EQUAL(big.row(0).squaredNorm(), 0);
+  }
+
+  // Extreme values, which exercise the offset applied to the lhs by the VNNI kernels.
+  MatrixX8 lo = MatrixX8::Constant(rows, depth, -128), hi = MatrixX8::Constant(depth, cols, -128);
+  MatrixXi extreme(rows, cols);
+  extreme.noalias() = lo.cast<int>() * hi.cast<int>();
+  VERIFY_IS_EQUAL(extreme, MatrixXi::Constant(rows, cols, 16384 * static_cast<int>(depth)));
+  hi.setConstant(127);
+  extreme.noalias() = lo.cast<int>() * hi.cast<int>();
+  VERIFY_IS_EQUAL(extreme, MatrixXi::Constant(rows, cols, -16256 * static_cast<int>(depth)));
+}
+
+template <int LhsOrder, int RhsOrder, int DstOrder>
+void quantized_product(Index rows, Index depth, Index cols) {
+  Matrix<int8_t, Dynamic, Dynamic, LhsOrder> a = random_int8<LhsOrder>(rows, depth);
+  Matrix<int8_t, Dynamic, Dynamic, RhsOrder> b = random_int8<RhsOrder>(depth, cols);
+  VectorXi za(rows), zb(cols);
+  for (Index i = 0; i < rows; ++i) za(i) = internal::random<int>(-20, 20);
+  for (Index j = 0; j < cols; ++j) zb(j) = internal::random<int>(-20, 20);
+  VectorXf sa = VectorXf::Random(rows).array() + 2.f, sb = VectorXf::Random(cols).array() + 2.f;
+
+  MatrixXi centered =
+      (a.template cast<int>().colwise() - za).lazyProduct(b.template cast<int>().rowwise() - zb.transpose());
+  MatrixXf ref = sa.asDiagonal() * centered.cast<float>() * sb.asDiagonal();
+
+  Matrix<float, Dynamic, Dynamic, DstOrder> c(rows, cols);
+  quantizedProduct(a, za, sa, b, zb, sb, c);
+  VERIFY_IS_APPROX(c, ref);
+
+  // Per-tensor parameters.
+  quantizedProduct(a, VectorXi::Constant(rows, 3), VectorXf::Constant(rows, 0.5f), b, VectorXi::Zero(cols),
+                   VectorXf::Constant(cols, 0.25f), c);
+  MatrixXi centered3 = (a.template cast<int>().array() - 3).matrix().lazyProduct(b.template cast<int>());
+  VERIFY_IS_APPROX(c, (0.125f * centered3.cast<float>()).eval());
+
+  // Block of a larger destination.
+  if (rows > 1 && cols > 1) {
+    typedef Matrix<float, Dynamic, Dynamic, DstOrder> Dst;
+    Dst big = Dst::Zero(rows + 2, cols + 1);
+    quantizedProduct(a.topRows(rows - 1), za.head(rows - 1), sa.head(rows - 1), b.rightCols(cols - 1),
+                     zb.tail(cols - 1), sb.tail(cols - 1), big.block(1, 1, rows - 1, cols - 1));
+    VERIFY_IS_APPROX(big.block(1, 1, rows - 1, cols - 1), ref.block(0, 1, rows - 1, cols - 1));
+    VERIFY_IS_EQUAL(big.row(0).squaredNorm(), 0.f);
+  }
+}
+
+template <int LhsOrder, int RhsOrder, int DstOrder>
+void int8_products(Index rows, Index depth, Index cols) {
+  int8_product<LhsOrder, RhsOrder, DstOrder>(rows, depth, cols);
+  quantized_product<LhsOrder, RhsOrder, DstOrder>(rows, depth, cols);
+}
+
+EIGEN_DECLARE_TEST(product_int8) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index s = EIGEN_TEST_MAX_SIZE;
+    EIGEN_UNUSED_VARIABLE(s);
+    const Index rows = internal::random<Index>(1, s), depth = internal::random<Index>(1, s),
+                cols = internal::random<Index>(1, s);
+    CALL_SUBTEST_1((int8_products<ColMajor, ColMajor, ColMajor>(rows, depth, cols)));
+    CALL_SUBTEST_2((int8_products<RowMajor, ColMajor, ColMajor>(rows, depth, cols)));
+    CALL_SUBTEST_3((int8_products<ColMajor, RowMajor, RowMajor>(rows, depth, cols)));
+    CALL_SUBTEST_4((int8_products<RowMajor, RowMajor, RowMajor>(rows, depth, cols)));
+  }
+  // Depths larger than the blocking sizes.
+  CALL_SUBTEST_1((int8_products<ColMajor, ColMajor, ColMajor>(131, 4099, 67)));
+  CALL_SUBTEST_4((int8_products<RowMajor, RowMajor, RowMajor>(67, 4099, 131)));
+}
@@ -0,0 +1,119 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+
+template <typename MatrixType>
+void packed_lhs_product(Index rows, Index depth, Index cols) {
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic> ColMat;
+  typedef Matrix<Scalar, Dynamic, Dynamic, RowMajor> RowMat;
+
+  MatrixType w = MatrixType::Random(rows, depth);
+  PackedMatrix<Scalar> packed(w);
+  VERIFY_IS_EQUAL(packed.rows(), rows);
+  VERIFY_IS_EQUAL(packed.cols(), depth);
+
+  ColMat x = ColMat::Random(depth, cols);
+  RowMat xr = x;
+  ColMat ref = w * x;
+
+  ColMat y = ColMat::Random(rows, cols);
+  packed.multiply(x, y);
+  VERIFY_IS_APPROX(y, ref);
+
+  // Row-major rhs and destination.
+  RowMat yr = RowMat::Random(rows, cols);
+  packed.multiply(xr, yr);
+  VERIFY_IS_APPROX(yr, ref);
+
+  // Accumulation into a block.
+  Scalar alpha = internal::random<Scalar>();
+  ColMat big = ColMat::Random(rows + 3, cols + 2);
+  ColMat bigRef = big;
+  bigRef.block(1, 2, rows, cols) += alpha * ref;
+  packed.multiplyAdd(x, big.block(1, 2, rows, cols), alpha);
+  VERIFY_IS_APPROX(big, bigRef);
+
+  // Expressions as rhs, and matrix-vector products.
+  packed.multiply(x.transpose().transpose() * Scalar(2), y);
+  VERIFY_IS_APPROX(y, Scalar(2) * ref);
+  Matrix<Scalar, Dynamic, 1> v = x.col(0), yv(rows);
+  packed.multiply(v, yv);
+  VERIFY_IS_APPROX(yv, ref.col(0));
+
+  // Repacking after a modification of the source.
+  w.setRandom();
+  packed.compute(w);
+  packed.multiply(x, y);
+  VERIFY_IS_APPROX(y, (w * x).eval());
+}
+
+template <typename MatrixType>
+void packed_rhs_product(Index rows, Index depth, Index cols) {
+  typedef typename MatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic> ColMat;
+  typedef Matrix<Scalar, Dynamic, Dynamic, RowMajor> RowMat;
+
+  MatrixType w = MatrixType::Random(depth, cols);
+  PackedMatrix<Scalar, OnTheRight> packed(w);
+  VERIFY_IS_EQUAL(packed.rows(), depth);
+  VERIFY_IS_EQUAL(packed.cols(), cols);
+
+  RowMat x = RowMat::Random(rows, depth);
+  ColMat ref = x * w;
+
+  ColMat y(rows, cols);
+  packed.multiply(x, y);
+  VERIFY_IS_APPROX(y, ref);
+
+  Scalar alpha = internal::random<Scalar>();
+  RowMat yr = RowMat::Random(rows, cols);
+  RowMat yrRef = yr + alpha * ref;
+  packed.multiplyAdd(ColMat(x), yr, alpha);
+  VERIFY_IS_APPROX(yr, yrRef);
+}
+
+void packed_product_empty() {
+  MatrixXf w(0, 5);
+  PackedMatrix<float> packed(w);
+  MatrixXf x = MatrixXf::Random(5, 3), y(0, 3);
+  packed.multiply(x, y);
+
+  MatrixXf w2(4, 0);
+  packed.compute(w2);
+  MatrixXf x2(0, 3), y2 = MatrixXf::Random(4, 3);
+  packed.multiply(x2, y2);
+  VERIFY_IS_EQUAL(y2, MatrixXf::Zero(4, 3));
+}
+
+EIGEN_DECLARE_TEST(product_packed) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index s = EIGEN_TEST_MAX_SIZE;
+    EIGEN_UNUSED_VARIABLE(s);
+    CALL_SUBTEST_1(packed_lhs_product<MatrixXf>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                                internal::random<Index>(1, s)));
+    CALL_SUBTEST_1(packed_lhs_product<MatrixXf>(internal::random<Index>(1, s), internal::random<Index>(1, s), 3));
+    CALL_SUBTEST_2((packed_lhs_product<Matrix<double, Dynamic, Dynamic, RowMajor>>(
+        internal::random<Index>(1, s), internal::random<Index>(1, s), internal::random<Index>(1, s))));
+    CALL_SUBTEST_3(packed_lhs_product<MatrixXcf>(internal::random<Index>(1, s / 2), internal::random<Index>(1, s / 2),
+                                                 internal::random<Index>(1, s / 2)));
+    CALL_SUBTEST_4(packed_rhs_product<MatrixXf>(internal::random<Index>(1, s), internal::random<Index>(1, s),
+                                                internal::random<Index>(1, s)));
+    CALL_SUBTEST_5((packed_rhs_product<Matrix<double, Dynamic, Dynamic, RowMajor>>(
+        internal::random<Index>(1, s), internal::random<Index>(1, s), internal::random<Index>(1, s))));
+    CALL_SUBTEST_6(packed_rhs_product<MatrixXcd>(internal::random<Index>(1, s / 2), internal::random<Index>(1, s / 2),
+                                                 internal::random<Index>(1, s / 2)));
+  }
+  CALL_SUBTEST_1(packed_product_empty());
+  // Sizes large enough to be blocked along every dimension.
+  CALL_SUBTEST_7(packed_lhs_product<MatrixXf>(700, 900, 300));
+  CALL_SUBTEST_7(packed_rhs_product<MatrixXf>(300, 900, 700));
+  CALL_SUBTEST_8(packed_lhs_product<MatrixXd>(513, 1031, 17));
+}
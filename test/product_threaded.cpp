@@ -72,7 +72,151 @@ void test_parallelize_gemm_varied() {
   }
 }
 
+void test_parallelize_batched_gemm() {
+  constexpr int num_threads = 4;
+  constexpr Index n = 32, batch = 200;
+  ThreadPool pool(num_threads);
+  MatrixXf a = MatrixXf::Random(n, n * batch);
+  MatrixXf b = MatrixXf::Random(n, n * batch);
+  MatrixXf c(n, n * batch);
+  Eigen::setGemmThreadPool(&pool);
+  batchedProduct(Map<const MatrixXf>(a.data(), n, n), Map<const MatrixXf>(b.data(), n, n),
+                 Map<MatrixXf>(c.data(), n, n), batch, n * n, n * n, n * n);
+  Eigen::setGemmThreadPool(nullptr);
+  for (Index i = 0; i < batch; ++i) {
+    MatrixXf ref = a.middleCols(i * n, n) * b.middleCols(i * n, n);
+    VERIFY_IS_APPROX(c.middleCols(i * n, n), ref);
+  }
+}
+
+void test_parallelize_packed_gemm() {
+  constexpr int num_threads = 4;
+  ThreadPool pool(num_threads);
+  MatrixXf w = MatrixXf::Random(256, 512);
+  MatrixXf x = MatrixXf::Random(512, 300);
+  MatrixXf ref = w * x;
+  Eigen::setGemmThreadPool(&pool);
+  PackedMatrix<float> lhs(w);
+  MatrixXf y(256, 300);
+  lhs.multiply(x, y);
+  VERIFY_IS_APPROX(y, ref);
+  PackedMatrix<float, OnTheRight> rhs(x);
+  rhs.multiply(w, y);
+  VERIFY_IS_APPROX(y, ref);
+  Eigen::setGemmThreadPool(nullptr);
+}
+
+template <typename MatrixType, typename DstType>
+void check_dynamic_gemm(Index rows, Index depth, Index cols) {
+  MatrixType a = MatrixType::Random(rows, depth);
+  MatrixType b = MatrixType::Random(depth, cols);
+  DstType c_static = DstType::Random(rows, cols), c_dynamic = c_static;
+  Eigen::setGemmDynamicScheduling(false);
+  c_static.noalias() -= a * b.adjoint().adjoint();
+  Eigen::setGemmDynamicScheduling(true);
+  c_dynamic.noalias() -= a * b.adjoint().adjoint();
+  VERIFY_IS_APPROX(c_static, c_dynamic);
+}
+
+void test_parallelize_gemm_dynamic() {
+  constexpr int num_threads = 4;
+  ThreadPool pool(num_threads);
+  VERIFY(!Eigen::gemmDynamicScheduling());
+  Eigen::setGemmDynamicScheduling(true);
+
+  MatrixXf a = MatrixXf::Random(1000, 700), b = MatrixXf::Random(700, 900);
+  MatrixXcd ac = MatrixXcd::Random(300, 257), bc = MatrixXcd::Random(257, 301);
+  MatrixXf c_serial = a * b;
+  Matrix<std::complex<double>, Dynamic, Dynamic, RowMajor> cc_serial = ac.conjugate() * bc;
+
+  Eigen::setGemmThreadPool(&pool);
+  MatrixXf c_threaded = a * b;
+  VERIFY_IS_APPROX(c_serial, c_threaded);
+  Matrix<std::complex<double>, Dynamic, Dynamic, RowMajor> cc_threaded = ac.conjugate() * bc;
+  VERIFY_IS_APPROX(cc_serial, cc_threaded);
+
+  // Shapes with few row blocks, few column blocks, and partial tiles, checked against the static schedule.
+  check_dynamic_gemm<MatrixXd, MatrixXd>(2000, 64, 100);
+  check_dynamic_gemm<MatrixXd, Matrix<double, Dynamic, Dynamic, RowMajor>>(37, 1500, 1200);
+  check_dynamic_gemm<Matrix<float, Dynamic, Dynamic, RowMajor>, MatrixXf>(513, 1031, 517);
+  Eigen::setGemmThreadPool(nullptr);
+  Eigen::setGemmDynamicScheduling(false);
+}
+
+template <typename MatrixType>
+void check_parallel_gemv(Index rows, Index cols) {
+  using Scalar = typename MatrixType::Scalar;
+  using Vec = Matrix<Scalar, Dynamic, 1>;
+  MatrixType a = MatrixType::Random(rows, cols);
+  Vec x = Vec::Random(cols), xt = Vec::Random(rows);
+  Vec y = Vec::Random(rows), yt = Vec::Random(cols);
+  Matrix<Scalar, Dynamic, Dynamic> out = Matrix<Scalar, Dynamic, Dynamic>::Random(3, rows);
+
+  Eigen::setNbThreads(1);
+  Vec y_serial = y, yt_serial = yt;
+  y_serial.noalias() += Scalar(2) * a * x;
+  yt_serial.noalias() -= a.adjoint() * xt;
+  Matrix<Scalar, Dynamic, Dynamic> out_serial = out;
+  out_serial.row(1).noalias() = (a * x).transpose();
+
+  Eigen::setNbThreads(4);
+  y.noalias() += Scalar(2) * a * x;
+  yt.noalias() -= a.adjoint() * xt;
+  // Strided destination.
+  out.row(1).noalias() = (a * x).transpose();
+  VERIFY_IS_APPROX(y_serial, y);
+  VERIFY_IS_APPROX(yt_serial, yt);
+  VERIFY_IS_APPROX(out_serial, out);
+}
+
+void test_parallelize_gemv() {
+  constexpr int num_threads = 4;
+  ThreadPool pool(num_threads);
+  Eigen::setGemmThreadPool(&pool);
+  // Both kernels, with a partial last block of rows, and shapes too small or too narrow to be split.
+  check_parallel_gemv<MatrixXf>(2049, 517);
+  check_parallel_gemv<Matrix<double, Dynamic, Dynamic, RowMajor>>(1000, 777);
+  check_parallel_gemv<MatrixXcf>(700, 300);
+  check_parallel_gemv<Matrix<std::complex<double>, Dynamic, Dynamic, RowMajor>>(333, 500);
+  check_parallel_gemv<MatrixXd>(100, 100);
+  check_parallel_gemv<MatrixXd>(64, 20000);
+  Eigen::setGemmThreadPool(nullptr);
+}
+
+template <int Side, int Mode, typename TriType, typename OtherType>
+void check_parallel_trsm(Index size, Index othersize) {
+  TriType tri = TriType::Random(size, size);
+  tri.diagonal().array() += typename TriType::Scalar(size);
+  OtherType other = Side == OnTheLeft ? OtherType::Random(size, othersize) : OtherType::Random(othersize, size);
+
+  Eigen::setNbThreads(1);
+  OtherType serial = other;
+  tri.template triangularView<Mode>().template solveInPlace<Side>(serial);
+
+  Eigen::setNbThreads(4);
+  tri.template triangularView<Mode>().template solveInPlace<Side>(other);
+  VERIFY_IS_APPROX(serial, other);
+}
+
+void test_parallelize_trsm() {
+  constexpr int num_threads = 4;
+  ThreadPool pool(num_threads);
+  Eigen::setGemmThreadPool(&pool);
+  // Both sides and storage orders of the right hand sides, with a partial last block, and a solve too small to split.
+  check_parallel_trsm<OnTheLeft, Lower, MatrixXd, MatrixXd>(300, 1001);
+  check_parallel_trsm<OnTheLeft, Upper | UnitDiag, MatrixXf, Matrix<float, Dynamic, Dynamic, RowMajor>>(257, 700);
+  check_parallel_trsm<OnTheRight, Upper, Matrix<double, Dynamic, Dynamic, RowMajor>, MatrixXd>(200, 999);
+  check_parallel_trsm<OnTheRight, Lower, MatrixXcf, Matrix<std::complex<float>, Dynamic, Dynamic, RowMajor>>(150, 400);
+  check_parallel_trsm<OnTheLeft, Lower, MatrixXd, MatrixXd>(20, 30);
+  Eigen::setGemmThreadPool(nullptr);
+}
+
 EIGEN_DECLARE_TEST(product_threaded) {
   CALL_SUBTEST_1(test_parallelize_gemm());
   CALL_SUBTEST_2(test_parallelize_gemm_varied());
+  CALL_SUBTEST_3(test_parallelize_batched_gemm());
+  CALL_SUBTEST_4(test_parallelize_packed_gemm());
+  CALL_SUBTEST_5(test_parallelize_gemm_dynamic());
+  CALL_SUBTEST_6(test_parallelize_gemv());
+  CALL_SUBTEST_7(test_parallelize_trsm());
 }
@@ -0,0 +1,65 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#include "threaded_device.h"
+#include <Eigen/QR>
+
+template <typename MatrixType>
+void test_threaded_householder_qr(const MatrixType& a, CoreThreadPoolDevice& device, bool fullRank = true) {
+  using RealScalar = typename MatrixType::RealScalar;
+  using RealMatrix = Matrix<RealScalar, Dynamic, Dynamic>;
+  const Index rows = a.rows(), cols = a.cols();
+
+  HouseholderQR<MatrixType> ref(a);
+  HouseholderQR<MatrixType> qr(a, device);
+  MatrixType r = qr.matrixQR().template triangularView<Upper>();
+  MatrixType q = qr.householderQ() * MatrixType::Identity(rows, cols);
+  VERIFY_IS_APPROX(q * r.topRows(cols), a);
+  VERIFY_IS_UNITARY(q);
+  // R is unique up to the phases of its rows.
+  const RealMatrix absR = r.topRows(cols).cwiseAbs();
+  const RealMatrix absRef = ref.matrixQR().topRows(cols).template triangularView<Upper>().toDenseMatrix().cwiseAbs();
+  VERIFY_IS_APPROX(absR, absRef);
+
+  const MatrixType b = MatrixType::Random(rows, 3);
+  MatrixType c = b;
+  c.applyOnTheLeft(qr.householderQ().adjoint());
+  VERIFY_IS_APPROX(qr.householderQ() * c, b);
+  VERIFY_IS_APPROX(c.topRows(cols), (q.adjoint() * b).eval());
+  if (fullRank) VERIFY_IS_APPROX(qr.solve(b), ref.solve(b));
+}
+
+void test_threaded_householder_qr_products(CoreThreadPoolDevice& device, ThreadPool& pool) {
+  // The products of the chunks, of the tree and of the sequential fallback do not start more threads.
+  MatrixXd a = MatrixXd::Random(20000, 20), small = MatrixXd::Random(1500, 300);
+  HouseholderQR<MatrixXd> qr, qrSmall;
+  verify_device_products_sequential(pool, [&]() {
+    qr.compute(a, device);
+    qrSmall.compute(small, device);
+  });
+  VERIFY_IS_APPROX(qr.householderQ() * qr.matrixQR().template triangularView<Upper>().toDenseMatrix(), a);
+  VERIFY_IS_APPROX(qrSmall.householderQ() * qrSmall.matrixQR().template triangularView<Upper>().toDenseMatrix(),
+                   small);
+}
+
+EIGEN_DECLARE_TEST(qr_threaded) {
+  ThreadPool pool(4);
+  CoreThreadPoolDevice device(pool);
+  // Three chunks reduce with an odd one carried over, four chunks with a full tree.
+  CALL_SUBTEST_1(test_threaded_householder_qr<MatrixXd>(MatrixXd::Random(3500, 40), device));
+  CALL_SUBTEST_1(test_threaded_householder_qr<MatrixXd>(MatrixXd::Random(20000, 50), device));
+  // Rank deficient.
+  CALL_SUBTEST_1(test_threaded_householder_qr<MatrixXd>(
+      MatrixXd(MatrixXd::Random(12000, 5) * MatrixXd::Random(5, 30)), device, false));
+  // Too small to be split.
+  CALL_SUBTEST_1(test_threaded_householder_qr<MatrixXd>(MatrixXd::Random(1500, 60), device));
+  CALL_SUBTEST_2((test_threaded_householder_qr<Matrix<float, Dynamic, Dynamic, RowMajor>>(
+      Matrix<float, Dynamic, Dynamic, RowMajor>::Random(9000, 16), device)));
+  CALL_SUBTEST_3(test_threaded_householder_qr<MatrixXcd>(MatrixXcd::Random(10000, 24), device));
+  CALL_SUBTEST_4(test_threaded_householder_qr_products(device, pool));
+}
@@ -0,0 +1,120 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+#include <Eigen/QR>
+
+// Checks that the factorization is a valid QR decomposition of a.
+template <typename MatrixType>
+void check_updatable_qr(const UpdatableQR<MatrixType>& qr, const MatrixType& a) {
+  VERIFY_IS_EQUAL(qr.rows(), a.rows());
+  VERIFY_IS_EQUAL(qr.cols(), a.cols());
+  VERIFY_IS_UNITARY(qr.matrixQ());
+  VERIFY_IS_EQUAL(MatrixType(qr.matrixR().template triangularView<StrictlyLower>()),
+                  MatrixType::Zero(a.rows(), a.cols()));
+  VERIFY_IS_APPROX(qr.reconstructedMatrix(), a);
+}
+
+template <typename MatrixType>
+void qr_update_rows(Index rows, Index cols) {
+  using RowVectorType = Matrix<typename MatrixType::Scalar, 1, Dynamic>;
+  MatrixType a = MatrixType::Random(rows, cols);
+  UpdatableQR<MatrixType> qr(a);
+  check_updatable_qr(qr, a);
+
+  // Insert at the top, in the middle and at the bottom.
+  for (Index i : {Index(0), internal::random<Index>(0, rows), rows + 1}) {
+    const RowVectorType row = RowVectorType::Random(cols);
+    MatrixType b(a.rows() + 1, cols);
+    b << a.topRows(i), row, a.bottomRows(a.rows() - i);
+    a = b;
+    qr.insertRow(i, row);
+    check_updatable_qr(qr, a);
+  }
+
+  for (Index i : {a.rows() - 1, internal::random<Index>(0, a.rows() - 2), Index(0)}) {
+    MatrixType b(a.rows() - 1, cols);
+    b << a.topRows(i), a.bottomRows(a.rows() - 1 - i);
+    a = b;
+    qr.removeRow(i);
+    check_updatable_qr(qr, a);
+  }
+}
+
+template <typename MatrixType>
+void qr_update_cols(Index rows, Index cols) {
+  using VectorType = Matrix<typename MatrixType::Scalar, Dynamic, 1>;
+  MatrixType a = MatrixType::Random(rows, cols);
+  UpdatableQR<MatrixType> qr(a);
+
+  for (Index j : {Index(0), internal::random<Index>(0, cols), cols + 1}) {
+    const VectorType col = VectorType::Random(rows);
+    MatrixType b(rows, a.cols() + 1);
+    b << a.leftCols(j), col, a.rightCols(a.cols() - j);
+    a = b;
+    qr.insertColumn(j, col);
+    check_updatable_qr(qr, a);
+  }
+
+  for (Index j : {a.cols() - 1, internal::random<Index>(0, a.cols() - 2), Index(0)}) {
+    MatrixType b(rows, a.cols() - 1);
+    b << a.leftCols(j), a.rightCols(a.cols() - 1 - j);
+    a = b;
+    qr.removeColumn(j);
+    check_updatable_qr(qr, a);
+  }
+}
+
+template <typename MatrixType>
+void qr_update_rank_one(Index rows, Index cols) {
+  using VectorType = Matrix<typename MatrixType::Scalar, Dynamic, 1>;
+  MatrixType a = MatrixType::Random(rows, cols);
+  UpdatableQR<MatrixType> qr(a);
+  for (int k = 0; k < 3; ++k) {
+    const VectorType u = VectorType::Random(rows), v = VectorType::Random(cols);
+    a += u * v.adjoint();
+    qr.rankUpdate(u, v);
+    check_updatable_qr(qr, a);
+  }
+}
+
+template <typename MatrixType>
+void qr_update_solve(Index rows, Index cols) {
+  using VectorType = Matrix<typename MatrixType::Scalar, Dynamic, 1>;
+  eigen_assert(rows >= cols);
+  MatrixType a = MatrixType::Random(rows, cols);
+  UpdatableQR<MatrixType> qr(a);
+  // Remove and reinsert the first row, then compare the least-squares solutions.
+  const VectorType row = a.row(0).transpose();
+  qr.removeRow(0).insertRow(rows - 1, row);
+  MatrixType b(rows, cols);
+  b << a.bottomRows(rows - 1), row.transpose();
+
+  const MatrixType rhs = MatrixType::Random(rows, 3);
+  const MatrixType x = qr.solve(rhs);
+  VERIFY_IS_APPROX(x, b.householderQr().solve(rhs));
+}
+
+EIGEN_DECLARE_TEST(qr_update) {
+  for (int i = 0; i < g_repeat; i++) {
+    const Index rows = internal::random<Index>(2, EIGEN_TEST_MAX_SIZE / 4);
+    const Index cols = internal::random<Index>(2, EIGEN_TEST_MAX_SIZE / 4);
+    CALL_SUBTEST_1(qr_update_rows<MatrixXd>(rows, cols));
+    CALL_SUBTEST_1(qr_update_cols<MatrixXd>(rows, cols));
+    CALL_SUBTEST_1(qr_update_rank_one<MatrixXd>(rows, cols));
+    CALL_SUBTEST_1(qr_update_solve<MatrixXd>(rows + cols, cols));
+    CALL_SUBTEST_2(qr_update_rows<MatrixXcf>(rows, cols));
+    CALL_SUBTEST_2(qr_update_cols<MatrixXcf>(rows, cols));
+    CALL_SUBTEST_2(qr_update_rank_one<MatrixXcf>(rows, cols));
+    CALL_SUBTEST_3((qr_update_rows<Matrix<double, Dynamic, Dynamic, RowMajor>>(rows, cols)));
+    CALL_SUBTEST_3((qr_update_cols<Matrix<double, Dynamic, Dynamic, RowMajor>>(rows, cols)));
+    CALL_SUBTEST_4(qr_update_solve<MatrixXcd>(rows + cols, cols));
+    CALL_SUBTEST_4(qr_update_rank_one<MatrixXcd>(rows, cols));
+  }
+}
@@ -0,0 +1,88 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "main.h"
+#include <Eigen/SVD>
+
+// A rows x cols matrix with singular values 2^-i, which decay fast enough for the randomized range finder to be
+// accurate.
+template <typename MatrixType>
+MatrixType decaying_matrix(Index rows, Index cols) {
+  using RealScalar = typename MatrixType::RealScalar;
+  const Index diagSize = (std::min)(rows, cols);
+  Matrix<RealScalar, Dynamic, 1> sigma(diagSize);
+  for (Index i = 0; i < diagSize; ++i) sigma(i) = std::pow(RealScalar(2), -RealScalar(i));
+  const MatrixType u = HouseholderQR<MatrixType>(MatrixType::Random(rows, diagSize)).householderQ() *
+                       MatrixType::Identity(rows, diagSize);
+  const MatrixType v = HouseholderQR<MatrixType>(MatrixType::Random(cols, diagSize)).householderQ() *
+                       MatrixType::Identity(cols, diagSize);
+  return u * sigma.asDiagonal() * v.adjoint();
+}
+
+template <typename MatrixType>
+void randomized_svd(Index rows, Index cols, Index k) {
+  using RealScalar = typename MatrixType::RealScalar;
+  const MatrixType a = decaying_matrix<MatrixType>(rows, cols);
+  BDCSVD<MatrixType> ref(a);
+
+  RandomizedSVD<MatrixType, ComputeThinU | ComputeThinV> svd(k);
+  svd.setSeed(internal::random<unsigned int>());
+  svd.compute(a);
+  VERIFY_IS_EQUAL(svd.info(), Success);
+  VERIFY_IS_EQUAL(svd.singularValues().size(), k);
+  VERIFY_IS_EQUAL(svd.matrixU().cols(), k);
+  VERIFY_IS_EQUAL(svd.matrixV().cols(), k);
+  VERIFY_IS_APPROX(svd.singularValues(), ref.singularValues().head(k));
+  VERIFY_IS_UNITARY(svd.matrixU());
+  VERIFY_IS_UNITARY(svd.matrixV());
+
+  // The best rank-k approximation is off by the (k+1)-th singular value.
+  const MatrixType approx = svd.matrixU() * svd.singularValues().asDiagonal() * svd.matrixV().adjoint();
+  const RealScalar error = BDCSVD<MatrixType>(a - approx).singularValues()(0);
+  VERIFY(error <= RealScalar(1.01) * ref.singularValues()(k) + RealScalar(100) * NumTraits<RealScalar>::epsilon());
+
+  // The same seed gives the same decomposition.
+  RandomizedSVD<MatrixType> values(k);
+  values.setSeed(42).setOversampling(5).setPowerIterations(3);
+  values.compute(a);
+  RandomizedSVD<MatrixType> values2(a, k);
+  VERIFY_IS_APPROX(values.singularValues(), values2.singularValues());
+  const typename RandomizedSVD<MatrixType>::SingularValuesType first = values.singularValues();
+  values.compute(a);
+  VERIFY(values.singularValues() == first);
+}
+
+template <typename MatrixType>
+void randomized_svd_low_rank(Index rows, Index cols, Index rank) {
+  // Exact on a matrix whose rank is at most the target rank, so solve() matches BDCSVD.
+  const MatrixType a = MatrixType::Random(rows, rank) * MatrixType::Random(rank, cols);
+  using RealScalar = typename MatrixType::RealScalar;
+  RandomizedSVD<MatrixType, ComputeThinU | ComputeThinV> svd(rank + 2);
+  svd.setThreshold(RealScalar(100 * (rows + cols)) * NumTraits<RealScalar>::epsilon());
+  svd.compute(a);
+  BDCSVD<MatrixType, ComputeThinU | ComputeThinV> ref(a);
+  VERIFY_IS_EQUAL(svd.rank(), rank);
+  VERIFY_IS_APPROX(svd.singularValues().head(rank), ref.singularValues().head(rank));
+  const MatrixType b = MatrixType::Random(rows, 2);
+  VERIFY_IS_APPROX(svd.solve(b), ref.solve(b));
+  VERIFY_IS_APPROX(svd.matrixU() * svd.singularValues().asDiagonal() * svd.matrixV().adjoint(), a);
+}
+
+EIGEN_DECLARE_TEST(randomized_svd) {
+  for (int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1(randomized_svd<MatrixXd>(300, 120, 10));
+    CALL_SUBTEST_1(randomized_svd<MatrixXd>(80, 200, 20));
+    CALL_SUBTEST_2(randomized_svd<MatrixXf>(150, 150, 8));
+    CALL_SUBTEST_3(randomized_svd<MatrixXcd>(120, 90, 12));
+    CALL_SUBTEST_4(randomized_svd_low_rank<MatrixXd>(200, 70, 6));
+    CALL_SUBTEST_4(randomized_svd_low_rank<MatrixXcf>(60, 90, 4));
+    // Target rank larger than the matrix.
+    CALL_SUBTEST_5(randomized_svd_low_rank<MatrixXd>(9, 7, 7));
+  }
+}
@@ -0,0 +1,178 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#define EIGEN_USE_THREADS 1
+#include "sparse.h"
+#include <Eigen/IterativeLinearSolvers>
+
+// A rows x cols matrix with rows of very different lengths: mostly short rows, a few long ones, up to maxLength,
+// and empty ones.
+template <typename SparseMatrixType>
+SparseMatrixType irregular_matrix(Index rows, Index cols, Index maxLength = -1) {
+  if (maxLength < 0) maxLength = cols;
+  typedef typename SparseMatrixType::Scalar Scalar;
+  std::vector<Triplet<Scalar> > triplets;
+  for (Index i = 0; i < rows; ++i) {
+    const int kind = internal::random<int>(0, 9);
+    const Index length = kind == 0 ? 0 : kind == 1 ? internal::random<Index>(0, maxLength) : internal::random<Index>(1, 5);
+    for (Index k = 0; k < length; ++k)
+      triplets.emplace_back(int(i), int(internal::random<Index>(0, cols - 1)), internal::random<Scalar>());
+  }
+  SparseMatrixType mat(rows, cols);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  return mat;
+}
+
+template <typename SellType, typename SparseMatrixType>
+void sell_products(const SparseMatrixType& mat, Index sigma) {
+  typedef typename SellType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, 1> VectorType;
+  typedef Matrix<Scalar, Dynamic, Dynamic> DenseMatrix;
+  typedef Matrix<Scalar, Dynamic, Dynamic, RowMajor> RowMajorDenseMatrix;
+  const Index rows = mat.rows();
+  const Index cols = mat.cols();
+  const SellType sell(mat, sigma);
+  VERIFY_IS_EQUAL(sell.rows(), rows);
+  VERIFY_IS_EQUAL(sell.cols(), cols);
+  VERIFY_IS_EQUAL(sell.nonZeros(), mat.nonZeros());
+  VERIFY(sell.paddedNonZeros() >= mat.nonZeros());
+  VERIFY_IS_EQUAL(sell.sigma() % SellType::SliceHeight, 0);
+
+  // The rows are iterated in their original order, without the padding.
+  SparseMatrix<Scalar, RowMajor> rebuilt(rows, cols);
+  std::vector<Triplet<Scalar> > triplets;
+  for (Index i = 0; i < sell.outerSize(); ++i) {
+    Index previous = -1;
+    for (typename SellType::InnerIterator it(sell, i); it; ++it) {
+      VERIFY_IS_EQUAL(it.row(), i);
+      VERIFY(it.col() > previous);
+      previous = it.col();
+      triplets.emplace_back(int(it.row()), int(it.col()), it.value());
+    }
+  }
+  rebuilt.setFromTriplets(triplets.begin(), triplets.end());
+  VERIFY_IS_EQUAL(rebuilt.nonZeros(), mat.nonZeros());
+  if (rows > 0 && cols > 0)
+    VERIFY_IS_EQUAL((rebuilt - SparseMatrix<Scalar, RowMajor>(mat)).norm(), typename NumTraits<Scalar>::Real(0));
+
+  const VectorType x = VectorType::Random(cols);
+  const VectorType ref = mat * x;
+  VectorType y = VectorType::Random(rows);
+  y = sell * x;
+  VERIFY_IS_APPROX(y, ref);
+  y.noalias() += sell * x;
+  VERIFY_IS_APPROX(y, Scalar(2) * ref);
+  y.noalias() -= sell * x;
+  VERIFY_IS_APPROX(y, ref);
+  const Scalar alpha = internal::random<Scalar>();
+  y.setZero();
+  y.noalias() += alpha * (sell * x);
+  VERIFY_IS_APPROX(y, alpha * ref);
+  y = alpha * (sell * x);
+  VERIFY_IS_APPROX(y, alpha * ref);
+  // In an expression, and with a right hand side which is not a plain vector.
+  VERIFY_IS_APPROX(VectorType(sell * (Scalar(2) * x) - ref), ref);
+  VERIFY_IS_APPROX(VectorType(alpha * (sell * x) + ref), VectorType(alpha * ref + ref));
+  // Aliasing of the destination and of the right hand side.
+  if (rows == cols) {
+    VectorType z = x;
+    z = sell * z;
+    VERIFY_IS_APPROX(z, ref);
+  }
+
+  // Dense matrices, including a destination whose columns are strided.
+  const DenseMatrix X = DenseMatrix::Random(cols, 3);
+  DenseMatrix Y = sell * X;
+  VERIFY_IS_APPROX(Y, (mat * X).eval());
+  RowMajorDenseMatrix Z = RowMajorDenseMatrix::Zero(rows, 3);
+  Z.noalias() += sell * X;
+  VERIFY_IS_APPROX(DenseMatrix(Z), (mat * X).eval());
+
+  // On a ThreadPool.
+  ThreadPool pool(3);
+  y = VectorType::Random(rows);
+  threadedSellProduct(sell, x, y, &pool);
+  VERIFY_IS_APPROX(y, ref);
+  threadedSellProduct(sell, x, y);
+  VERIFY_IS_APPROX(y, ref);
+}
+
+template <typename Scalar, int SliceHeight, typename StorageIndex>
+void sell_matrix() {
+  typedef SellMatrix<Scalar, SliceHeight, StorageIndex> SellType;
+  const Index rows = internal::random<Index>(1, 300);
+  const Index cols = internal::random<Index>(1, 300);
+  typedef SparseMatrix<Scalar, RowMajor, StorageIndex> RowMajorMatrix;
+  const RowMajorMatrix rowMajor = irregular_matrix<RowMajorMatrix>(rows, cols);
+  const SparseMatrix<Scalar, ColMajor, StorageIndex> colMajor = rowMajor;
+  // Without reordering, with the default window, and with a single window.
+  sell_products<SellType>(rowMajor, SliceHeight);
+  sell_products<SellType>(colMajor, 32 * SliceHeight);
+  sell_products<SellType>(rowMajor, rows);
+  // Square, for x = A * x.
+  sell_products<SellType>(irregular_matrix<RowMajorMatrix>(rows, rows), SliceHeight);
+  // Large enough to be threaded.
+  sell_products<SellType>(irregular_matrix<RowMajorMatrix>(5000, 200), 64);
+  // Columns spread beyond the L2 cache, whose products use the gathers.
+  sell_products<SellType>(irregular_matrix<RowMajorMatrix>(2000, 2 * l2CacheSize(), 50), 64);
+  // Empty matrices.
+  sell_products<SellType>(RowMajorMatrix(0, 5), SliceHeight);
+  sell_products<SellType>(RowMajorMatrix(7, 3), SliceHeight);
+}
+
+template <typename Scalar>
+void sell_solvers() {
+  typedef Matrix<Scalar, Dynamic, 1> VectorType;
+  typedef typename NumTraits<Scalar>::Real RealScalar;
+  const Index n = internal::random<Index>(50, 400);
+  SparseMatrix<Scalar> B = irregular_matrix<SparseMatrix<Scalar> >(n, n);
+  SparseMatrix<Scalar> identity(n, n);
+  identity.setIdentity();
+  // Symmetric positive definite, and nonsymmetric but diagonally dominant.
+  const SparseMatrix<Scalar> spd =
+      SparseMatrix<Scalar>(B * SparseMatrix<Scalar>(B.adjoint())) + RealScalar(n) * identity;
+  const SparseMatrix<Scalar> nonsymmetric = B + RealScalar(2 * n) * identity;
+  const VectorType b = VectorType::Random(n);
+
+  const RealScalar tol = numext::sqrt(NumTraits<RealScalar>::epsilon());
+
+  // With the default diagonal preconditioner, which reads the diagonal through the InnerIterator.
+  const SellMatrix<Scalar> spdSell(spd);
+  ConjugateGradient<SellMatrix<Scalar>, Lower | Upper> cg(spdSell);
+  cg.setTolerance(tol);
+  VectorType x = cg.solve(b);
+  VERIFY_IS_EQUAL(cg.info(), Success);
+  VERIFY((spd * x - b).norm() <= RealScalar(10) * tol * b.norm());
+
+  ConjugateGradient<SellMatrix<Scalar>, Lower | Upper, IdentityPreconditioner> cgIdentity(spdSell);
+  cgIdentity.setTolerance(tol);
+  x = cgIdentity.solve(b);
+  VERIFY_IS_EQUAL(cgIdentity.info(), Success);
+  VERIFY((spd * x - b).norm() <= RealScalar(10) * tol * b.norm());
+
+  const SellMatrix<Scalar> nonsymmetricSell(nonsymmetric);
+  BiCGSTAB<SellMatrix<Scalar> > bicgstab(nonsymmetricSell);
+  bicgstab.setTolerance(tol);
+  x = bicgstab.solve(b);
+  VERIFY_IS_EQUAL(bicgstab.info(), Success);
+  VERIFY((nonsymmetric * x - b).norm() <= RealScalar(10) * tol * b.norm());
+}
+
+EIGEN_DECLARE_TEST(sell_matrix) {
+  for (int i = 0; i < g_repeat; ++i) {
+    CALL_SUBTEST_1((sell_matrix<double, 8, int>()));
+    CALL_SUBTEST_2((sell_matrix<float, 16, int>()));
+    CALL_SUBTEST_2((sell_matrix<float, 4, int>()));
+    CALL_SUBTEST_3((sell_matrix<double, 1, long>()));
+    CALL_SUBTEST_3((sell_matrix<double, 3, int>()));
+    CALL_SUBTEST_4((sell_matrix<std::complex<double>, 4, int>()));
+    CALL_SUBTEST_5(sell_solvers<double>());
+    CALL_SUBTEST_6(sell_solvers<std::complex<float> >());
+  }
+}
@@ -0,0 +1,86 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#include "sparse.h"
+
+template <typename SparseMatrixType>
+void sparse_product_plan(Index rows, Index depth, Index cols, double density) {
+  typedef typename SparseMatrixType::Scalar Scalar;
+  typedef Matrix<Scalar, Dynamic, Dynamic> DenseMatrix;
+  DenseMatrix refLhs(rows, depth), refRhs(depth, cols);
+  SparseMatrixType lhs(rows, depth), rhs(depth, cols);
+  initSparse<Scalar>(density, refLhs, lhs);
+  initSparse<Scalar>(density, refRhs, rhs);
+  lhs.makeCompressed();
+  rhs.makeCompressed();
+
+  SparseProductPlan<SparseMatrixType> plan(lhs, rhs);
+  VERIFY_IS_EQUAL(plan.rows(), rows);
+  VERIFY_IS_EQUAL(plan.cols(), cols);
+
+  SparseMatrixType res(3, 5);
+  plan.compute(lhs, rhs, res);
+  const SparseMatrixType serial = lhs * rhs;
+  VERIFY(res.isCompressed());
+  VERIFY_IS_EQUAL(res.rows(), rows);
+  VERIFY_IS_EQUAL(res.cols(), cols);
+  // Same pattern as the conservative product, with sorted inner indices.
+  VERIFY_IS_EQUAL(res.nonZeros(), serial.nonZeros());
+  VERIFY_IS_EQUAL(plan.nonZeros(), serial.nonZeros());
+  for (Index j = 0; j < res.outerSize(); ++j) {
+    VERIFY_IS_EQUAL(res.outerIndexPtr()[j + 1], serial.outerIndexPtr()[j + 1]);
+    for (Index k = res.outerIndexPtr()[j] + 1; k < res.outerIndexPtr()[j + 1]; ++k)
+      VERIFY(res.innerIndexPtr()[k - 1] < res.innerIndexPtr()[k]);
+  }
+  if (rows * cols == 0) return;
+  VERIFY_IS_APPROX(DenseMatrix(res), refLhs * refRhs);
+
+  // New values in the same patterns: the result is updated in place.
+  for (Index k = 0; k < lhs.nonZeros(); ++k) lhs.valuePtr()[k] = internal::random<Scalar>();
+  for (Index k = 0; k < rhs.nonZeros(); ++k) rhs.valuePtr()[k] = internal::random<Scalar>();
+  const Scalar* values = res.valuePtr();
+  plan.compute(lhs, rhs, res);
+  VERIFY(res.valuePtr() == values);
+  VERIFY_IS_APPROX(DenseMatrix(res), DenseMatrix(lhs) * DenseMatrix(rhs));
+
+  // Zero values keep their entries in the pattern.
+  std::fill_n(lhs.valuePtr(), lhs.nonZeros(), Scalar(0));
+  plan.compute(lhs, rhs, res);
+  VERIFY_IS_EQUAL(res.nonZeros(), serial.nonZeros());
+  VERIFY_IS_EQUAL(DenseMatrix(res), DenseMatrix::Zero(rows, cols));
+
+  // A plan for another product.
+  const SparseMatrixType lhsT = lhs.transpose();
+  plan.analyzePattern(lhsT, lhs);
+  plan.compute(lhsT, lhs, res);
+  VERIFY_IS_EQUAL(res.rows(), depth);
+  VERIFY_IS_EQUAL(res.cols(), depth);
+  VERIFY_IS_EQUAL(res.nonZeros(), SparseMatrixType(lhsT * lhs).nonZeros());
+}
+
+template <typename Scalar>
+void sparse_product_plan_all() {
+  const Index rows = internal::random<Index>(1, 200), depth = internal::random<Index>(1, 200),
+              cols = internal::random<Index>(1, 200);
+  for (double density : {0.01, 0.1, 0.5}) {
+    sparse_product_plan<SparseMatrix<Scalar, ColMajor> >(rows, depth, cols, density);
+    sparse_product_plan<SparseMatrix<Scalar, RowMajor> >(rows, depth, cols, density);
+  }
+  sparse_product_plan<SparseMatrix<Scalar, ColMajor, long> >(rows, depth, cols, 0.1);
+  sparse_product_plan<SparseMatrix<Scalar, ColMajor> >(0, depth, cols, 0.1);
+  sparse_product_plan<SparseMatrix<Scalar, RowMajor> >(rows, 0, cols, 0.1);
+}
+
+EIGEN_DECLARE_TEST(sparse_product_plan) {
+  for (int i = 0; i < g_repeat; i++) {
+    CALL_SUBTEST_1(sparse_product_plan_all<double>());
+    CALL_SUBTEST_2(sparse_product_plan_all<float>());
+    CALL_SUBTEST_3(sparse_product_plan_all<std::complex<double> >());
+  }
+}
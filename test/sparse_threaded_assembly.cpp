@@ -0,0 +1,148 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-FileCopyrightText: The Eigen Authors
+// SPDX-License-Identifier: MPL-2.0
+
+#define EIGEN_USE_THREADS 1
+#include "sparse.h"
+
+template <typename SparseMatrixType>
+bool same_storage(const SparseMatrixType& a, const SparseMatrixType& b) {
+  if (a.rows() != b.rows() || a.cols() != b.cols() || !a.isCompressed() || !b.isCompressed() ||
+      a.nonZeros() != b.nonZeros())
+    return false;
+  return std::equal(a.outerIndexPtr(), a.outerIndexPtr() + a.outerSize() + 1, b.outerIndexPtr()) &&
+         std::equal(a.innerIndexPtr(), a.innerIndexPtr() + a.nonZeros(), b.innerIndexPtr()) &&
+         std::equal(a.valuePtr(), a.valuePtr() + a.nonZeros(), b.valuePtr());
+}
+
+template <typename SparseMatrixType>
+void threaded_set_from_triplets(Index rows, Index cols, Index size, ThreadPool* pool) {
+  typedef typename SparseMatrixType::Scalar Scalar;
+  typedef typename SparseMatrixType::StorageIndex StorageIndex;
+  typedef Triplet<Scalar, StorageIndex> TripletType;
+  // Few distinct positions, so that there are many duplicates.
+  const Index distinct = numext::maxi<Index>(1, size / 4);
+  std::vector<TripletType> triplets;
+  triplets.reserve(size);
+  for (Index k = 0; k < size; ++k) {
+    const Index p = internal::random<Index>(0, distinct - 1);
+    triplets.emplace_back(StorageIndex((p * 7919) % rows), StorageIndex((p * 104729) % cols),
+                          internal::random<Scalar>());
+  }
+
+  // The duplicates are combined in the order of the triplets, as by setFromTriplets, so the results are the same.
+  SparseMatrixType ref(rows, cols), res(rows, cols);
+  ref.setFromTriplets(triplets.begin(), triplets.end());
+  res.insert(0, 0) = Scalar(1);
+  threadedSetFromTriplets(triplets.begin(), triplets.end(), res, pool);
+  VERIFY(same_storage(res, ref));
+
+  auto keepLast = [](const Scalar&, const Scalar& b) { return b; };
+  ref.setFromTriplets(triplets.begin(), triplets.end(), keepLast);
+  threadedSetFromTriplets(triplets.begin(), triplets.end(), res, pool, keepLast);
+  VERIFY(same_storage(res, ref));
+
+  // Repeated assembly into a pattern, here with an additional diagonal which gets zeros.
+  SparseMatrixType pattern = ref;
+  for (Index k = 0; k < numext::mini(rows, cols); ++k) pattern.coeffRef(k, k) += Scalar(1);
+  pattern.makeCompressed();
+  const SparseMatrixType patternBefore = pattern;
+  for (TripletType& t : triplets) t = TripletType(t.row(), t.col(), internal::random<Scalar>());
+  ref.setFromTriplets(triplets.begin(), triplets.end());
+  const Scalar* values = pattern.valuePtr();
+  threadedSetValuesFromTriplets(triplets.begin(), triplets.end(), pattern, pool);
+  VERIFY(pattern.valuePtr() == values);
+  VERIFY_IS_EQUAL(pattern.nonZeros(), patternBefore.nonZeros());
+  VERIFY(std::equal(pattern.innerIndexPtr(), pattern.innerIndexPtr() + pattern.nonZeros(),
+                    patternBefore.innerIndexPtr()));
+  SparseMatrixType diff = pattern - ref;
+  VERIFY_IS_EQUAL(diff.norm(), typename NumTraits<Scalar>::Real(0));
+
+  // No triplets.
+  threadedSetValuesFromTriplets(triplets.begin(), triplets.begin(), pattern, pool);
+  VERIFY_IS_EQUAL(pattern.nonZeros(), patternBefore.nonZeros());
+  VERIFY_IS_EQUAL(pattern.norm(), typename NumTraits<Scalar>::Real(0));
+  threadedSetFromTriplets(triplets.begin(), triplets.begin(), res, pool);
+  VERIFY_IS_EQUAL(res.nonZeros(), 0);
+}
+
+template <typename SparseMatrixType>
+void assembly_map(Index rows, Index cols, Index size, ThreadPool* pool) {
+  typedef typename SparseMatrixType::Scalar Scalar;
+  typedef typename SparseMatrixType::StorageIndex StorageIndex;
+  typedef Triplet<Scalar, StorageIndex> TripletType;
+  const Index distinct = numext::maxi<Index>(1, size / 3);
+  std::vector<TripletType> triplets;
+  for (Index k = 0; k < size; ++k) {
+    const Index p = internal::random<Index>(0, distinct - 1);
+    triplets.emplace_back(StorageIndex((p * 7919) % rows), StorageIndex((p * 104729) % cols), Scalar(0));
+  }
+  // A pattern with an additional diagonal, without triplets.
+  SparseMatrixType mat(rows, cols);
+  mat.setFromTriplets(triplets.begin(), triplets.end());
+  for (Index k = 0; k < numext::mini(rows, cols); ++k) mat.coeffRef(k, k) += Scalar(1);
+  mat.makeCompressed();
+  const SparseMatrixType pattern = mat;
+
+  SparseAssemblyMap<SparseMatrixType> map(mat, triplets.begin(), triplets.end());
+  VERIFY_IS_EQUAL(map.size(), size);
+  VERIFY_IS_EQUAL(map.nonZeros(), mat.nonZeros());
+
+  SparseMatrixType ref(rows, cols);
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    std::vector<Scalar> values(size);
+    for (Index k = 0; k < size; ++k) {
+      values[k] = internal::random<Scalar>();
+      triplets[k] = TripletType(triplets[k].row(), triplets[k].col(), values[k]);
+    }
+    ref.setFromTriplets(triplets.begin(), triplets.end());
+    const Scalar* valuePtr = mat.valuePtr();
+    map.assemble(values.begin(), mat);
+    VERIFY(mat.valuePtr() == valuePtr);
+    VERIFY(std::equal(mat.innerIndexPtr(), mat.innerIndexPtr() + mat.nonZeros(), pattern.innerIndexPtr()));
+    // The duplicates are summed in the same order as by setFromTriplets.
+    SparseMatrixType diff = mat - ref;
+    VERIFY_IS_EQUAL(diff.norm(), typename NumTraits<Scalar>::Real(0));
+
+    mat.coeffs().setConstant(Scalar(3));
+    threadedAssemble(map, values.data(), mat, pool);
+    diff = mat - ref;
+    VERIFY_IS_EQUAL(diff.norm(), typename NumTraits<Scalar>::Real(0));
+  }
+
+  // No triplets.
+  map.analyzePattern(mat, triplets.begin(), triplets.begin());
+  map.assemble(static_cast<const Scalar*>(nullptr), mat);
+  VERIFY_IS_EQUAL(mat.norm(), typename NumTraits<Scalar>::Real(0));
+}
+
+template <typename Scalar>
+void threaded_set_from_triplets_all() {
+  ThreadPool pool(4);
+  // Small inputs take the serial path, the others the threaded one.
+  threaded_set_from_triplets<SparseMatrix<Scalar, ColMajor> >(50, 40, 300, &pool);
+  threaded_set_from_triplets<SparseMatrix<Scalar, ColMajor> >(1000, 800, 100000, &pool);
+  threaded_set_from_triplets<SparseMatrix<Scalar, RowMajor> >(800, 1000, 100000, &pool);
+  threaded_set_from_triplets<SparseMatrix<Scalar, ColMajor, long> >(3000, 20, 50000, &pool);
+  // Dense outer vectors, which are ordered by a scan rather than by sorting.
+  threaded_set_from_triplets<SparseMatrix<Scalar, RowMajor> >(60, 70, 40000, &pool);
+  // Default pool.
+  threaded_set_from_triplets<SparseMatrix<Scalar, ColMajor> >(1000, 1000, 50000, nullptr);
+
+  assembly_map<SparseMatrix<Scalar, ColMajor> >(40, 50, 200, &pool);
+  assembly_map<SparseMatrix<Scalar, ColMajor> >(1000, 800, 100000, &pool);
+  assembly_map<SparseMatrix<Scalar, RowMajor> >(800, 1000, 100000, &pool);
+  assembly_map<SparseMatrix<Scalar, RowMajor, long> >(20, 3000, 50000, nullptr);
+}
+
+EIGEN_DECLARE_TEST(sparse_threaded_assembly) {
+  for (int i = 0; i < g_repeat; ++i) {
+    CALL_SUBTEST_1(threaded_set_from_triplets_all<double>());
+    CALL_SUBTEST_2(threaded_set_from_triplets_all<std::complex<float> >());
+  }
+}
@@ -204,8 +204,8 @@ void run_grid() {
       verify_threaded_spmv<SparseMatrix<Scalar, ColMajor>, Vec>(13, 21, 0.3);
       verify_threaded_spmv<SparseMatrix<Scalar, ColMajor>, Vec>(500, 500, 0.15);
       verify_threaded_spmv<SparseMatrix<Scalar, ColMajor>, Vec>(800, 400, 0.10);
-      // Large enough that nnz > kThreadingThreshold (20000) to exercise the
-      // multi-threaded dispatch path.
+      // Large enough that nnz > internal::kSparseThreadingThreshold (20000) to
+      // exercise the multi-threaded dispatch path.
       verify_threaded_spmv<SparseMatrix<Scalar, ColMajor>, Vec>(1500, 1500, 0.02);
     } else {
       verify_threaded_spmv<SparseMatrix<Scalar, RowMajor>, Vec>(8, 8, 0.5);
@@ -217,6 +217,55 @@ void run_grid() {
   }
 }
 
+template <typename Scalar, int ResOrder, int LhsOrder, int RhsOrder>
+void verify_threaded_spgemm(Index rows, Index depth, Index cols, double density, ThreadPool* pool) {
+  typedef Matrix<Scalar, Dynamic, Dynamic> DenseMatrix;
+  typedef SparseMatrix<Scalar, ResOrder> ResType;
+  DenseMatrix refLhs(rows, depth), refRhs(depth, cols);
+  SparseMatrix<Scalar, LhsOrder> lhs(rows, depth);
+  SparseMatrix<Scalar, RhsOrder> rhs(depth, cols);
+  initSparse<Scalar>(density, refLhs, lhs);
+  initSparse<Scalar>(density, refRhs, rhs);
+
+  ResType res(3, 5);
+  threadedSparseSparseProduct(lhs, rhs, res, pool);
+  const ResType serial = lhs * rhs;
+  VERIFY(res.isCompressed());
+  VERIFY_IS_EQUAL(res.rows(), rows);
+  VERIFY_IS_EQUAL(res.cols(), cols);
+  // Same pattern as the serial product, with sorted inner indices.
+  VERIFY_IS_EQUAL(res.nonZeros(), serial.nonZeros());
+  for (Index j = 0; j < res.outerSize(); ++j) {
+    VERIFY_IS_EQUAL(res.outerIndexPtr()[j + 1], serial.outerIndexPtr()[j + 1]);
+    for (Index k = res.outerIndexPtr()[j] + 1; k < res.outerIndexPtr()[j + 1]; ++k)
+      VERIFY(res.innerIndexPtr()[k - 1] < res.innerIndexPtr()[k]);
+  }
+  if (rows * cols == 0) return;
+  VERIFY_IS_APPROX(res, serial);
+  VERIFY_IS_APPROX(DenseMatrix(res), refLhs * refRhs);
+
+  // Products with a transposed operand go through a copy.
+  ResType resT;
+  threadedSparseSparseProduct(lhs, lhs.transpose(), resT, pool);
+  VERIFY_IS_APPROX(resT, ResType(lhs * lhs.transpose()));
+}
+
+template <typename Scalar>
+void run_spgemm_grid() {
+  ThreadPool pool(4);
+  // Small products take the serial path, the others the threaded one.
+  verify_threaded_spgemm<Scalar, ColMajor, ColMajor, ColMajor>(20, 30, 10, 0.3, &pool);
+  verify_threaded_spgemm<Scalar, ColMajor, ColMajor, ColMajor>(0, 30, 10, 0.3, &pool);
+  verify_threaded_spgemm<Scalar, ColMajor, ColMajor, ColMajor>(1200, 1000, 900, 0.02, &pool);
+  verify_threaded_spgemm<Scalar, ColMajor, RowMajor, ColMajor>(1000, 1200, 1100, 0.02, &pool);
+  verify_threaded_spgemm<Scalar, RowMajor, RowMajor, RowMajor>(1100, 1000, 1200, 0.02, &pool);
+  verify_threaded_spgemm<Scalar, RowMajor, ColMajor, RowMajor>(1000, 1000, 1000, 0.02, &pool);
+  // Dense result columns, which are ordered by a scan rather than by sorting.
+  verify_threaded_spgemm<Scalar, ColMajor, ColMajor, ColMajor>(300, 300, 300, 0.25, &pool);
+  // Default pool.
+  verify_threaded_spgemm<Scalar, ColMajor, ColMajor, ColMajor>(1000, 1000, 1000, 0.02, nullptr);
+}
+
 EIGEN_DECLARE_TEST(sparse_threaded_product) {
   for (int i = 0; i < g_repeat; ++i) {
     CALL_SUBTEST_1(run_grid<float>());
@@ -224,5 +273,7 @@ EIGEN_DECLARE_TEST(sparse_threaded_product) {
     CALL_SUBTEST_3(run_grid<std::complex<double> >());
     CALL_SUBTEST_4(verify_threaded_scatter_ieee754<double>());
     CALL_SUBTEST_4(verify_threaded_scatter_ieee754<float>());
+    CALL_SUBTEST_5(run_spgemm_grid<double>());
+    CALL_SUBTEST_6(run_spgemm_grid<std::complex<float> >());
   }
 }
@@ -0,0 +1,60 @@
+// This file is part of Eigen, a lightweight C++ template library
+// for linear algebra.
+//
+// This Source Code Form is subject to the terms of the Mozilla
+// Public License v. 2.0. If a copy of the MPL was not distributed
+// with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+// SPDX-License-Identifier: MPL-2.0
+
+#ifndef EIGEN_TEST_THREADED_DEVICE_H
+#define EIGEN_TEST_THREADED_DEVICE_H
+
+// Common header of the tests of the algorithms which run on a CoreThreadPoolDevice, to include instead of main.h.
+// It enables the GEMM ThreadPool, and counts the products split across its threads by the other threads than the
+// main one of the test.
+
+#include <atomic>
+#include <thread>
+
+static std::atomic<int> nb_nested_parallel_products{0};
+static const std::thread::id test_main_thread = std::this_thread::get_id();
+
+#define EIGEN_PARALLEL_PRODUCT_PLUGIN \
+  if (std::this_thread::get_id() != test_main_thread) ++nb_nested_parallel_products;
+
+#define EIGEN_GEMM_THREADPOOL
+#include "main.h"
+#include <Eigen/ThreadPool>
+
+// Runs compute(), which evaluates an algorithm on a CoreThreadPoolDevice of \a pool, from the main thread and then
+// from a task of \a pool, where the device runs all the tasks inline. Either way, the tasks already occupy the threads
+// of the device, so that none of their products may start threads of the GEMM ThreadPool.
+template <typename Compute>
+void verify_device_products_sequential(ThreadPool& pool, const Compute& compute) {
+  // setGemmThreadPool() cannot be undone, so the pool outlives the test.
+  static ThreadPool gemmPool(4);
+  setGemmThreadPool(&gemmPool);
+  auto runOnPool = [&pool](const auto& f) {
+    Barrier barrier(1);
+    pool.Schedule([&]() {
+      f();
+      barrier.Notify();
+    });
+    barrier.Wait();
+  };
+
+  // A product issued by a task of the pool which is not one of the device is split.
+  MatrixXd a = MatrixXd::Random(256, 256), b = MatrixXd::Random(256, 256), c(256, 256);
+  nb_nested_parallel_products = 0;
+  runOnPool([&]() { c.noalias() = a * b; });
+  VERIFY(nb_nested_parallel_products.load() > 0);
+  VERIFY_IS_APPROX(c, (a * b).eval());
+
+  nb_nested_parallel_products = 0;
+  compute();
+  VERIFY_IS_EQUAL(nb_nested_parallel_products.load(), 0);
+  runOnPool(compute);
+  VERIFY_IS_EQUAL(nb_nested_parallel_products.load(), 0);
+}
+
+#endif  // EIGEN_TEST_THREADED_DEVICE_H